@@ -0,0 +1,113 @@
+/*
+ * Host to guest call overhead microbenchmark
+ *
+ * An exported function called through a trap-catching entry, the way
+ * wasm_rt_impl_try() sets it up with the signal handler memcheck: with
+ * sigsetjmp(buf, 1), which saves the signal mask with a syscall on every
+ * entry, and with sigsetjmp(buf, 0), where the handler unblocks its signal
+ * before jumping out. Times the entry against a plain call, and the path
+ * where every call faults on a PROT_NONE page.
+ *
+ * Build and run:
+ *   cc -O2 bench/entry.c -o entry-bench && ./entry-bench
+ */
+
+#define _GNU_SOURCE
+#include <setjmp.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#define ROUNDS 10000000
+#define TRAP_ROUNDS 200000
+#define NOINLINE __attribute__((noinline))
+
+static sigjmp_buf target;
+static int unblock;
+static volatile uint32_t* guard;
+static volatile uint32_t trapFrom;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void handler(int sig, siginfo_t* si, void* unused) {
+    if (unblock) {
+        sigset_t set;
+        sigemptyset(&set);
+        sigaddset(&set, sig);
+        sigprocmask(SIG_UNBLOCK, &set, NULL);
+    }
+    siglongjmp(target, 1);
+}
+
+/* The exported function: faults like an out-of-bounds access from trapFrom on */
+NOINLINE static uint32_t guest(uint32_t x) {
+    if (x >= trapFrom) {
+        return *guard;
+    }
+    return x + 1;
+}
+
+NOINLINE static uint32_t call_plain(uint32_t x) {
+    return guest(x);
+}
+
+NOINLINE static uint32_t call_savemask(uint32_t x) {
+    if (sigsetjmp(target, 1) != 0) {
+        return 0;
+    }
+    return guest(x);
+}
+
+NOINLINE static uint32_t call_nosavemask(uint32_t x) {
+    if (sigsetjmp(target, 0) != 0) {
+        return 0;
+    }
+    return guest(x);
+}
+
+#define BENCH(name, call, rounds)                                       \
+    do {                                                                \
+        double start = now();                                           \
+        uint32_t sum = 0;                                               \
+        uint32_t round;                                                 \
+        for (round = 0; round < rounds; round++) {                      \
+            sum += call(round);                                         \
+        }                                                               \
+        printf("%-30s %8.2f ns/call  (%u)\n", name,                    \
+               (now() - start) * 1e9 / rounds, sum);                    \
+    } while (0)
+
+int main(void) {
+    struct sigaction sa;
+    sa.sa_flags = SA_SIGINFO;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_sigaction = handler;
+    if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+        perror("sigaction");
+        return 1;
+    }
+    guard = mmap(NULL, 4096, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (guard == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+
+    trapFrom = UINT32_MAX;
+    BENCH("plain call", call_plain, ROUNDS);
+    BENCH("sigsetjmp(1)", call_savemask, ROUNDS);
+    BENCH("sigsetjmp(0)", call_nosavemask, ROUNDS);
+
+    trapFrom = 0;
+    unblock = 0;
+    BENCH("sigsetjmp(1), trap", call_savemask, TRAP_ROUNDS);
+    unblock = 1;
+    BENCH("sigsetjmp(0) + unblock, trap", call_nosavemask, TRAP_ROUNDS);
+    return 0;
+}
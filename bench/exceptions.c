@@ -0,0 +1,117 @@
+/*
+ * Exception handling lowering microbenchmark
+ *
+ * A try block around a call, lowered the way w2c2 translates it (a check
+ * of the pending exception after the call, nothing on entry to the try)
+ * and with setjmp on entry to every try and longjmp at the throw, the way
+ * trap handling works. Times the path where nothing is thrown, against the
+ * plain call, and the path where every call throws.
+ *
+ * Build and run:
+ *   cc -O2 bench/exceptions.c -o exceptions-bench && ./exceptions-bench
+ */
+
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define ROUNDS 20000000
+#define NOINLINE __attribute__((noinline))
+#define UNLIKELY(x) __builtin_expect(!!(x), 0)
+
+typedef struct { uint8_t unused; } Tag;
+typedef struct { const Tag* tag; uint64_t values[8]; } Exception;
+
+static Tag tag;
+static Exception pending;
+static jmp_buf* target;
+static volatile uint32_t throwFrom;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+NOINLINE static uint32_t leaf(uint32_t x) {
+    return x + 1;
+}
+
+NOINLINE static uint32_t no_try(uint32_t x) {
+    return leaf(x);
+}
+
+/* Flag lowering: throw stores the exception and returns, calls are followed by a check */
+
+NOINLINE static uint32_t leaf_flag(uint32_t x) {
+    if (x >= throwFrom) {
+        pending.tag = &tag;
+        pending.values[0] = x;
+        return 0;
+    }
+    return x + 1;
+}
+
+NOINLINE static uint32_t try_flag(uint32_t x) {
+    uint32_t result = leaf_flag(x);
+    if (UNLIKELY(pending.tag != NULL)) goto handler;
+    return result;
+handler:
+    if (pending.tag == &tag) {
+        Exception caught = pending;
+        pending.tag = NULL;
+        return (uint32_t)caught.values[0];
+    }
+    return 0;
+}
+
+/* setjmp lowering: every try saves the registers, throw jumps back to the innermost */
+
+NOINLINE static uint32_t leaf_setjmp(uint32_t x) {
+    if (x >= throwFrom) {
+        pending.tag = &tag;
+        pending.values[0] = x;
+        longjmp(*target, 1);
+    }
+    return x + 1;
+}
+
+NOINLINE static uint32_t try_setjmp(uint32_t x) {
+    jmp_buf buf;
+    jmp_buf* previous = target;
+    volatile uint32_t result = 0;
+    target = &buf;
+    if (setjmp(buf) == 0) {
+        result = leaf_setjmp(x);
+    } else if (pending.tag == &tag) {
+        pending.tag = NULL;
+        result = (uint32_t)pending.values[0];
+    }
+    target = previous;
+    return result;
+}
+
+#define BENCH(name, call)                                               \
+    do {                                                                \
+        double start = now();                                           \
+        uint32_t sum = 0;                                               \
+        uint32_t round;                                                 \
+        for (round = 0; round < ROUNDS; round++) {                      \
+            sum += call(round);                                         \
+        }                                                               \
+        printf("%-28s %8.2f ns/try  (%u)\n", name,                     \
+               (now() - start) * 1e9 / ROUNDS, sum);                    \
+    } while (0)
+
+int main(void) {
+    throwFrom = UINT32_MAX;
+    BENCH("call, no try", no_try);
+    BENCH("flag check, no throw", try_flag);
+    BENCH("setjmp, no throw", try_setjmp);
+
+    throwFrom = 0;
+    BENCH("flag check, throw", try_flag);
+    BENCH("setjmp, throw", try_setjmp);
+    return 0;
+}
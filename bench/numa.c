@@ -0,0 +1,132 @@
+/*
+ * Local versus remote linear memory bandwidth on NUMA hosts (Linux)
+ *
+ * Places a linear memory sized buffer the way WASM2NATIVE_NUMA_MEMORY does
+ * (mmap, then mbind to one node) and streams through it from a thread
+ * pinned the way WASM2NATIVE_NUMA_CPU does, for every pair of CPU node and
+ * memory node, plus memory interleaved over all nodes. The guest loop is a
+ * memory-bound wasm-style kernel: 32-bit loads and stores at offsets from
+ * the memory base.
+ *
+ * Build and run:
+ *   cc -O2 bench/numa.c -o numa-bench && ./numa-bench [MiB]
+ */
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#define MAX_NODES 64
+#define PASSES 8
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int node_cpus(int node, cpu_set_t* set) {
+    char path[64];
+    char list[4096];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        return 0;
+    }
+    int found = fgets(list, sizeof(list), f) != NULL;
+    fclose(f);
+
+    CPU_ZERO(set);
+    char* p = list;
+    while (found && *p >= '0' && *p <= '9') {
+        long first = strtol(p, &p, 10);
+        long last = *p == '-' ? strtol(p + 1, &p, 10) : first;
+        for (; first <= last; first++) {
+            CPU_SET(first, set);
+        }
+        if (*p == ',') {
+            p++;
+        }
+    }
+    return found;
+}
+
+/* Reads every word and writes back a running sum, like a guest scanning its heap */
+static uint32_t stream(uint8_t* mem, size_t size) {
+    uint32_t sum = 0;
+    uint32_t addr;
+    for (addr = 0; addr < size; addr += 4) {
+        uint32_t value;
+        memcpy(&value, mem + addr, 4);
+        sum += value;
+        memcpy(mem + addr, &sum, 4);
+    }
+    return sum;
+}
+
+static void run(const char* cpu_name, const char* mem_name, int mode, unsigned long* nodes, size_t size) {
+    uint8_t* mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        perror("mmap");
+        exit(1);
+    }
+    if (syscall(SYS_mbind, mem, size, mode, nodes, MAX_NODES + 1, 0) != 0) {
+        perror("mbind");
+        exit(1);
+    }
+    memset(mem, 1, size);
+
+    stream(mem, size);
+    double start = now();
+    uint32_t sum = 0;
+    int pass;
+    for (pass = 0; pass < PASSES; pass++) {
+        sum += stream(mem, size);
+    }
+    double seconds = now() - start;
+    printf("cpu %-6s mem %-12s %8.2f GB/s  (%u)\n", cpu_name, mem_name,
+           2.0 * size * PASSES / seconds / 1e9, sum);
+    munmap(mem, size);
+}
+
+int main(int argc, char** argv) {
+    size_t size = (size_t)(argc > 1 ? atoi(argv[1]) : 512) << 20;
+    int nodes = 0;
+    cpu_set_t sets[MAX_NODES];
+    while (nodes < MAX_NODES && node_cpus(nodes, &sets[nodes])) {
+        nodes++;
+    }
+    if (nodes == 0) {
+        fprintf(stderr, "no NUMA nodes in /sys/devices/system/node\n");
+        return 1;
+    }
+
+    unsigned long all = 0;
+    int cpu, node;
+    for (node = 0; node < nodes; node++) {
+        all |= 1ul << node;
+    }
+    for (cpu = 0; cpu < nodes; cpu++) {
+        char cpu_name[16];
+        snprintf(cpu_name, sizeof(cpu_name), "node%d", cpu);
+        if (sched_setaffinity(0, sizeof(sets[cpu]), &sets[cpu]) != 0) {
+            continue;
+        }
+        for (node = 0; node < nodes; node++) {
+            char mem_name[24];
+            unsigned long mask = 1ul << node;
+            snprintf(mem_name, sizeof(mem_name), "node%d%s", node, node == cpu ? "" : " remote");
+            run(cpu_name, mem_name, MPOL_BIND, &mask, size);
+        }
+        run(cpu_name, "interleaved", MPOL_INTERLEAVE, &all, size);
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Startup latency of a translated executable
+ *
+ * Launches the executable repeatedly with its output discarded, and breaks
+ * the time from fork to the first guest instruction down by phase, from
+ * the report the executable writes at exit with WASM2NATIVE_STARTUP_TRACE:
+ *   exec   fork, exec, dynamic loading and libc setup, up to main()
+ *   host   WASI and runtime setup before init()
+ *   init   init(): linear memory, data segments, tables
+ *   start  launch to the first guest instruction
+ *   run    the guest, up to exit
+ *   wasi   uvwasi_init (preopens, fd table), before or during the run
+ *   total  launch to the parent seeing the exit
+ *
+ * Build and run:
+ *   cc -O2 bench/startup.c -o startup-bench && ./startup-bench ./hello.elf [runs] [args...]
+ */
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define PHASES 6
+
+static const char* phase_names[PHASES + 1] = { "exec", "host", "init", "start", "run", "wasi", "total" };
+
+static unsigned long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Runs the executable once, returns the number of phases read from its report
+static int launch(char** argv, double* phases) {
+    int pipefd[2];
+    if (pipe(pipefd) != 0) {
+        perror("pipe");
+        exit(1);
+    }
+
+    char trace[64];
+    unsigned long long start = now_ns();
+    snprintf(trace, sizeof(trace), "%llu", start);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (pid == 0) {
+        int null = open("/dev/null", O_RDWR);
+        dup2(null, STDIN_FILENO);
+        dup2(null, STDOUT_FILENO);
+        dup2(pipefd[1], STDERR_FILENO);
+        close(pipefd[0]);
+        setenv("WASM2NATIVE_STARTUP_TRACE", trace, 1);
+        execv(argv[0], argv);
+        _exit(127);
+    }
+    close(pipefd[1]);
+
+    char report[4096];
+    size_t len = 0;
+    ssize_t n;
+    while ((n = read(pipefd[0], report + len, sizeof(report) - 1 - len)) > 0) {
+        len += n;
+    }
+    report[len] = '\0';
+    close(pipefd[0]);
+
+    int status;
+    waitpid(pid, &status, 0);
+    phases[PHASES] = (now_ns() - start) / 1e3;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) == 127) {
+        fprintf(stderr, "%s: cannot run\n", argv[0]);
+        exit(1);
+    }
+
+    const char* line = strstr(report, "wasm2native startup:");
+    if (line == NULL) {
+        return 0;
+    }
+    return sscanf(line, "wasm2native startup: exec %lf host %lf init %lf start %lf run %lf wasi %lf",
+                  &phases[0], &phases[1], &phases[2], &phases[3], &phases[4], &phases[5]);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <executable> [runs] [args...]\n", argv[0]);
+        return 1;
+    }
+    int runs = argc > 2 ? atoi(argv[2]) : 1000;
+    char** args = calloc(argc, sizeof(char*));
+    args[0] = argv[1];
+    for (int i = 3; i < argc; i++) {
+        args[i - 2] = argv[i];
+    }
+
+    double phases[PHASES + 1];
+    double sum[PHASES + 1] = { 0 };
+    double best[PHASES + 1];
+    int traced = PHASES;
+    launch(args, phases);   // warm up the page cache
+    for (int run = 0; run < runs; run++) {
+        int found = launch(args, phases);
+        if (found < traced) {
+            traced = found;
+        }
+        for (int i = 0; i <= PHASES; i++) {
+            sum[i] += phases[i];
+            if (run == 0 || phases[i] < best[i]) {
+                best[i] = phases[i];
+            }
+        }
+    }
+
+    printf("%-8s %10s %10s\n", "phase", "mean us", "min us");
+    for (int i = 0; i <= PHASES; i++) {
+        if (i < PHASES && i >= traced) {
+            continue;
+        }
+        printf("%-8s %10.1f %10.1f\n", phase_names[i], sum[i] / runs, best[i]);
+    }
+    if (traced < PHASES) {
+        printf("(no startup trace from %s)\n", argv[1]);
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Float-to-int conversion microbenchmark
+ *
+ * Times every trapping (trunc) and saturating (trunc_sat) conversion
+ * as implemented by the w2c2 runtime header. Saturating conversions are
+ * timed on in-range inputs and on an unpredictable mix of in-range,
+ * out-of-range and NaN inputs.
+ *
+ * Build and run (after ./build.sh has unpacked and patched w2c2):
+ *   cc -O2 -Ideps/w2c2 bench/trunc.c -o trunc-bench -lm && ./trunc-bench
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "w2c2_base.h"
+
+#define COUNT 4096
+#define ROUNDS 20000
+
+void trap(Trap trap) {
+    fprintf(stderr, "unexpected trap: %s\n", trapDescription(trap));
+    exit(1);
+}
+
+static F32 inputsF32[COUNT];
+static F64 inputsF64[COUNT];
+static F32 mixedF32[COUNT];
+static F64 mixedF64[COUNT];
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#define BENCH(op, type, inputs)                                         \
+    do {                                                                \
+        volatile type sink;                                             \
+        type acc = 0;                                                   \
+        double start = now();                                           \
+        int round, i;                                                   \
+        for (round = 0; round < ROUNDS; round++) {                      \
+            for (i = 0; i < COUNT; i++) {                               \
+                acc += op(inputs[i]);                                   \
+            }                                                           \
+        }                                                               \
+        sink = acc;                                                     \
+        (void)sink;                                                     \
+        printf("%-22s %-10s %6.3f ns/op\n", #op, #inputs,               \
+               (now() - start) * 1e9 / ((double)ROUNDS * COUNT));       \
+    } while (0)
+
+int main(void) {
+    int i;
+
+    /* Values in [0, 2^31) are valid inputs for every conversion */
+    srand(1);
+    for (i = 0; i < COUNT; i++) {
+        inputsF64[i] = (F64)rand() + (F64)rand() / RAND_MAX;
+        inputsF32[i] = (F32)inputsF64[i];
+
+        switch (rand() % 4) {
+            case 0:
+                mixedF64[i] = inputsF64[i];
+                break;
+            case 1:
+                mixedF64[i] = -inputsF64[i];
+                break;
+            case 2:
+                mixedF64[i] = inputsF64[i] * 1e10;
+                break;
+            default:
+                mixedF64[i] = NAN;
+                break;
+        }
+        mixedF32[i] = (F32)mixedF64[i];
+    }
+
+    BENCH(I32_TRUNC_S_F32, U32, inputsF32);
+    BENCH(I32_TRUNC_U_F32, U32, inputsF32);
+    BENCH(I32_TRUNC_S_F64, U32, inputsF64);
+    BENCH(I32_TRUNC_U_F64, U32, inputsF64);
+    BENCH(I64_TRUNC_S_F32, U64, inputsF32);
+    BENCH(I64_TRUNC_U_F32, U64, inputsF32);
+    BENCH(I64_TRUNC_S_F64, U64, inputsF64);
+    BENCH(I64_TRUNC_U_F64, U64, inputsF64);
+
+    BENCH(I32_TRUNC_SAT_S_F32, U32, inputsF32);
+    BENCH(I32_TRUNC_SAT_U_F32, U32, inputsF32);
+    BENCH(I32_TRUNC_SAT_S_F64, U32, inputsF64);
+    BENCH(I32_TRUNC_SAT_U_F64, U32, inputsF64);
+    BENCH(I64_TRUNC_SAT_S_F32, U64, inputsF32);
+    BENCH(I64_TRUNC_SAT_U_F32, U64, inputsF32);
+    BENCH(I64_TRUNC_SAT_S_F64, U64, inputsF64);
+    BENCH(I64_TRUNC_SAT_U_F64, U64, inputsF64);
+
+    BENCH(I32_TRUNC_SAT_S_F32, U32, mixedF32);
+    BENCH(I32_TRUNC_SAT_U_F32, U32, mixedF32);
+    BENCH(I32_TRUNC_SAT_S_F64, U32, mixedF64);
+    BENCH(I32_TRUNC_SAT_U_F64, U32, mixedF64);
+    BENCH(I64_TRUNC_SAT_S_F32, U64, mixedF32);
+    BENCH(I64_TRUNC_SAT_U_F32, U64, mixedF32);
+    BENCH(I64_TRUNC_SAT_S_F64, U64, mixedF64);
+    BENCH(I64_TRUNC_SAT_U_F64, U64, mixedF64);
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * WASI per-call overhead microbenchmark
+ *
+ * Times the hot WASI calls as implemented by uvwasi and by the native
+ * Linux backend (src/wasi-native.h) on the same WASI fd: a small file
+ * in the current directory, opened through the preopen. path_* calls
+ * use a file three directories down, to show the directory cache.
+ *
+ * Build and run (after ./build.sh has fetched and built uvwasi and libuv):
+ *   cc -O2 -D_GNU_SOURCE -Isrc -Ibuild/_deps/uvwasi-src/include -Ibuild/_deps/uvwasi-src/src \
+ *      -Ibuild/_deps/libuv-src/include bench/wasi.c -o wasi-bench \
+ *      build/_deps/uvwasi-build/libuvwasi_a.a build/_deps/libuv-build/libuv_a.a -lpthread -ldl \
+ *      && ./wasi-bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "wasi-native.h"
+
+#define ROUNDS 1000000
+#define FILE_NAME "wasi-bench.tmp"
+#define DIR_NAME  "wasi-bench.d"
+#define DEEP_NAME DIR_NAME "/a/b/" FILE_NAME
+
+static uvwasi_t uvwasi;
+static uvwasi_fd_t fd;
+static char data[64];
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#define BENCH(name, call)                                               \
+    do {                                                                \
+        double start = now();                                           \
+        int round;                                                      \
+        for (round = 0; round < ROUNDS; round++) {                      \
+            if (call != UVWASI_ESUCCESS) {                              \
+                fprintf(stderr, "%s failed\n", name);                   \
+                exit(1);                                                \
+            }                                                           \
+        }                                                               \
+        printf("%-32s %8.1f ns/call\n", name,                           \
+               (now() - start) * 1e9 / ROUNDS);                         \
+    } while (0)
+
+int main(void) {
+    uvwasi_ciovec_t ciov = { data, sizeof(data) };
+    uvwasi_iovec_t iov = { data, sizeof(data) };
+    uvwasi_size_t n;
+    uvwasi_filesize_t pos;
+    uvwasi_filestat_t stat;
+    uvwasi_fd_t deep;
+    uvwasi_timestamp_t t;
+
+    uvwasi_preopen_t preopen = { "/", "." };
+    uvwasi_options_t options;
+    uvwasi_options_init(&options);
+    options.preopenc = 1;
+    options.preopens = &preopen;
+    if (uvwasi_init(&uvwasi, &options) != UVWASI_ESUCCESS) {
+        fprintf(stderr, "uvwasi_init failed\n");
+        return 1;
+    }
+
+    if (uvwasi_path_open(&uvwasi, 3, 0, FILE_NAME, sizeof(FILE_NAME) - 1,
+                         UVWASI_O_CREAT | UVWASI_O_TRUNC,
+                         UVWASI_RIGHT_FD_READ | UVWASI_RIGHT_FD_WRITE | UVWASI_RIGHT_FD_SEEK |
+                         UVWASI_RIGHT_FD_TELL | UVWASI_RIGHT_FD_FILESTAT_GET,
+                         0, 0, &fd) != UVWASI_ESUCCESS) {
+        fprintf(stderr, "path_open failed\n");
+        return 1;
+    }
+
+    BENCH("uvwasi fd_pwrite",           uvwasi_fd_pwrite(&uvwasi, fd, &ciov, 1, 0, &n));
+    BENCH("native fd_pwrite",           wasi_native_fd_pwrite(&uvwasi, fd, &ciov, 1, 0, &n));
+    BENCH("uvwasi fd_pread",            uvwasi_fd_pread(&uvwasi, fd, &iov, 1, 0, &n));
+    BENCH("native fd_pread",            wasi_native_fd_pread(&uvwasi, fd, &iov, 1, 0, &n));
+    BENCH("uvwasi fd_seek",             uvwasi_fd_seek(&uvwasi, fd, 0, UVWASI_WHENCE_SET, &pos));
+    BENCH("native fd_seek",             wasi_native_fd_seek(&uvwasi, fd, 0, UVWASI_WHENCE_SET, &pos));
+    uvwasi_fd_seek(&uvwasi, fd, 0, UVWASI_WHENCE_END, &pos);
+    BENCH("uvwasi fd_read (at EOF)",    uvwasi_fd_read(&uvwasi, fd, &iov, 1, &n));
+    BENCH("native fd_read (at EOF)",    wasi_native_fd_read(&uvwasi, fd, &iov, 1, &n));
+    BENCH("uvwasi fd_filestat_get",     uvwasi_fd_filestat_get(&uvwasi, fd, &stat));
+    BENCH("native fd_filestat_get",     wasi_native_fd_filestat_get(&uvwasi, fd, &stat));
+
+    BENCH("uvwasi clock_time_get",      uvwasi_clock_time_get(&uvwasi, UVWASI_CLOCK_REALTIME, 0, &t));
+    BENCH("native clock_time_get",      wasi_native_clock_time_get(&uvwasi, UVWASI_CLOCK_REALTIME, 0, &t));
+    BENCH("uvwasi random_get (16)",     uvwasi_random_get(&uvwasi, data, 16));
+    BENCH("native random_get (16)",     wasi_native_random_get(&uvwasi, data, 16));
+
+    mkdir(DIR_NAME, 0777);
+    mkdir(DIR_NAME "/a", 0777);
+    mkdir(DIR_NAME "/a/b", 0777);
+    fclose(fopen(DEEP_NAME, "w"));
+    BENCH("uvwasi path_filestat_get",   uvwasi_path_filestat_get(&uvwasi, 3, 0, DEEP_NAME,
+                                                                 sizeof(DEEP_NAME) - 1, &stat));
+    BENCH("native path_filestat_get",   wasi_native_path_filestat_get(&uvwasi, 3, 0, DEEP_NAME,
+                                                                      sizeof(DEEP_NAME) - 1, &stat));
+    BENCH("uvwasi path_open+fd_close",  uvwasi_path_open(&uvwasi, 3, 0, DEEP_NAME, sizeof(DEEP_NAME) - 1,
+                                                         0, UVWASI_RIGHT_FD_READ, 0, 0, &deep) ||
+                                        uvwasi_fd_close(&uvwasi, deep));
+    BENCH("native path_open+fd_close",  wasi_native_path_open(&uvwasi, 3, 0, DEEP_NAME, sizeof(DEEP_NAME) - 1,
+                                                              0, UVWASI_RIGHT_FD_READ, 0, 0, &deep) ||
+                                        wasi_native_fd_close(&uvwasi, deep));
+
+    wasi_native_fd_close(&uvwasi, fd);
+    wasi_native_reset();
+    remove(FILE_NAME);
+    remove(DEEP_NAME);
+    remove(DIR_NAME "/a/b");
+    remove(DIR_NAME "/a");
+    remove(DIR_NAME);
+    uvwasi_destroy(&uvwasi);
+    return 0;
+}
@@ -8,12 +8,34 @@ rm -rf ./src/wasm/
 #wasm2c --no-debug-names "$1" -o wasi-app.c
 #mv wasi-app.* ./src
 
+# Hot functions from a profile or "loops", see build.sh
+HOT_OPTIONS=""
+if [ "$HOT_FUNCTIONS" = "loops" ]; then
+    HOT_OPTIONS="-L"
+elif [ -n "$HOT_FUNCTIONS" ]; then
+    HOT_OPTIONS="-H $HOT_FUNCTIONS"
+fi
+
 mkdir -p ./src/wasm/
-./deps/w2c2/w2c2 -j $JOBS -f 250 -o ./src/wasm/ "$1"
+./deps/w2c2/w2c2 -j $JOBS -f 250 -e $HOT_OPTIONS -o ./src/wasm/ "$1"
 
-OPT_FLAGS="-O3 -flto=thin -fomit-frame-pointer -fno-stack-protector -march=native"
+OPT_FLAGS="-O3 -fomit-frame-pointer -fno-stack-protector -march=native"
+LTO_FLAGS="-flto=thin"
 SRCS="$(ls ./src/wasm/*.c) src/wasi-main.c"
-DEPS="-Ideps/w2c2/ -Ibuild/_deps/uvwasi-src/include -Lbuild/_deps/libuv-build -Lbuild/_deps/uvwasi-build -luvwasi_a -luv_a -lpthread -ldl -lm"
+DEPS="-Ideps/w2c2/ -Ibuild/_deps/uvwasi-src/include -Ibuild/_deps/uvwasi-src/src -Ibuild/_deps/libuv-src/include -Lbuild/_deps/libuv-build -Lbuild/_deps/uvwasi-build -luvwasi_a -luv_a -lpthread -ldl -lm"
+
+# With hot_*.c files, the other translated functions are optimized for size. They are
+# compiled to native objects: as LTO bitcode they would be optimized again at link time
+# with the link's -O3, and lose the size tier
+if ls ./src/wasm/hot_*.c >/dev/null 2>&1; then
+    mkdir -p ./build/cold
+    SRCS="$(ls ./src/wasm/hot_*.c ./src/wasm/exports.c 2>/dev/null) src/wasi-main.c"
+    for src in ./src/wasm/[0-9]*.c ./src/wasm/inits.c; do
+        obj="./build/cold/$(basename "$src" .c).o"
+        $CC $OPT_FLAGS ${COLD_OPTIONS:-"-Os"} -fno-lto -Ideps/w2c2/ -c "$src" -o "$obj" || exit 1
+        SRCS="$SRCS $obj"
+    done
+fi
 
 
 
@@ -21,4 +43,4 @@ fn_out=$(basename -- "$1")
 fn_out="${fn_out%%.*}.elf"
 
 rm -f ./${fn_out}
-$CC $OPT_FLAGS $SRCS $DEPS -o ./${fn_out}
+$CC $OPT_FLAGS $LTO_FLAGS $SRCS $DEPS -o ./${fn_out}
@@ -3,11 +3,19 @@ export CXX
 export CFLAGS
 export LDFLAGS
 
-if [ ! -f ./deps/w2c2/w2c2 ]; then
+# w2c2 is rebuilt whenever the set of local patches changes
+W2C2_PATCHES=$(cat ./deps/w2c2-patches/*.patch | cksum)
+
+if [ ! -f ./deps/w2c2/w2c2 ] || [ "$(cat ./deps/w2c2/.patches 2>/dev/null)" != "$W2C2_PATCHES" ]; then
+    rm -rf ./deps/w2c2
     cd ./deps
     unzip -o w2c2.zip
     cd w2c2
+    for patch in ../w2c2-patches/*.patch; do
+        patch -p1 < "$patch" || exit 1
+    done
     make
+    echo "$W2C2_PATCHES" > .patches
     cd ../..
 fi
 
@@ -20,17 +28,65 @@ rm -rf ./src/wasm
 
 JOBS=$((`nproc`+1))
 
+# Module names are the file names without extension, e.g. plugin.wasm provides the "plugin" import module
+module_name() {
+    name=$(basename -- "$1")
+    echo "${name%%.*}"
+}
+
+# Imports between the given modules are resolved at build time and become direct calls
+LINK_OPTIONS=""
+for module in "$@"; do
+    LINK_OPTIONS="$LINK_OPTIONS -l $(module_name "$module")"
+done
+
+# Hot functions go to hot_*.c files, which keep the full optimization level while the rest is
+# optimized for size (see CMakeLists.txt): a profile (e.g. perf report output), or "loops"
+HOT_OPTIONS=""
+if [ "$HOT_FUNCTIONS" = "loops" ]; then
+    HOT_OPTIONS="-L"
+elif [ -n "$HOT_FUNCTIONS" ]; then
+    HOT_OPTIONS="-H $HOT_FUNCTIONS"
+fi
+
 mkdir -p ./src/wasm
-./deps/w2c2/w2c2 -j $JOBS -f 250 -o ./src/wasm/ "$1"
+./deps/w2c2/w2c2 -j $JOBS -f 250 -e $W2C2_OPTIONS $HOT_OPTIONS -n "$(module_name "$1")" $LINK_OPTIONS -o ./src/wasm/ "$1" || exit 1
+
+# Further modules get their own memory and symbols prefixed with their name, see src/wasm/modules.h
+if [ $# -gt 1 ]; then
+    LINKED_MODULES=""
+    for module in "$@"; do
+        if [ "$module" = "$1" ]; then
+            continue
+        fi
+        name=$(module_name "$module")
+        prefix=$(echo "$name" | tr -c 'A-Za-z0-9_\n' '_')
+        mkdir -p "./src/wasm/$prefix"
+        ./deps/w2c2/w2c2 -j $JOBS -f 250 $W2C2_OPTIONS $HOT_OPTIONS -n "$name" -x "$prefix" $LINK_OPTIONS -o "./src/wasm/$prefix/" "$module" || exit 1
+        LINKED_MODULES="$LINKED_MODULES X($prefix)"
+    done
+    echo "#define WASM_LINKED_MODULES(X)$LINKED_MODULES" > ./src/wasm/modules.h
+fi
+
+# Pre-size the memory from the peak recorded by a previous run (WASM2NATIVE_MEMORY_STATS)
+if [ -n "$MEMORY_STATS" ] && [ -f "$MEMORY_STATS" ]; then
+    PEAK_PAGES=$(awk '$1 == "peak_pages" { print $2 }' "$MEMORY_STATS")
+    if [ -n "$PEAK_PAGES" ]; then
+        CMAKE_OPTIONS="$CMAKE_OPTIONS -DWASM_MEMORY_RESERVE_PAGES=$PEAK_PAGES"
+    fi
+fi
 
 mkdir -p build
 cd build
-cmake ..
+cmake $CMAKE_OPTIONS ..
 cmake --build . -j $JOBS
 cd ..
 
 fn_out=$(basename -- "$1")
 fn_out="${fn_out%%.*}.elf"
 
-rm -f ./${fn_out}
-cp ./build/app.out ./${fn_out}
+# Library builds (WASM2NATIVE_LIBRARY) leave build/libwasm2native.a in place
+if [ -f ./build/app.out ]; then
+    rm -f ./${fn_out}
+    cp ./build/app.out ./${fn_out}
+fi
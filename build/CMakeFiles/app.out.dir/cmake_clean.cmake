@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/app.out.dir/src/wasi-main.c.o"
+  "CMakeFiles/app.out.dir/src/wasi-main.c.o.d"
+  "CMakeFiles/app.out.dir/src/wasm/00000.c.o"
+  "CMakeFiles/app.out.dir/src/wasm/00000.c.o.d"
+  "CMakeFiles/app.out.dir/src/wasm/exports.c.o"
+  "CMakeFiles/app.out.dir/src/wasm/exports.c.o.d"
+  "CMakeFiles/app.out.dir/src/wasm/inits.c.o"
+  "CMakeFiles/app.out.dir/src/wasm/inits.c.o.d"
+  "app.out"
+  "app.out.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/app.out.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
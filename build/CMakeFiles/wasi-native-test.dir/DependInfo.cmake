@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/wasi-native.c" "CMakeFiles/wasi-native-test.dir/tests/wasi-native.c.o" "gcc" "CMakeFiles/wasi-native-test.dir/tests/wasi-native.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/_deps/uvwasi-build/CMakeFiles/uvwasi_a.dir/DependInfo.cmake"
+  "/root/repo/build/_deps/libuv-build/CMakeFiles/uv_a.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasi-native-test.dir/tests/wasi-native.c.o"
+  "CMakeFiles/wasi-native-test.dir/tests/wasi-native.c.o.d"
+  "wasi-native-test"
+  "wasi-native-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wasi-native-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
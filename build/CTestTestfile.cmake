@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(wasi-native "/root/repo/build/wasi-native-test")
+set_tests_properties(wasi-native PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;104;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("_deps/uvwasi-build")
@@ -0,0 +1,83 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uv.dir/src/fs-poll.c.o"
+  "CMakeFiles/uv.dir/src/fs-poll.c.o.d"
+  "CMakeFiles/uv.dir/src/idna.c.o"
+  "CMakeFiles/uv.dir/src/idna.c.o.d"
+  "CMakeFiles/uv.dir/src/inet.c.o"
+  "CMakeFiles/uv.dir/src/inet.c.o.d"
+  "CMakeFiles/uv.dir/src/random.c.o"
+  "CMakeFiles/uv.dir/src/random.c.o.d"
+  "CMakeFiles/uv.dir/src/strscpy.c.o"
+  "CMakeFiles/uv.dir/src/strscpy.c.o.d"
+  "CMakeFiles/uv.dir/src/threadpool.c.o"
+  "CMakeFiles/uv.dir/src/threadpool.c.o.d"
+  "CMakeFiles/uv.dir/src/timer.c.o"
+  "CMakeFiles/uv.dir/src/timer.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/async.c.o"
+  "CMakeFiles/uv.dir/src/unix/async.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/core.c.o"
+  "CMakeFiles/uv.dir/src/unix/core.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/dl.c.o"
+  "CMakeFiles/uv.dir/src/unix/dl.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/epoll.c.o"
+  "CMakeFiles/uv.dir/src/unix/epoll.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/fs.c.o"
+  "CMakeFiles/uv.dir/src/unix/fs.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/getaddrinfo.c.o"
+  "CMakeFiles/uv.dir/src/unix/getaddrinfo.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/getnameinfo.c.o"
+  "CMakeFiles/uv.dir/src/unix/getnameinfo.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/linux-core.c.o"
+  "CMakeFiles/uv.dir/src/unix/linux-core.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/linux-inotify.c.o"
+  "CMakeFiles/uv.dir/src/unix/linux-inotify.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/linux-syscalls.c.o"
+  "CMakeFiles/uv.dir/src/unix/linux-syscalls.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/loop-watcher.c.o"
+  "CMakeFiles/uv.dir/src/unix/loop-watcher.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/loop.c.o"
+  "CMakeFiles/uv.dir/src/unix/loop.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/pipe.c.o"
+  "CMakeFiles/uv.dir/src/unix/pipe.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/poll.c.o"
+  "CMakeFiles/uv.dir/src/unix/poll.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/process.c.o"
+  "CMakeFiles/uv.dir/src/unix/process.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/procfs-exepath.c.o"
+  "CMakeFiles/uv.dir/src/unix/procfs-exepath.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/proctitle.c.o"
+  "CMakeFiles/uv.dir/src/unix/proctitle.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/random-devurandom.c.o"
+  "CMakeFiles/uv.dir/src/unix/random-devurandom.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/random-getrandom.c.o"
+  "CMakeFiles/uv.dir/src/unix/random-getrandom.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/random-sysctl-linux.c.o"
+  "CMakeFiles/uv.dir/src/unix/random-sysctl-linux.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/signal.c.o"
+  "CMakeFiles/uv.dir/src/unix/signal.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/stream.c.o"
+  "CMakeFiles/uv.dir/src/unix/stream.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/tcp.c.o"
+  "CMakeFiles/uv.dir/src/unix/tcp.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/thread.c.o"
+  "CMakeFiles/uv.dir/src/unix/thread.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/tty.c.o"
+  "CMakeFiles/uv.dir/src/unix/tty.c.o.d"
+  "CMakeFiles/uv.dir/src/unix/udp.c.o"
+  "CMakeFiles/uv.dir/src/unix/udp.c.o.d"
+  "CMakeFiles/uv.dir/src/uv-common.c.o"
+  "CMakeFiles/uv.dir/src/uv-common.c.o.d"
+  "CMakeFiles/uv.dir/src/uv-data-getter-setters.c.o"
+  "CMakeFiles/uv.dir/src/uv-data-getter-setters.c.o.d"
+  "CMakeFiles/uv.dir/src/version.c.o"
+  "CMakeFiles/uv.dir/src/version.c.o.d"
+  "libuv.pdb"
+  "libuv.so"
+  "libuv.so.1"
+  "libuv.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/uv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
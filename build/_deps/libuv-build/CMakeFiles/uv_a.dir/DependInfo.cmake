@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/build/_deps/libuv-src/src/fs-poll.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/fs-poll.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/fs-poll.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/idna.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/idna.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/idna.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/inet.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/inet.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/inet.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/random.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/random.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/random.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/strscpy.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/strscpy.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/strscpy.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/threadpool.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/threadpool.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/threadpool.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/timer.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/timer.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/timer.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/async.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/async.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/async.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/core.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/core.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/core.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/dl.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/dl.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/dl.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/epoll.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/epoll.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/epoll.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/fs.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/fs.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/fs.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/getaddrinfo.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/getaddrinfo.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/getaddrinfo.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/getnameinfo.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/getnameinfo.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/getnameinfo.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/linux-core.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/linux-core.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/linux-core.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/linux-inotify.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/linux-inotify.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/linux-inotify.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/linux-syscalls.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/linux-syscalls.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/linux-syscalls.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/loop-watcher.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/loop-watcher.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/loop-watcher.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/loop.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/loop.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/loop.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/pipe.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/pipe.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/pipe.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/poll.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/poll.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/poll.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/process.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/process.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/process.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/procfs-exepath.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/procfs-exepath.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/procfs-exepath.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/proctitle.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/proctitle.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/proctitle.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/random-devurandom.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/random-devurandom.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/random-devurandom.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/random-getrandom.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/random-getrandom.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/random-getrandom.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/random-sysctl-linux.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/random-sysctl-linux.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/random-sysctl-linux.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/signal.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/signal.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/signal.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/stream.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/stream.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/stream.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/tcp.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/tcp.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/tcp.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/thread.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/thread.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/thread.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/tty.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/tty.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/tty.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/unix/udp.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/udp.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/unix/udp.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/uv-common.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/uv-common.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/uv-common.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/uv-data-getter-setters.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/uv-data-getter-setters.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/uv-data-getter-setters.c.o.d"
+  "/root/repo/build/_deps/libuv-src/src/version.c" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/version.c.o" "gcc" "_deps/libuv-build/CMakeFiles/uv_a.dir/src/version.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/build/_deps/libuv-src
+# Build directory: /root/repo/build/_deps/libuv-build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,7 @@
+#ifndef UVBOOK_PLUGIN_SYSTEM
+#define UVBOOK_PLUGIN_SYSTEM
+
+// Plugin authors should use this to register their plugins with mfp.
+void mfp_register(const char *name);
+
+#endif
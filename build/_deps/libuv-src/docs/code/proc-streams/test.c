@@ -0,0 +1,8 @@
+#include <stdio.h>
+
+int main()
+{
+    fprintf(stderr, "This is stderr\n");
+    printf("This is stdout\n");
+    return 0;
+}
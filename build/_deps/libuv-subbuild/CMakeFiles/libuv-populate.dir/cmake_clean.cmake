@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuv-populate"
+  "CMakeFiles/libuv-populate-complete"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-build"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-configure"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-download"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-install"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-mkdir"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-patch"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-test"
+  "libuv-populate-prefix/src/libuv-populate-stamp/libuv-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/libuv-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+if("/root/repo/deps/libuv.zip" STREQUAL "")
+  message(FATAL_ERROR "LOCAL can't be empty")
+endif()
+
+if(NOT EXISTS "/root/repo/deps/libuv.zip")
+  message(FATAL_ERROR "File not found: /root/repo/deps/libuv.zip")
+endif()
+
+if("" STREQUAL "")
+  message(WARNING "File will not be verified since no URL_HASH specified")
+  return()
+endif()
+
+if("" STREQUAL "")
+  message(FATAL_ERROR "EXPECT_VALUE can't be empty")
+endif()
+
+message(STATUS "verifying file...
+     file='/root/repo/deps/libuv.zip'")
+
+file("" "/root/repo/deps/libuv.zip" actual_value)
+
+if(NOT "${actual_value}" STREQUAL "")
+  message(FATAL_ERROR "error:  hash of
+  /root/repo/deps/libuv.zip
+does not match expected value
+  expected: ''
+    actual: '${actual_value}'
+")
+endif()
+
+message(STATUS "verifying file... done")
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/build/_deps/libuv-src"
+  "/root/repo/build/_deps/libuv-build"
+  "/root/repo/build/_deps/libuv-subbuild/libuv-populate-prefix"
+  "/root/repo/build/_deps/libuv-subbuild/libuv-populate-prefix/tmp"
+  "/root/repo/build/_deps/libuv-subbuild/libuv-populate-prefix/src/libuv-populate-stamp"
+  "/root/repo/build/_deps/libuv-subbuild/libuv-populate-prefix/src"
+  "/root/repo/build/_deps/libuv-subbuild/libuv-populate-prefix/src/libuv-populate-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/build/_deps/libuv-subbuild/libuv-populate-prefix/src/libuv-populate-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/build/_deps/libuv-subbuild/libuv-populate-prefix/src/libuv-populate-stamp${cfgdir}") # cfgdir has leading slash
+endif()
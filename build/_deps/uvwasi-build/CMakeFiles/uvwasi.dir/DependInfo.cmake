@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/build/_deps/uvwasi-src/src/clocks.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/clocks.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/clocks.c.o.d"
+  "/root/repo/build/_deps/uvwasi-src/src/fd_table.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/fd_table.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/fd_table.c.o.d"
+  "/root/repo/build/_deps/uvwasi-src/src/path_resolver.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/path_resolver.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/path_resolver.c.o.d"
+  "/root/repo/build/_deps/uvwasi-src/src/poll_oneoff.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/poll_oneoff.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/poll_oneoff.c.o.d"
+  "/root/repo/build/_deps/uvwasi-src/src/uv_mapping.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/uv_mapping.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/uv_mapping.c.o.d"
+  "/root/repo/build/_deps/uvwasi-src/src/uvwasi.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/uvwasi.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/uvwasi.c.o.d"
+  "/root/repo/build/_deps/uvwasi-src/src/wasi_rights.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/wasi_rights.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/wasi_rights.c.o.d"
+  "/root/repo/build/_deps/uvwasi-src/src/wasi_serdes.c" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/wasi_serdes.c.o" "gcc" "_deps/uvwasi-build/CMakeFiles/uvwasi.dir/src/wasi_serdes.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/_deps/libuv-build/CMakeFiles/uv_a.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
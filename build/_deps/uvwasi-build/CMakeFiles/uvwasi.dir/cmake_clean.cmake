@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uvwasi.dir/src/clocks.c.o"
+  "CMakeFiles/uvwasi.dir/src/clocks.c.o.d"
+  "CMakeFiles/uvwasi.dir/src/fd_table.c.o"
+  "CMakeFiles/uvwasi.dir/src/fd_table.c.o.d"
+  "CMakeFiles/uvwasi.dir/src/path_resolver.c.o"
+  "CMakeFiles/uvwasi.dir/src/path_resolver.c.o.d"
+  "CMakeFiles/uvwasi.dir/src/poll_oneoff.c.o"
+  "CMakeFiles/uvwasi.dir/src/poll_oneoff.c.o.d"
+  "CMakeFiles/uvwasi.dir/src/uv_mapping.c.o"
+  "CMakeFiles/uvwasi.dir/src/uv_mapping.c.o.d"
+  "CMakeFiles/uvwasi.dir/src/uvwasi.c.o"
+  "CMakeFiles/uvwasi.dir/src/uvwasi.c.o.d"
+  "CMakeFiles/uvwasi.dir/src/wasi_rights.c.o"
+  "CMakeFiles/uvwasi.dir/src/wasi_rights.c.o.d"
+  "CMakeFiles/uvwasi.dir/src/wasi_serdes.c.o"
+  "CMakeFiles/uvwasi.dir/src/wasi_serdes.c.o.d"
+  "libuvwasi.pdb"
+  "libuvwasi.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/uvwasi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uvwasi_a.dir/src/clocks.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/clocks.c.o.d"
+  "CMakeFiles/uvwasi_a.dir/src/fd_table.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/fd_table.c.o.d"
+  "CMakeFiles/uvwasi_a.dir/src/path_resolver.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/path_resolver.c.o.d"
+  "CMakeFiles/uvwasi_a.dir/src/poll_oneoff.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/poll_oneoff.c.o.d"
+  "CMakeFiles/uvwasi_a.dir/src/uv_mapping.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/uv_mapping.c.o.d"
+  "CMakeFiles/uvwasi_a.dir/src/uvwasi.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/uvwasi.c.o.d"
+  "CMakeFiles/uvwasi_a.dir/src/wasi_rights.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/wasi_rights.c.o.d"
+  "CMakeFiles/uvwasi_a.dir/src/wasi_serdes.c.o"
+  "CMakeFiles/uvwasi_a.dir/src/wasi_serdes.c.o.d"
+  "libuvwasi_a.a"
+  "libuvwasi_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/uvwasi_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uvwasi-populate"
+  "CMakeFiles/uvwasi-populate-complete"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-build"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-configure"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-download"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-install"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-mkdir"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-patch"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-test"
+  "uvwasi-populate-prefix/src/uvwasi-populate-stamp/uvwasi-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/uvwasi-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
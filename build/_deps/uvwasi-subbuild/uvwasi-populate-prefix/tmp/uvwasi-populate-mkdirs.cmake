@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/build/_deps/uvwasi-src"
+  "/root/repo/build/_deps/uvwasi-build"
+  "/root/repo/build/_deps/uvwasi-subbuild/uvwasi-populate-prefix"
+  "/root/repo/build/_deps/uvwasi-subbuild/uvwasi-populate-prefix/tmp"
+  "/root/repo/build/_deps/uvwasi-subbuild/uvwasi-populate-prefix/src/uvwasi-populate-stamp"
+  "/root/repo/build/_deps/uvwasi-subbuild/uvwasi-populate-prefix/src"
+  "/root/repo/build/_deps/uvwasi-subbuild/uvwasi-populate-prefix/src/uvwasi-populate-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/build/_deps/uvwasi-subbuild/uvwasi-populate-prefix/src/uvwasi-populate-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/build/_deps/uvwasi-subbuild/uvwasi-populate-prefix/src/uvwasi-populate-stamp${cfgdir}") # cfgdir has leading slash
+endif()
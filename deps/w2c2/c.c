@@ -0,0 +1,5923 @@
+#include <stdio.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <math.h>
+#include "c.h"
+#include "file.h"
+#include "stringbuilder.h"
+#include "instruction.h"
+#include "typestack.h"
+#include "labelstack.h"
+
+static const char* functionNamePrefix = "f";
+static const char* localNamePrefix = "l";
+static const char* globalNamePrefix = "g";
+static const char* memoryNamePrefix = "m";
+static const char* dataSegmentNamePrefix = "d";
+static const char* tableNamePrefix = "t";
+static const char* stackNamePrefix = "s";
+static const char* labelNamePrefix = "L";
+static const char* tagNamePrefix = "x";
+static const char* handlerNamePrefix = "C";
+static const char* caughtNamePrefix = "c";
+
+static const char* valueTypeNames[wasmValueType_count] = {
+    "U32", "U64", "F32", "F64"
+};
+
+static const char* signedTypeNames[2] = {
+    "I32", "I64"
+};
+
+static const char* shiftMaskStrings[2] = {
+    "31", "63"
+};
+
+static const char* valueTypeStackNames[wasmValueType_count] = {
+    "i", "j", "f", "d"
+};
+
+static const char* keywordExtern = "extern";
+static const char* keywordStatic = "static";
+
+static const char* indentation = "  ";
+
+/*
+ * Linkage of the module being written. Set before the writer threads start
+ */
+static WasmCLinkage linkage = {NULL, NULL, NULL, 0};
+
+/*
+ * Hot functions of the module being written. Set before the writer threads start
+ */
+static WasmCTiering tiering = {NULL, false};
+
+typedef struct WasmCTailCalls {
+    /* Functions which contain a tail call, indexed by function index without imports */
+    bool* callers;
+    /* Types of the tail called functions, indexed by function type index */
+    bool* types;
+    /* Whether any function contains a tail call */
+    bool any;
+} WasmCTailCalls;
+
+/*
+ * Tail calls of the module being written, see wasmCFindTailCalls. Set before the writer threads start
+ */
+static WasmCTailCalls tailCalls = {NULL, NULL, false};
+
+static const char* tailCallNamePrefix = "tailCall";
+
+__inline__
+static
+void
+wasmCWriteFileLocalName(
+    FILE* file,
+    const U32 localIndex
+) {
+    fprintf(file, "%s%u", localNamePrefix, localIndex);
+}
+
+__inline__
+static
+void
+wasmCWriteFileEscaped(
+    FILE* file,
+    const char* name
+) {
+    static const char escapeChar = 'X';
+    const char* p = name;
+    for (; *p != '\0'; p++) {
+        char c = *p;
+        if (isalnum(c) && c != escapeChar) {
+            fputc(c, file);
+        } else {
+            fprintf(file, "%c%02X", escapeChar, c);
+        }
+    }
+}
+
+__inline__
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringEscaped(
+    StringBuilder* builder,
+    const char* name
+) {
+    static const char escapeChar = 'X';
+    const char* p = name;
+    for (; *p != '\0'; p++) {
+        char c = *p;
+        if (isalnum(c) && c != escapeChar) {
+            MUST (stringBuilderAppendChar(builder, c))
+        } else {
+            MUST (stringBuilderAppendChar(builder, escapeChar))
+            MUST (stringBuilderAppendCharHex(builder, c))
+        }
+    }
+    return true;
+}
+
+__inline__
+static
+void
+wasmCWriteFileSymbolPrefix(
+    FILE* file
+) {
+    if (linkage.prefix != NULL) {
+        fputs(linkage.prefix, file);
+        fputc('_', file);
+    }
+}
+
+__inline__
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringSymbolPrefix(
+    StringBuilder* builder
+) {
+    if (linkage.prefix != NULL) {
+        MUST (stringBuilderAppend(builder, linkage.prefix))
+        MUST (stringBuilderAppendChar(builder, '_'))
+    }
+    return true;
+}
+
+static
+bool
+wasmCIsLinkedModule(
+    const char* moduleName
+) {
+    U32 moduleIndex = 0;
+    for (; moduleIndex < linkage.linkedModuleCount; moduleIndex++) {
+        if (strcmp(linkage.linkedModules[moduleIndex], moduleName) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+__inline__
+static
+void
+wasmCWriteFileGlobalName(
+    FILE* file,
+    const WasmModule* module,
+    U32 globalIndex,
+    bool reference
+) {
+    if (globalIndex < module->globalImports.length) {
+        WasmGlobalImport globalImport = module->globalImports.imports[globalIndex];
+        if (!reference) {
+            fputs("(*", file);
+        }
+        wasmCWriteFileSymbolPrefix(file);
+        fputs(globalNamePrefix, file);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, globalImport.module);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, globalImport.name);
+        if (!reference) {
+            fputc(')', file);
+        }
+    } else {
+        if (reference) {
+            fputc('&', file);
+        }
+        wasmCWriteFileSymbolPrefix(file);
+        fputs(globalNamePrefix, file);
+        fprintf(file, "%u", globalIndex);
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringGlobalName(
+    StringBuilder* builder,
+    const WasmModule* module,
+    U32 globalIndex,
+    bool reference
+) {
+    if (globalIndex < module->globalImports.length) {
+        WasmGlobalImport globalImport = module->globalImports.imports[globalIndex];
+        if (!reference) {
+            MUST (stringBuilderAppend(builder, "(*"))
+        }
+        MUST (wasmCWriteStringSymbolPrefix(builder))
+        MUST (stringBuilderAppend(builder, globalNamePrefix))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, globalImport.module))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, globalImport.name))
+        if (!reference) {
+            MUST (stringBuilderAppendChar(builder, ')'))
+        }
+    } else {
+        if (reference) {
+            MUST (stringBuilderAppendChar(builder, '&'))
+        }
+        MUST (wasmCWriteStringSymbolPrefix(builder))
+        MUST (stringBuilderAppend(builder, globalNamePrefix))
+        MUST (stringBuilderAppendI64(builder, globalIndex))
+    }
+    return true;
+}
+
+__inline__
+static
+void
+wasmCWriteFileMemoryName(
+    FILE* file,
+    const WasmModule* module,
+    U32 memoryIndex,
+    bool reference
+) {
+    if (memoryIndex < module->memoryImports.length) {
+        WasmMemoryImport memoryImport = module->memoryImports.imports[memoryIndex];
+        if (!reference) {
+            fputs("(*", file);
+        }
+        wasmCWriteFileSymbolPrefix(file);
+        fputs(memoryNamePrefix, file);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, memoryImport.module);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, memoryImport.name);
+        if (!reference) {
+            fputc(')', file);
+        }
+    } else {
+        if (reference) {
+            fputc('&', file);
+        }
+        wasmCWriteFileSymbolPrefix(file);
+        fputs(memoryNamePrefix, file);
+        fprintf(file, "%u", memoryIndex);
+    }
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringMemoryName(
+    StringBuilder* builder,
+    const WasmModule* module,
+    U32 memoryIndex,
+    bool reference
+) {
+    if (memoryIndex < module->memoryImports.length) {
+        WasmMemoryImport memoryImport = module->memoryImports.imports[memoryIndex];
+        if (!reference) {
+            MUST (stringBuilderAppend(builder, "(*"))
+        }
+        MUST (wasmCWriteStringSymbolPrefix(builder))
+        MUST (stringBuilderAppend(builder, memoryNamePrefix))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, memoryImport.module))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, memoryImport.name))
+        if (!reference) {
+            MUST (stringBuilderAppendChar(builder, ')'))
+        }
+    } else {
+        if (reference) {
+            MUST (stringBuilderAppendChar(builder, '&'))
+        }
+        MUST (wasmCWriteStringSymbolPrefix(builder))
+        MUST (stringBuilderAppend(builder, memoryNamePrefix))
+        MUST (stringBuilderAppendI64(builder, (I64) memoryIndex))
+    }
+    return true;
+}
+
+__inline__
+static
+void
+wasmCWriteFileTableName(
+    FILE* file,
+    const WasmModule* module,
+    U32 tableIndex,
+    bool reference
+) {
+    if (tableIndex < module->tableImports.length) {
+        WasmTableImport tableImport = module->tableImports.imports[tableIndex];
+        if (!reference) {
+            fputs("(*", file);
+        }
+        wasmCWriteFileSymbolPrefix(file);
+        fputs(tableNamePrefix, file);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, tableImport.module);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, tableImport.name);
+        if (!reference) {
+            fputc(')', file);
+        }
+    } else {
+        if (reference) {
+            fputc('&', file);
+        }
+        wasmCWriteFileSymbolPrefix(file);
+        fputs(tableNamePrefix, file);
+        fprintf(file, "%u", tableIndex);
+    }
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringTableName(
+    StringBuilder* builder,
+    const WasmModule* module,
+    U32 tableIndex,
+    bool reference
+) {
+    if (tableIndex < module->tableImports.length) {
+        WasmTableImport tableImport = module->tableImports.imports[tableIndex];
+        if (!reference) {
+            MUST (stringBuilderAppend(builder, "(*"))
+        }
+        MUST (wasmCWriteStringSymbolPrefix(builder))
+        MUST (stringBuilderAppend(builder, tableNamePrefix))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, tableImport.module))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, tableImport.name))
+        if (!reference) {
+            MUST (stringBuilderAppendChar(builder, ')'))
+        }
+    } else {
+        if (reference) {
+            MUST (stringBuilderAppendChar(builder, '&'))
+        }
+        MUST (wasmCWriteStringSymbolPrefix(builder))
+        MUST (stringBuilderAppend(builder, tableNamePrefix))
+        MUST (stringBuilderAppendI64(builder, (I64) tableIndex))
+    }
+    return true;
+}
+
+__inline__
+static
+void
+wasmCWriteFileTagName(
+    FILE* file,
+    U32 tagIndex
+) {
+    wasmCWriteFileSymbolPrefix(file);
+    fputs(tagNamePrefix, file);
+    fprintf(file, "%u", tagIndex);
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringTagName(
+    StringBuilder* builder,
+    U32 tagIndex
+) {
+    MUST (stringBuilderAppendChar(builder, '&'))
+    MUST (wasmCWriteStringSymbolPrefix(builder))
+    MUST (stringBuilderAppend(builder, tagNamePrefix))
+    MUST (stringBuilderAppendI64(builder, (I64) tagIndex))
+    return true;
+}
+
+__inline__
+static
+void
+wasmCWriteFileDataSegmentName(
+    FILE* file,
+    const U32 dataSegmentIndex
+) {
+    wasmCWriteFileSymbolPrefix(file);
+    fputs(dataSegmentNamePrefix, file);
+    fprintf(file, "%u", dataSegmentIndex);
+}
+
+/*
+ * Functions named in the name section get the name appended to their index,
+ * reduced to a C identifier, so native profilers and debuggers show it
+ */
+#define functionNameSuffixMaxLength 96
+
+static
+bool
+wasmCGetFunctionNameSuffix(
+    const WasmModule* module,
+    U32 functionIndex,
+    char* result
+) {
+    const char* name = NULL;
+    size_t length = 0;
+
+    if (functionIndex >= module->functionNames.count) {
+        return false;
+    }
+    name = module->functionNames.names[functionIndex];
+    if (name == NULL) {
+        return false;
+    }
+
+    for (; *name != '\0' && length < functionNameSuffixMaxLength; name++) {
+        char c = *name;
+        if (!isalnum((unsigned char) c)) {
+            c = '_';
+        }
+        /* Collapse runs of special characters, e.g. in C++ names */
+        if (c == '_' && length > 0 && result[length - 1] == '_') {
+            continue;
+        }
+        if (length == 0 && c != '_') {
+            result[length++] = '_';
+        }
+        result[length++] = c;
+    }
+    if (length > 0 && result[length - 1] == '_') {
+        length--;
+    }
+    result[length] = '\0';
+
+    return length > 1;
+}
+
+static
+__inline__
+void
+wasmCWriteFileFunctionName(
+    FILE* file,
+    const WasmModule* module,
+    U32 functionIndex,
+    bool reference
+) {
+    if (functionIndex < module->functionImports.length) {
+        const WasmFunctionImport functionImport = module->functionImports.imports[functionIndex];
+        /* Functions of linked modules are called directly, not through an import pointer */
+        bool linked = wasmCIsLinkedModule(functionImport.module);
+        if (!reference && !linked) {
+            fputs("(*", file);
+        }
+        if (!linked) {
+            wasmCWriteFileSymbolPrefix(file);
+        }
+        fputs(functionNamePrefix, file);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, functionImport.module);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, functionImport.name);
+        if (!reference && !linked) {
+            fputc(')', file);
+        }
+    } else {
+        char suffix[functionNameSuffixMaxLength + 1];
+        if (reference) {
+            fputc('&', file);
+        }
+        wasmCWriteFileSymbolPrefix(file);
+        fputs(functionNamePrefix, file);
+        fprintf(file, "%u", functionIndex);
+        if (wasmCGetFunctionNameSuffix(module, functionIndex, suffix)) {
+            fputs(suffix, file);
+        }
+    }
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringFunctionName(
+    StringBuilder* builder,
+    const WasmModule* module,
+    U32 functionIndex,
+    bool reference
+) {
+    if (functionIndex < module->functionImports.length) {
+        WasmFunctionImport functionImport = module->functionImports.imports[functionIndex];
+        bool linked = wasmCIsLinkedModule(functionImport.module);
+        if (!reference && !linked) {
+            MUST (stringBuilderAppend(builder, "(*"))
+        }
+        if (!linked) {
+            MUST (wasmCWriteStringSymbolPrefix(builder))
+        }
+        MUST (stringBuilderAppend(builder, functionNamePrefix))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, functionImport.module))
+        MUST (stringBuilderAppendChar(builder, '_'))
+        MUST (wasmCWriteStringEscaped(builder, functionImport.name))
+        if (!reference && !linked) {
+            MUST (stringBuilderAppendChar(builder, ')'))
+        }
+    } else {
+        char suffix[functionNameSuffixMaxLength + 1];
+        if (reference) {
+            MUST (stringBuilderAppendChar(builder, '&'))
+        }
+        MUST (wasmCWriteStringSymbolPrefix(builder))
+        MUST (stringBuilderAppend(builder, functionNamePrefix))
+        MUST (stringBuilderAppendI64(builder, (I64) functionIndex))
+        if (wasmCGetFunctionNameSuffix(module, functionIndex, suffix)) {
+            MUST (stringBuilderAppend(builder, suffix))
+        }
+    }
+    return true;
+}
+
+static
+__inline__
+void
+wasmCWriteFileStackName(
+    FILE* file,
+    const U32 stackIndex,
+    const WasmValueType valueType
+) {
+    fprintf(
+        file,
+        "%s%s%u",
+        stackNamePrefix,
+        valueTypeStackNames[valueType],
+        stackIndex
+    );
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringStackName(
+    StringBuilder* builder,
+    const U32 stackIndex,
+    const WasmValueType localType
+) {
+    MUST (stringBuilderAppend(builder, stackNamePrefix))
+    MUST (stringBuilderAppend(builder, valueTypeStackNames[localType]))
+    MUST (stringBuilderAppendI64(builder, (I64) stackIndex))
+    return true;
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringLocalName(
+    StringBuilder* builder,
+    const U32 localIndex
+) {
+    MUST (stringBuilderAppend(builder, localNamePrefix))
+    MUST (stringBuilderAppendI64(builder, localIndex))
+    return true;
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringLabelName(
+    StringBuilder* builder,
+    const U32 labelIndex
+) {
+    MUST (stringBuilderAppend(builder, labelNamePrefix))
+    MUST (stringBuilderAppendI64(builder, (I64) labelIndex))
+    return true;
+}
+
+static
+__inline__
+const char*
+wasmCGetReturnType(
+    const WasmFunctionType functionType
+) {
+    switch (functionType.resultCount) {
+        case 0:
+            return "void";
+        case 1: {
+            const WasmValueType resultType = functionType.resultTypes[0];
+            return valueTypeNames[resultType];
+        }
+        default:
+            /* TODO: add support for multiple result values */
+            fprintf(stderr, "w2c2: unsupported function with multiple result values\n");
+            abort();
+    }
+}
+
+static
+void
+wasmCWriteFileFunctionSignature(
+    FILE* file,
+    const WasmModule* module,
+    const WasmFunction function,
+    const U32 functionIndex,
+    bool writeParameterNames,
+    bool pretty
+) {
+    const WasmFunctionType functionType =
+        module->functionTypes.functionTypes[function.functionTypeIndex];
+
+    fputs(wasmCGetReturnType(functionType), file);
+    fputc(' ', file);
+    wasmCWriteFileFunctionName(file, module, functionIndex, false);
+    fputc('(', file);
+    {
+        U32 parameterIndex = 0;
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+            const char* parameterTypeName = valueTypeNames[parameterType];
+            if (parameterIndex > 0) {
+                if (pretty) {
+                    fputs(", ", file);
+                } else {
+                    fputc(',', file);
+                }
+            }
+            fputs(parameterTypeName, file);
+            if (writeParameterNames) {
+                fputc(' ', file);
+                wasmCWriteFileLocalName(file, parameterIndex);
+            }
+        }
+    }
+    fputc(')', file);
+}
+
+static
+void
+wasmCWriteFileLocalsDeclarations(
+    FILE* file,
+    const WasmModule* module,
+    const WasmFunction function,
+    bool pretty
+) {
+    const WasmFunctionType functionType = module->functionTypes.functionTypes[function.functionTypeIndex];
+    const U32 parameterCount = functionType.parameterCount;
+    const U32 localsDeclarationCount = function.localsDeclarations.declarationCount;
+
+    U32 localIndex = 0;
+    U32 localsDeclarationIndex = 0;
+    for (; localsDeclarationIndex < localsDeclarationCount; localsDeclarationIndex++) {
+        const WasmLocalsDeclaration localsDeclaration =
+            function.localsDeclarations.declarations[localsDeclarationIndex];
+
+        const U32 endIndex = localIndex + localsDeclaration.count;
+        for (; localIndex < endIndex; localIndex++) {
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs(valueTypeNames[localsDeclaration.type], file);
+            fputc(' ', file);
+            wasmCWriteFileLocalName(file, parameterCount + localIndex);
+            fputs(pretty ? " = 0;\n" : "=0;\n", file);
+        }
+    }
+}
+
+typedef struct WasmCFunctionWriter {
+    StringBuilder* builder;
+    WasmTypeStack* typeStack;
+    WasmTypeStack* stackDeclarations;
+    WasmLabelStack* labelStack;
+    const WasmModule* module;
+    WasmFunction function;
+    Buffer* code;
+    U32 indent;
+    bool ignore;
+    bool pretty;
+    /* Whether the function calls another function of the module */
+    bool calls;
+    /* Whether the function contains a loop, and how many loops enclose the current instruction */
+    bool loops;
+    U32 loopDepth;
+    /* If set, functions called inside a loop are marked in it, see wasmCFindHotLoops */
+    bool* hotCallees;
+    /* Whether the module throws exceptions, so calls are followed by a check */
+    bool exceptions;
+    /* Whether the function makes tail calls, and if set, the types of tail called functions are marked in it */
+    bool tailCalls;
+    bool* tailCallTypes;
+    /* Source position of the next line of code, see wasmCWriteLineDirective */
+    U32 lineFileIndex;
+    U32 line;
+    size_t lineScanned;
+} WasmCFunctionWriter;
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteIndent(
+    WasmCFunctionWriter* writer
+) {
+    if (!writer->pretty) {
+        return true;
+    } else {
+        StringBuilder* builder = writer->builder;
+        U32 indent = writer->indent;
+        U32 index = 0;
+        for (; index <= indent; index++) {
+            MUST (stringBuilderAppend(builder, indentation))
+        }
+        return true;
+    }
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWrite(
+    WasmCFunctionWriter* writer,
+    const char* string
+) {
+    return stringBuilderAppend(writer->builder, string);
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteAssign(
+    WasmCFunctionWriter* writer
+) {
+    return wasmCWrite(
+        writer,
+        writer->pretty ? " = " : "="
+    );
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWriteComma(
+    WasmCFunctionWriter* writer
+) {
+    return wasmCWrite(
+        writer,
+        writer->pretty ? ", " : ","
+    );
+}
+
+static
+__inline__
+bool
+WARN_UNUSED_RESULT
+wasmCWritePlus(
+    WasmCFunctionWriter* writer
+) {
+    return wasmCWrite(
+        writer,
+        writer->pretty ? " + " : "+"
+    );
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionCode(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+);
+
+__inline__
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringTailCallName(
+    StringBuilder* builder,
+    U32 functionTypeIndex
+) {
+    MUST (wasmCWriteStringSymbolPrefix(builder))
+    MUST (stringBuilderAppend(builder, tailCallNamePrefix))
+    MUST (stringBuilderAppendI64(builder, (I64) functionTypeIndex))
+    return true;
+}
+
+__inline__
+static
+void
+wasmCWriteFileTailCallName(
+    FILE* file,
+    U32 functionTypeIndex
+) {
+    wasmCWriteFileSymbolPrefix(file);
+    fputs(tailCallNamePrefix, file);
+    fprintf(file, "%u", functionTypeIndex);
+}
+
+__inline__
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringTailCallArgumentName(
+    StringBuilder* builder,
+    U32 functionTypeIndex,
+    U32 parameterIndex
+) {
+    MUST (wasmCWriteStringTailCallName(builder, functionTypeIndex))
+    MUST (stringBuilderAppendChar(builder, '_'))
+    MUST (stringBuilderAppend(builder, localNamePrefix))
+    MUST (stringBuilderAppendI64(builder, (I64) parameterIndex))
+    return true;
+}
+
+__inline__
+static
+void
+wasmCWriteFileTailCallArgumentName(
+    FILE* file,
+    U32 functionTypeIndex,
+    U32 parameterIndex
+) {
+    wasmCWriteFileTailCallName(file, functionTypeIndex);
+    fputc('_', file);
+    wasmCWriteFileLocalName(file, parameterIndex);
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteParameters(
+    WasmCFunctionWriter* writer,
+    WasmFunctionType functionType
+);
+
+/*
+ * Writes the function called by a call instruction: the function at calleeIndex, or for an
+ * indirect call, the element of the table at calleeIndex indexed by the top of the stack
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteCallee(
+    WasmCFunctionWriter* writer,
+    WasmFunctionType functionType,
+    U32 calleeIndex,
+    bool indirect
+) {
+    if (!indirect) {
+        return wasmCWriteStringFunctionName(writer->builder, writer->module, calleeIndex, false);
+    }
+
+    MUST (wasmCWrite(writer, "TF("))
+    MUST (wasmCWriteStringTableName(writer->builder, writer->module, calleeIndex, false))
+    MUST (wasmCWriteComma(writer))
+    {
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+    }
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWrite(writer, wasmCGetReturnType(functionType)))
+    MUST (wasmCWrite(writer, " (*)"))
+    MUST (wasmCWriteParameters(writer, functionType))
+    MUST (wasmCWrite(writer, ")"))
+
+    return true;
+}
+
+/*
+ * Writes a tail call (return_call, return_call_indirect) of a function of the type
+ * at functionTypeIndex, see wasmCWriteCallee.
+ * A call of a function with the same type as the calling function is guaranteed by
+ * the compiler (MUSTTAIL) if it can. Otherwise the calling function stores the arguments,
+ * leaves the call pending in wasmTailCall and returns, and its caller makes the call
+ * (WASM_TAIL_CALLS), so chains of tail calls run in constant stack space either way
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteTailCall(
+    WasmCFunctionWriter* writer,
+    U32 functionTypeIndex,
+    U32 calleeIndex,
+    bool indirect
+) {
+    const WasmFunctionType callerType =
+        writer->module->functionTypes.functionTypes[writer->function.functionTypeIndex];
+    const WasmFunctionType functionType =
+        writer->module->functionTypes.functionTypes[functionTypeIndex];
+    const bool guaranteed = wasmFunctionTypesEqual(callerType, functionType);
+    /* The arguments of an indirect call are below the table index */
+    const U32 argumentsOffset = indirect ? 1 : 0;
+    U32 parameterIndex = 0;
+
+    writer->tailCalls = true;
+    if (writer->tailCallTypes != NULL) {
+        writer->tailCallTypes[functionTypeIndex] = true;
+    }
+
+    if (guaranteed) {
+        MUST (wasmCWrite(writer, "#if WASM_MUSTTAIL\n"))
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "MUSTTAIL return "))
+        MUST (wasmCWriteCallee(writer, functionType, calleeIndex, indirect))
+        MUST (wasmCWrite(writer, "("))
+        for (parameterIndex = 0; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            const U32 stackIndex = wasmTypeStackGetTopIndex(
+                writer->typeStack,
+                functionType.parameterCount - parameterIndex - 1 + argumentsOffset
+            );
+            if (parameterIndex > 0) {
+                MUST (wasmCWriteComma(writer))
+            }
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex, functionType.parameterTypes[parameterIndex]))
+        }
+        MUST (wasmCWrite(writer, ");\n#else\n"))
+    }
+
+    for (parameterIndex = 0; parameterIndex < functionType.parameterCount; parameterIndex++) {
+        const U32 stackIndex = wasmTypeStackGetTopIndex(
+            writer->typeStack,
+            functionType.parameterCount - parameterIndex - 1 + argumentsOffset
+        );
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringTailCallArgumentName(writer->builder, functionTypeIndex, parameterIndex))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex, functionType.parameterTypes[parameterIndex]))
+        MUST (wasmCWrite(writer, ";\n"))
+    }
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "wasmTailCallee = (void (*)(void)) "))
+    MUST (wasmCWriteCallee(writer, functionType, calleeIndex, indirect))
+    MUST (wasmCWrite(writer, ";\n"))
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "wasmTailCall = (void (*)(void)) "))
+    MUST (wasmCWriteStringTailCallName(writer->builder, functionTypeIndex))
+    MUST (wasmCWrite(writer, ";\n"))
+    MUST (wasmCWriteIndent(writer))
+    if (callerType.resultCount > 0) {
+        MUST (wasmCWrite(writer, "return 0;\n"))
+    } else {
+        MUST (wasmCWrite(writer, "return;\n"))
+    }
+
+    if (guaranteed) {
+        MUST (wasmCWrite(writer, "#endif\n"))
+    }
+
+    wasmTypeStackDrop(writer->typeStack, functionType.parameterCount + argumentsOffset);
+    {
+        U32 resultIndex = 0;
+        for (; resultIndex < functionType.resultCount; resultIndex++) {
+            MUST (wasmTypeStackPush(writer->typeStack, functionType.resultTypes[resultIndex]))
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Follows a call of a function which may leave a tail call pending
+ * with the loop that makes the pending calls
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteTailCallsLoop(
+    WasmCFunctionWriter* writer,
+    WasmFunctionType functionType,
+    U32 resultStackIndex
+) {
+    MUST (wasmCWriteIndent(writer))
+    if (functionType.resultCount > 0) {
+        const WasmValueType resultType = functionType.resultTypes[0];
+        MUST (wasmCWrite(writer, "WASM_TAIL_CALLS("))
+        MUST (wasmCWrite(writer, valueTypeNames[resultType]))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, resultStackIndex, resultType))
+        MUST (wasmCWrite(writer, ");\n"))
+    } else {
+        MUST (wasmCWrite(writer, "WASM_TAIL_CALLS_VOID();\n"))
+    }
+    return true;
+}
+
+static
+U32
+wasmCGetFunctionTypeIndex(
+    const WasmModule* module,
+    U32 functionIndex
+) {
+    U32 functionImportCount = module->functionImports.length;
+    if (functionIndex < functionImportCount) {
+        return module->functionImports.imports[functionIndex].functionTypeIndex;
+    }
+    return module->functions.functions[functionIndex - functionImportCount].functionTypeIndex;
+}
+
+/*
+ * Whether a call of the function may return with a tail call pending
+ */
+static
+bool
+wasmCMayLeaveTailCall(
+    const WasmModule* module,
+    U32 functionIndex
+) {
+    U32 functionImportCount = module->functionImports.length;
+    return tailCalls.callers != NULL
+        && functionIndex >= functionImportCount
+        && tailCalls.callers[functionIndex - functionImportCount];
+}
+
+/*
+ * Exported functions and the start function, if they may leave a tail call pending,
+ * are entered through a function which makes the pending calls
+ */
+static
+bool
+wasmCIsTailCallEntry(
+    const WasmModule* module,
+    U32 functionIndex
+) {
+    U32 exportIndex = 0;
+    if (!wasmCMayLeaveTailCall(module, functionIndex)) {
+        return false;
+    }
+    if (module->hasStartFunction && module->startFunctionIndex == functionIndex) {
+        return true;
+    }
+    for (; exportIndex < module->exports.count; exportIndex++) {
+        const WasmExport export = module->exports.exports[exportIndex];
+        if (export.kind == wasmExportKindFunction && export.index == functionIndex) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Writes the name of the function the host, linked modules and the initialization call
+ */
+static
+void
+wasmCWriteFileEntryName(
+    FILE* file,
+    const WasmModule* module,
+    U32 functionIndex,
+    bool reference
+) {
+    if (!wasmCIsTailCallEntry(module, functionIndex)) {
+        wasmCWriteFileFunctionName(file, module, functionIndex, reference);
+        return;
+    }
+    if (reference) {
+        fputc('&', file);
+    }
+    wasmCWriteFileSymbolPrefix(file);
+    fputs(tailCallNamePrefix, file);
+    fprintf(file, "Entry%u", functionIndex);
+}
+
+/*
+ * Writes the statement an exception takes from a point inside the label at
+ * labelStackIndex: a jump to the handler of the innermost try block it is in
+ * the body of, or a return to the caller, which checks for it in turn
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteUnwind(
+    WasmCFunctionWriter* writer,
+    size_t labelStackIndex
+) {
+    const WasmFunctionType functionType =
+        writer->module->functionTypes.functionTypes[writer->function.functionTypeIndex];
+
+    size_t index = labelStackIndex + 1;
+    while (index > 0) {
+        const WasmLabel label = writer->labelStack->labels[--index];
+        if (label.catches) {
+            MUST (wasmCWrite(writer, "goto "))
+            MUST (stringBuilderAppend(writer->builder, handlerNamePrefix))
+            MUST (stringBuilderAppendI64(writer->builder, (I64) label.index))
+            MUST (wasmCWrite(writer, ";\n"))
+            return true;
+        }
+    }
+
+    if (functionType.resultCount > 0) {
+        MUST (wasmCWrite(writer, "return 0;\n"))
+    } else {
+        MUST (wasmCWrite(writer, "return;\n"))
+    }
+    return true;
+}
+
+/* Follows a call which may throw with a check for a pending exception */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteExceptionCheck(
+    WasmCFunctionWriter* writer
+) {
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "if (UNLIKELY(wasmPendingException.tag != NULL)) "))
+    MUST (wasmCWriteUnwind(writer, writer->labelStack->length - 1))
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteCallExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const bool tail = opcode == wasmOpcodeReturnCall;
+    WasmCallInstruction instruction;
+    if (!wasmCallInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (instruction.funcIndex >= writer->module->functionImports.length) {
+        writer->calls = true;
+        if (writer->hotCallees != NULL && writer->loopDepth > 0) {
+            writer->hotCallees[instruction.funcIndex - writer->module->functionImports.length] = true;
+        }
+    }
+
+    if (tail) {
+        if (!writer->ignore) {
+            const U32 functionTypeIndex = wasmCGetFunctionTypeIndex(writer->module, instruction.funcIndex);
+            MUST (wasmCWriteTailCall(writer, functionTypeIndex, instruction.funcIndex, false))
+        }
+        return true;
+    }
+
+    if (!writer->ignore) {
+        WasmFunctionType functionType;
+        MUST (wasmModuleGetFunctionType(writer->module, instruction.funcIndex, &functionType))
+        {
+            const U32 parameterCount = functionType.parameterCount;
+            const U32 resultCount = functionType.resultCount;
+
+            U32 resultStackIndex = writer->typeStack->length;
+            if (parameterCount > 0) {
+                resultStackIndex -= parameterCount;
+            }
+
+            MUST (wasmCWriteIndent(writer))
+
+            if (resultCount > 0) {
+                /* TODO: add support for multiple result values */
+                const WasmValueType resultType = functionType.resultTypes[0];
+
+                MUST (wasmTypeStackSet(writer->stackDeclarations, resultStackIndex, resultType))
+                MUST (wasmCWriteStringStackName(writer->builder, resultStackIndex, resultType))
+                MUST (wasmCWriteAssign(writer))
+            }
+
+            MUST (wasmCWriteCallee(writer, functionType, instruction.funcIndex, false))
+
+            MUST (wasmCWrite(writer, "("))
+            {
+                U32 parameterIndex = 0;
+                for (; parameterIndex < parameterCount; parameterIndex++) {
+                    const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+                    U32 paramStackIndex = wasmTypeStackGetTopIndex(
+                        writer->typeStack,
+                        parameterCount - parameterIndex - 1
+                    );
+                    if (parameterIndex > 0) {
+                        MUST (wasmCWriteComma(writer))
+                    }
+                    MUST (wasmCWriteStringStackName(writer->builder, paramStackIndex, parameterType))
+                }
+            }
+            MUST (wasmCWrite(writer, ");\n"))
+
+            if (wasmCMayLeaveTailCall(writer->module, instruction.funcIndex)) {
+                MUST (wasmCWriteTailCallsLoop(writer, functionType, resultStackIndex))
+            }
+
+            /* Host functions don't throw, functions of the module and of linked modules may */
+            if (writer->exceptions && (
+                instruction.funcIndex >= writer->module->functionImports.length
+                || wasmCIsLinkedModule(writer->module->functionImports.imports[instruction.funcIndex].module)
+            )) {
+                MUST (wasmCWriteExceptionCheck(writer))
+            }
+
+            wasmTypeStackDrop(writer->typeStack, parameterCount);
+            {
+                U32 resultIndex = 0;
+                for (; resultIndex < resultCount; resultIndex++) {
+                    const WasmValueType resultType = functionType.resultTypes[resultIndex];
+                    MUST (wasmTypeStackPush(writer->typeStack, resultType))
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteParameters(
+    WasmCFunctionWriter* writer,
+    WasmFunctionType functionType
+) {
+    MUST (wasmCWrite(writer, "("))
+    {
+        U32 parameterIndex = 0;
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+            if (parameterIndex > 0) {
+                MUST (wasmCWriteComma(writer))
+            }
+            MUST (wasmCWrite(writer, valueTypeNames[parameterType]))
+        }
+    }
+    MUST (wasmCWrite(writer, ")"))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteCallIndirectExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const bool tail = opcode == wasmOpcodeReturnCallIndirect;
+    WasmCallIndirectInstruction instruction;
+    if (!wasmCallIndirectInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    writer->calls = true;
+
+    if (tail) {
+        if (!writer->ignore) {
+            MUST (wasmCWriteTailCall(writer, instruction.functionTypeIndex, instruction.tableIndex, true))
+        }
+        return true;
+    }
+
+    if (!writer->ignore) {
+        WasmFunctionType functionType = writer->module->functionTypes.functionTypes[instruction.functionTypeIndex];
+
+        const U32 parameterCount = functionType.parameterCount;
+        const U32 resultCount = functionType.resultCount;
+
+        U32 resultStackIndex = writer->typeStack->length - 1;
+        if (parameterCount > 0) {
+            resultStackIndex -= parameterCount;
+        }
+
+        MUST (wasmCWriteIndent(writer))
+
+        if (resultCount > 0) {
+            /* TODO: add support for multiple result values */
+            const WasmValueType resultType = functionType.resultTypes[0];
+
+            MUST (wasmTypeStackSet(writer->stackDeclarations, resultStackIndex, resultType))
+            MUST (wasmCWriteStringStackName(writer->builder, resultStackIndex, resultType))
+            MUST (wasmCWriteAssign(writer))
+        }
+
+        MUST (wasmCWriteCallee(writer, functionType, instruction.tableIndex, true))
+        MUST (wasmCWrite(writer, "("))
+
+        {
+            U32 parameterIndex = 0;
+            for (; parameterIndex < parameterCount; parameterIndex++) {
+                const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+                U32 paramStackIndex = wasmTypeStackGetTopIndex(
+                    writer->typeStack,
+                    parameterCount - parameterIndex
+                );
+                if (parameterIndex > 0) {
+                    MUST (wasmCWriteComma(writer))
+                }
+                MUST (wasmCWriteStringStackName(writer->builder, paramStackIndex, parameterType))
+            }
+        }
+        MUST (wasmCWrite(writer, ");\n"))
+
+        /* Any function in the table may leave a tail call pending */
+        if (tailCalls.any) {
+            MUST (wasmCWriteTailCallsLoop(writer, functionType, resultStackIndex))
+        }
+
+        if (writer->exceptions) {
+            MUST (wasmCWriteExceptionCheck(writer))
+        }
+
+        wasmTypeStackDrop(writer->typeStack, parameterCount + 1);
+        {
+            U32 resultIndex = 0;
+            for (; resultIndex < resultCount; resultIndex++) {
+                const WasmValueType resultType = functionType.resultTypes[resultIndex];
+                MUST (wasmTypeStackPush(writer->typeStack, resultType))
+            }
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLocalGetExpr(
+    WasmCFunctionWriter* writer
+) {
+    static const WasmOpcode opcode = wasmOpcodeLocalGet;
+    WasmLocalInstruction instruction;
+    if (!wasmLocalInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+        WasmValueType localType = 0;
+        bool gotType = wasmModuleFunctionGetLocalType(
+            writer->module,
+            writer->function,
+            instruction.localIndex,
+            &localType
+        );
+        if (!gotType) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction: invalid local index: %u\n",
+                wasmOpcodeDescription(opcode),
+                instruction.localIndex
+            );
+            return false;
+        }
+        MUST (wasmTypeStackPush(writer->typeStack, localType))
+        {
+            U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, localType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, localType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStringLocalName(writer->builder, instruction.localIndex))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLocalAssignmentExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmLocalInstruction instruction;
+    if (!wasmLocalInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+        WasmValueType localType = 0;
+        bool gotType = wasmModuleFunctionGetLocalType(
+            writer->module,
+            writer->function,
+            instruction.localIndex,
+            &localType
+        );
+        if (!gotType) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction: invalid local index: %u\n",
+                wasmOpcodeDescription(opcode),
+                instruction.localIndex
+            );
+            return false;
+        }
+        {
+            U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, localType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringLocalName(writer->builder, instruction.localIndex))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, localType))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+        if (opcode == wasmOpcodeLocalSet) {
+            wasmTypeStackDrop(writer->typeStack, 1);
+        }
+    }
+
+    return true;
+}
+
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteGlobalGetExpr(
+    WasmCFunctionWriter* writer
+) {
+    static const WasmOpcode opcode = wasmOpcodeGlobalGet;
+    WasmGlobalInstruction instruction;
+    if (!wasmGlobalInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+        WasmValueType globalType = 0;
+        bool gotType = wasmModuleGetGlobalType(
+            writer->module,
+            instruction.globalIndex,
+            &globalType
+        );
+        if (!gotType) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction: invalid global index: %u\n",
+                wasmOpcodeDescription(opcode),
+                instruction.globalIndex
+            );
+            return false;
+        }
+        MUST (wasmTypeStackPush(writer->typeStack, globalType))
+        {
+            U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, globalType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, globalType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStringGlobalName(writer->builder, writer->module, instruction.globalIndex, false))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteGlobalSetExpr(
+    WasmCFunctionWriter* writer
+) {
+    static const WasmOpcode opcode = wasmOpcodeGlobalSet;
+    WasmGlobalInstruction instruction;
+    if (!wasmGlobalInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+        WasmValueType globalType = 0;
+        bool gotType = wasmModuleGetGlobalType(
+            writer->module,
+            instruction.globalIndex,
+            &globalType
+        );
+        if (!gotType) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction: invalid global index: %u\n",
+                wasmOpcodeDescription(opcode),
+                instruction.globalIndex
+            );
+            return false;
+        }
+        {
+            U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, globalType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringGlobalName(writer->builder, writer->module, instruction.globalIndex, false))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, globalType))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+        wasmTypeStackDrop(writer->typeStack, 1);
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLiteral(
+    StringBuilder* builder,
+    WasmValueType valueType,
+    WasmValue value
+) {
+    switch (valueType) {
+        case wasmValueTypeI32: {
+            MUST (stringBuilderAppendI64(builder, value.i32))
+            MUST (stringBuilderAppend(builder, "u"))
+            break;
+        }
+        case wasmValueTypeI64: {
+            MUST (stringBuilderAppendI64(builder, value.i64))
+            MUST (stringBuilderAppend(builder, "ull"))
+            break;
+        }
+        case wasmValueTypeF32: {
+            U32 bits = (U32) value.i32;
+            if ((bits & 0x7f800000u) == 0x7f800000u) {
+                const char* sign = (bits & 0x80000000) ? "-" : "";
+                U32 significand = bits & 0x7fffffu;
+                if (significand == 0) {
+                    MUST (stringBuilderAppend(builder, sign))
+                    MUST (stringBuilderAppend(builder, "INFINITY"))
+                } else {
+                    MUST (stringBuilderAppend(builder, "f32_reinterpret_i32(0x"))
+                    MUST (stringBuilderAppendU32Hex(builder, bits))
+                    MUST (stringBuilderAppend(builder, ")"))
+                }
+            } else if (bits == 0x80000000) {
+                MUST (stringBuilderAppend(builder, "-0.f"))
+            } else {
+                MUST (stringBuilderAppendF32(builder, value.f32))
+            }
+            break;
+        }
+        case wasmValueTypeF64: {
+            U64 bits = (U64) value.i64;
+            if ((bits & 0x7ff0000000000000ull) == 0x7ff0000000000000ull) {
+                const char* sign = (bits & 0x8000000000000000ull) ? "-" : "";
+                U64 significand = bits & 0xfffffffffffffull;
+                if (significand == 0) {
+                    MUST (stringBuilderAppend(builder, sign))
+                    MUST (stringBuilderAppend(builder, "INFINITY"))
+                } else {
+                    MUST (stringBuilderAppend(builder, "f64_reinterpret_i64(0x"))
+                    MUST (stringBuilderAppendU64Hex(builder, bits))
+                    MUST (stringBuilderAppend(builder, ")"))
+                }
+            } else if (bits == 0x8000000000000000ull) {
+                MUST (stringBuilderAppend(builder, "-0.f"))
+            } else {
+                MUST (stringBuilderAppendF64(builder, value.f64))
+            }
+            break;
+        }
+        default:
+            fprintf(stderr, "w2c2: unsupported const type %s\n", wasmValueTypeDescription(valueType));
+            return false;
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteConstExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmConstInstruction instruction;
+    if (!wasmConstInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(stderr, "w2c2: invalid const instruction\n");
+        return false;
+    }
+
+    if (!writer->ignore) {
+        const WasmValueType resultType = wasmOpcodeResultType(opcode);
+        MUST (wasmTypeStackPush(writer->typeStack, resultType))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteLiteral(writer->builder, resultType, instruction.value))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Whether the module's memory is a 64-bit memory (memory64 proposal)
+ */
+static
+bool
+wasmCIsMemory64(
+    const WasmModule* module
+) {
+    if (module->memoryImports.length > 0) {
+        return module->memoryImports.imports[0].memory64;
+    }
+    return module->memories.count > 0 && module->memories.memories[0].memory64;
+}
+
+/*
+ * Writes the effective address of a load or store. In a 64-bit memory,
+ * adding the offset may overflow, which wasmAddress64 checks
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteAddress(
+    WasmCFunctionWriter* writer,
+    const U32 stackIndex,
+    const U64 offset
+) {
+    const bool memory64 = wasmCIsMemory64(writer->module);
+
+    if (memory64 && offset != 0) {
+        MUST (wasmCWrite(writer, "wasmAddress64("))
+    }
+    MUST (wasmCWrite(writer, "(U64)("))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex,
+        writer->typeStack->valueTypes[stackIndex]
+    ))
+    MUST (wasmCWrite(writer, ")"))
+    if (offset != 0) {
+        if (memory64) {
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWrite(writer, "0x"))
+            MUST (stringBuilderAppendU64Hex(writer->builder, offset))
+            MUST (wasmCWrite(writer, "ull)"))
+        } else {
+            MUST (wasmCWritePlus(writer))
+            MUST (stringBuilderAppendI64(writer->builder, (I64) offset))
+            MUST (wasmCWrite(writer, "u"))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLoadExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmLoadStoreInstruction instruction;
+    if (!wasmLoadStoreInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(stderr, "w2c2: invalid load instruction\n");
+        return false;
+    }
+
+    if (!writer->ignore) {
+
+        const char* functionName = NULL;
+        switch (opcode) {
+            case wasmOpcodeI32Load: {
+                functionName = "i32_load";
+                break;
+            }
+            case wasmOpcodeI64Load: {
+                functionName = "i64_load";
+                break;
+            }
+            case wasmOpcodeF32Load: {
+                functionName = "f32_load";
+                break;
+            }
+            case wasmOpcodeF64Load: {
+                functionName = "f64_load";
+                break;
+            }
+            case wasmOpcodeI32Load8S: {
+                functionName = "i32_load8_s";
+                break;
+            }
+            case wasmOpcodeI64Load8S: {
+                functionName = "i64_load8_s";
+                break;
+            }
+            case wasmOpcodeI32Load8U: {
+                functionName = "i32_load8_u";
+                break;
+            }
+            case wasmOpcodeI64Load8U: {
+                functionName = "i64_load8_u";
+                break;
+            }
+            case wasmOpcodeI32Load16S: {
+                functionName = "i32_load16_s";
+                break;
+            }
+            case wasmOpcodeI64Load16S: {
+                functionName = "i64_load16_s";
+                break;
+            }
+            case wasmOpcodeI32Load16U: {
+                functionName = "i32_load16_u";
+                break;
+            }
+            case wasmOpcodeI64Load16U: {
+                functionName = "i64_load16_u";
+                break;
+            }
+            case wasmOpcodeI64Load32S: {
+                functionName = "i64_load32_s";
+                break;
+            }
+            case wasmOpcodeI64Load32U: {
+                functionName = "i64_load32_u";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported load instruction opcode: %s\n",
+                    wasmOpcodeDescription(opcode)
+                );
+                return false;
+            }
+        }
+
+        {
+            const WasmValueType resultType = wasmOpcodeResultType(opcode);
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWrite(writer, functionName))
+            MUST (wasmCWrite(writer, "("))
+            MUST (wasmCWriteStringMemoryName(writer->builder, writer->module, 0, true))
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteAddress(writer, stackIndex0, instruction.offset))
+            MUST (wasmCWrite(writer, ");\n"))
+
+            wasmTypeStackDrop(writer->typeStack, 1);
+
+            MUST (wasmTypeStackPush(writer->typeStack, resultType))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStoreExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmLoadStoreInstruction instruction;
+    if (!wasmLoadStoreInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(stderr, "w2c2: invalid store instruction\n");
+        return false;
+    }
+
+    if (!writer->ignore) {
+
+        const char* functionName = NULL;
+        switch (opcode) {
+            case wasmOpcodeI32Store: {
+                functionName = "i32_store";
+                break;
+            }
+            case wasmOpcodeI64Store: {
+                functionName = "i64_store";
+                break;
+            }
+            case wasmOpcodeF32Store: {
+                functionName = "f32_store";
+                break;
+            }
+            case wasmOpcodeF64Store: {
+                functionName = "f64_store";
+                break;
+            }
+            case wasmOpcodeI32Store8: {
+                functionName = "i32_store8";
+                break;
+            }
+            case wasmOpcodeI64Store8: {
+                functionName = "i64_store8";
+                break;
+            }
+            case wasmOpcodeI32Store16: {
+                functionName = "i32_store16";
+                break;
+            }
+            case wasmOpcodeI64Store16: {
+                functionName = "i64_store16";
+                break;
+            }
+            case wasmOpcodeI64Store32: {
+                functionName = "i64_store32";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported store instruction opcode: %s\n",
+                    wasmOpcodeDescription(opcode)
+                );
+                return false;
+            }
+        }
+
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, functionName))
+            MUST (wasmCWrite(writer, "("))
+            MUST (wasmCWriteStringMemoryName(writer->builder, writer->module, 0, true))
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteAddress(writer, stackIndex1, instruction.offset))
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+            ))
+            MUST (wasmCWrite(writer, ");\n"))
+
+            wasmTypeStackDrop(writer->typeStack, 2);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * A memory defined by the module with equal initial and maximum page counts
+ * never changes its size, so its size can be emitted as a constant
+ */
+static
+bool
+wasmCGetFixedMemoryPages(
+    const WasmModule* module,
+    U32* pages
+) {
+    if (module->memoryImports.length > 0 || module->memories.count == 0) {
+        return false;
+    }
+
+    {
+        WasmMemory memory = module->memories.memories[0];
+        if (memory.min != memory.max) {
+            return false;
+        }
+        *pages = memory.min;
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemorySize(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmMemoryInstruction instruction;
+    if (!wasmMemoryInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(stderr, "w2c2: invalid memory instruction\n");
+        return false;
+    }
+
+    {
+        static const U32 expectedMemoryIndex = 0;
+        if (instruction.memoryIndex != expectedMemoryIndex) {
+            fprintf(
+                stderr,
+                "w2c2: invalid memory instruction: expected memory index %u, got %u\n",
+                expectedMemoryIndex,
+                instruction.memoryIndex
+            );
+            return false;
+        }
+    }
+
+    if (!writer->ignore) {
+        const WasmValueType resultType = wasmCIsMemory64(writer->module) ? wasmValueTypeI64 : wasmValueTypeI32;
+        U32 fixedMemoryPages = 0;
+
+        MUST (wasmTypeStackPush(writer->typeStack, resultType))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
+            MUST (wasmCWriteAssign(writer))
+            if (wasmCGetFixedMemoryPages(writer->module, &fixedMemoryPages)) {
+                MUST (stringBuilderAppendI64(writer->builder, (I64) fixedMemoryPages))
+                MUST (wasmCWrite(writer, "u;\n"))
+            } else {
+                MUST (wasmCWriteStringMemoryName(writer->builder, writer->module, 0, false))
+                MUST (wasmCWrite(writer, ".pages;\n"))
+            }
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemoryGrow(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmMemoryInstruction instruction;
+    if (!wasmMemoryInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(stderr, "w2c2: invalid memory instruction\n");
+        return false;
+    }
+
+    {
+        static const U32 expectedMemoryIndex = 0;
+        if (instruction.memoryIndex != expectedMemoryIndex) {
+            fprintf(
+                stderr,
+                "w2c2: invalid memory instruction: expected memory index %u, got %u\n",
+                expectedMemoryIndex,
+                instruction.memoryIndex
+            );
+            return false;
+        }
+    }
+
+    if (!writer->ignore) {
+        const bool memory64 = wasmCIsMemory64(writer->module);
+        const WasmValueType resultType = memory64 ? wasmValueTypeI64 : wasmValueTypeI32;
+        U32 fixedMemoryPages = 0;
+
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
+            MUST (wasmCWriteAssign(writer))
+            if (wasmCGetFixedMemoryPages(writer->module, &fixedMemoryPages)) {
+                /* Growing by zero pages succeeds, any other growth fails */
+                MUST (wasmCWriteStringStackName(
+                    writer->builder,
+                    stackIndex0,
+                    writer->typeStack->valueTypes[stackIndex0]
+                ))
+                MUST (wasmCWrite(writer, " == 0 ? "))
+                MUST (stringBuilderAppendI64(writer->builder, (I64) fixedMemoryPages))
+                MUST (wasmCWrite(writer, memory64 ? "u : 0xFFFFFFFFFFFFFFFFull;\n" : "u : 0xFFFFFFFFu;\n"))
+            } else {
+                MUST (wasmCWrite(writer, memory64 ? "wasmGrowMemory64(" : "wasmGrowMemory("))
+                MUST (wasmCWriteStringMemoryName(writer->builder, writer->module, 0, true))
+                MUST (wasmCWriteComma(writer))
+                MUST (wasmCWriteStringStackName(
+                    writer->builder,
+                    stackIndex0,
+                    writer->typeStack->valueTypes[stackIndex0]
+                ))
+                MUST (wasmCWrite(writer, ");\n"))
+            }
+        }
+    }
+
+    return true;
+}
+
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteUnaryExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode,
+    const char* operator
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
+    MUST (wasmCWriteAssign(writer))
+    MUST (wasmCWrite(writer, operator))
+    MUST (wasmCWrite(writer, "("))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, ");\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 1);
+    MUST (wasmTypeStackPush(writer->typeStack, resultType))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInfixBinaryExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode,
+    const char* operator,
+    bool assignmentAllowed
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
+
+    if (assignmentAllowed) {
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, " "))
+        }
+        MUST (wasmCWrite(writer, operator))
+        MUST (wasmCWrite(writer, "="))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, " "))
+        }
+    } else {
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex1,
+            writer->typeStack->valueTypes[stackIndex1]
+        ))
+        MUST (wasmCWrite(writer, " "))
+        MUST (wasmCWrite(writer, operator))
+        MUST (wasmCWrite(writer, " "))
+    }
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, ";\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 2);
+
+    MUST (wasmTypeStackPush(writer->typeStack, resultType))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSignedInfixBinaryExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode,
+    const char* operator
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+    const WasmValueType parameter1Type = wasmOpcodeParameter1Type(opcode);
+
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
+    MUST (wasmCWrite(writer, " = ("))
+    MUST (wasmCWrite(writer, valueTypeNames[parameter1Type]))
+    MUST (wasmCWrite(writer, ")(("))
+    MUST (wasmCWrite(writer, signedTypeNames[parameter1Type]))
+    MUST (wasmCWrite(writer, ")"))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWrite(writer, " "))
+    MUST (wasmCWrite(writer, operator))
+    MUST (wasmCWrite(writer, " ("))
+    MUST (wasmCWrite(writer, signedTypeNames[parameter1Type]))
+    MUST (wasmCWrite(writer, ")"))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, ");\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 2);
+    MUST (wasmTypeStackPush(writer->typeStack, resultType))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWritePrefixBinaryExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode,
+    const char* operator
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
+    MUST (wasmCWriteAssign(writer))
+    MUST (wasmCWrite(writer, operator))
+    MUST (wasmCWrite(writer, "("))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, ");\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 2);
+    MUST (wasmTypeStackPush(writer->typeStack, resultType))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSignedShiftRightExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmTypeStackSet(
+        writer->stackDeclarations,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWrite(writer, " = ("))
+    MUST (wasmCWrite(writer, valueTypeNames[resultType]))
+    MUST (wasmCWrite(writer, ")(("))
+    MUST (wasmCWrite(writer, signedTypeNames[resultType]))
+    MUST (wasmCWrite(writer, ")"))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWrite(writer, " >> ("))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, " & "))
+    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
+    MUST (wasmCWrite(writer, "));\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 1);
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteUnsignedShiftRightExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmTypeStackSet(
+        writer->stackDeclarations,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWrite(writer, " >>= ("))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, " & "))
+    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
+    MUST (wasmCWrite(writer, ");\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 1);
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteShiftLeftExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmTypeStackSet(
+        writer->stackDeclarations,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWrite(writer, " <<= ("))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, " & "))
+    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
+    MUST (wasmCWrite(writer, ");\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 1);
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLabel(
+    WasmCFunctionWriter* writer,
+    U32 labelIndex
+) {
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringLabelName(writer->builder, labelIndex))
+    MUST (wasmCWrite(writer, ":;\n"))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteIfExpr(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+) {
+    bool ignore = writer->ignore;
+
+    size_t typeStackLengthBeforeBranches = 0;
+    WasmLabel label = wasmEmptyLabel;
+
+    WasmValueType blockValueType;
+    WasmValueType* blockType = &blockValueType;
+    if (!wasmReadBlockType(writer->code, &blockType)) {
+        fprintf(stderr, "w2c2: invalid if instruction: expected block type\n");
+        return false;
+    }
+
+    if (!ignore) {
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "if ("))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+            ))
+        }
+        MUST (wasmCWrite(writer, ") {\n"))
+
+        wasmTypeStackDrop(writer->typeStack, 1);
+
+        typeStackLengthBeforeBranches = writer->typeStack->length;
+
+        MUST (wasmLabelStackPush(
+            writer->labelStack,
+            typeStackLengthBeforeBranches,
+            blockType,
+            &label
+        ))
+
+        writer->indent++;
+    }
+
+    MUST (wasmCWriteFunctionCode(writer, opcode))
+
+    if (!ignore) {
+        writer->ignore = false;
+
+        writer->indent--;
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "}"))
+    }
+
+    if (*opcode == wasmOpcodeElse) {
+        if (!ignore) {
+            writer->typeStack->length = typeStackLengthBeforeBranches;
+
+            MUST (wasmCWrite(writer, " else {\n"))
+
+            writer->indent++;
+        }
+
+        MUST (wasmCWriteFunctionCode(writer, opcode))
+
+        if (!ignore) {
+            writer->ignore = false;
+
+            writer->indent--;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "}"))
+        }
+    }
+
+    if (!ignore) {
+        MUST (wasmCWrite(writer, "\n"))
+
+        MUST (wasmCWriteLabel(writer, label.index))
+
+        writer->typeStack->length = typeStackLengthBeforeBranches;
+
+        wasmLabelStackPop(writer->labelStack);
+
+        if (blockType != NULL) {
+            MUST (wasmTypeStackPush(writer->typeStack, blockValueType))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBlockExpr(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+) {
+    bool ignore = writer->ignore;
+
+    size_t typeStackLengthBeforeBranches = 0;
+    WasmLabel label = wasmEmptyLabel;
+
+    WasmValueType blockValueType;
+    WasmValueType* blockType = &blockValueType;
+    if (!wasmReadBlockType(writer->code, &blockType)) {
+        fprintf(stderr, "w2c2: invalid block instruction: expected block type\n");
+        return false;
+    }
+
+    if (!ignore) {
+        typeStackLengthBeforeBranches = writer->typeStack->length;
+
+        MUST (wasmLabelStackPush(
+            writer->labelStack,
+            typeStackLengthBeforeBranches,
+            blockType,
+            &label
+        ))
+
+        if (writer->pretty) {
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "{\n"))
+            writer->indent++;
+        }
+    }
+
+    MUST (wasmCWriteFunctionCode(writer, opcode))
+
+    if (!ignore) {
+        writer->ignore = false;
+
+        if (writer->pretty) {
+            writer->indent--;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "}\n"))
+        }
+
+        MUST (wasmCWriteLabel(writer, label.index))
+
+        writer->typeStack->length = typeStackLengthBeforeBranches;
+
+        wasmLabelStackPop(writer->labelStack);
+
+        if (blockType != NULL) {
+            MUST (wasmTypeStackPush(writer->typeStack, blockValueType))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLoopExpr(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+) {
+    bool ignore = writer->ignore;
+
+    size_t typeStackLengthBeforeBranches = 0;
+    WasmLabel label = wasmEmptyLabel;
+
+    WasmValueType blockValueType;
+    WasmValueType* blockType = &blockValueType;
+    if (!wasmReadBlockType(writer->code, &blockType)) {
+        fprintf(stderr, "w2c2: invalid loop instruction: expected block type\n");
+        return false;
+    }
+
+    if (!ignore) {
+        typeStackLengthBeforeBranches = writer->typeStack->length;
+
+        MUST (wasmLabelStackPush(
+            writer->labelStack,
+            typeStackLengthBeforeBranches,
+            /* NOTE: ignoring block type (result type) */
+            NULL,
+            &label
+        ))
+
+        MUST (wasmCWriteLabel(writer, label.index))
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "{\n"))
+
+        writer->indent++;
+
+        /* Every backward branch targets the loop header */
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "WASM_INTERRUPT_CHECK();\n"))
+    }
+
+    MUST (wasmCWriteFunctionCode(writer, opcode))
+
+    if (!ignore) {
+        writer->ignore = false;
+
+        writer->indent--;
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "}\n"))
+
+        writer->typeStack->length = typeStackLengthBeforeBranches;
+
+        wasmLabelStackPop(writer->labelStack);
+
+        if (blockType != NULL) {
+            MUST (wasmTypeStackPush(writer->typeStack, blockValueType))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteGoto(
+    WasmCFunctionWriter* writer,
+    U32 labelStackIndex
+) {
+    WasmLabel label = writer->labelStack->labels[labelStackIndex];
+
+    MUST (wasmCWriteIndent(writer))
+
+    if (label.type != NULL) {
+        WasmValueType resultType = *label.type;
+
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+        const U32 destinationStackIndex = label.typeStackLength;
+
+        if (destinationStackIndex != stackIndex0) {
+
+            MUST (wasmTypeStackSet(writer->stackDeclarations, destinationStackIndex, resultType))
+
+            MUST (wasmCWriteStringStackName(writer->builder, destinationStackIndex, resultType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+            ))
+            MUST (wasmCWrite(writer, "; "))
+        }
+    }
+
+    MUST (wasmCWrite(writer, "goto "))
+    MUST (wasmCWriteStringLabelName(writer->builder, label.index))
+    MUST (wasmCWrite(writer, ";\n"))
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSelectExpr(
+    WasmCFunctionWriter* writer
+) {
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
+
+    /* same as 2 */
+    const WasmValueType resultType = writer->typeStack->valueTypes[stackIndex1];
+
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex2, resultType))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex2,
+        resultType
+    ))
+    MUST (wasmCWriteAssign(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWrite(writer, " ? "))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex2,
+        writer->typeStack->valueTypes[stackIndex2]
+    ))
+    MUST (wasmCWrite(writer, " : "))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWrite(writer, ";\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 3);
+
+    MUST (wasmTypeStackPush(writer->typeStack, resultType))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBranchExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmBranchInstruction instruction;
+    if (!wasmBranchInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+        const U32 labelIndex = wasmLabelStackGetTopIndex(writer->labelStack, instruction.labelIndex);
+        MUST (wasmCWriteGoto(writer, labelIndex))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBranchIfExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmBranchInstruction instruction;
+    if (!wasmBranchInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "if ("))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+        MUST (wasmCWrite(writer, ") {\n"))
+        writer->indent++;
+
+        wasmTypeStackDrop(writer->typeStack, 1);
+
+        {
+            const U32 labelIndex = wasmLabelStackGetTopIndex(writer->labelStack, instruction.labelIndex);
+            MUST (wasmCWriteGoto(writer, labelIndex))
+        }
+
+        writer->indent--;
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "}\n"))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBranchTableExpr(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    WasmBranchTableInstruction instruction;
+    if (!wasmBranchTableInstructionRead(writer->code, opcode, &instruction)) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "switch ("))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+        MUST (wasmCWrite(writer, ") {\n"))
+
+        wasmTypeStackDrop(writer->typeStack, 1);
+
+        {
+            U32 index = 0;
+            for (; index < instruction.labelIndexCount; index++) {
+                MUST (wasmCWriteIndent(writer))
+                MUST (wasmCWrite(writer, "case "))
+                MUST (stringBuilderAppendI64(writer->builder, index))
+                MUST (wasmCWrite(writer, ":\n"))
+                writer->indent++;
+                {
+                    const U32 labelIndex = wasmLabelStackGetTopIndex(
+                        writer->labelStack,
+                        instruction.labelIndices[index]
+                    );
+                    MUST (wasmCWriteGoto(writer, labelIndex))
+                }
+                writer->indent--;
+            }
+        }
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "default:\n"))
+        writer->indent++;
+        {
+            const U32 labelIndex = wasmLabelStackGetTopIndex(
+                writer->labelStack,
+                instruction.defaultLabelIndex
+            );
+            MUST (wasmCWriteGoto(writer, labelIndex))
+        }
+        writer->indent--;
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "}\n"))
+    }
+
+    wasmBranchTableInstructionFree(instruction);
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCReadTagIndex(
+    WasmCFunctionWriter* writer,
+    const WasmOpcode opcode,
+    U32* tagIndex
+) {
+    if (leb128ReadU32(writer->code, tagIndex) == 0 || *tagIndex >= writer->module->tags.count) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction: invalid tag index\n",
+            wasmOpcodeDescription(opcode)
+        );
+        return false;
+    }
+    return true;
+}
+
+static
+WasmFunctionType
+wasmCGetTagType(
+    const WasmModule* module,
+    U32 tagIndex
+) {
+    return module->functionTypes.functionTypes[module->tags.functionTypeIndices[tagIndex]];
+}
+
+/*
+ * Exception values are stored as 64-bit integers,
+ * floating-point values with their bit pattern
+ */
+static const char* exceptionValueStores[wasmValueType_count] = {
+    "", "", "i32_reinterpret_f32(", "i64_reinterpret_f64("
+};
+
+static const char* exceptionValueLoads[wasmValueType_count] = {
+    "(U32)", "", "f32_reinterpret_i32((U32)", "f64_reinterpret_i64("
+};
+
+/*
+ * try blocks cost nothing on entry: calls in the body branch to the handler
+ * after the body when they return with an exception pending. The handler
+ * compares the tag with the catch clauses, takes the exception of the first
+ * that matches, or passes it on to the enclosing handler (or to the delegate
+ * target). The caught exception is kept in a local for rethrow
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteTryExpr(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+) {
+    bool ignore = writer->ignore;
+    bool catchesAll = false;
+
+    size_t typeStackLengthBeforeBranches = 0;
+    size_t labelStackIndex = 0;
+    WasmLabel label = wasmEmptyLabel;
+
+    WasmValueType blockValueType;
+    WasmValueType* blockType = &blockValueType;
+    if (!wasmReadBlockType(writer->code, &blockType)) {
+        fprintf(stderr, "w2c2: invalid try instruction: expected block type\n");
+        return false;
+    }
+
+    if (!ignore) {
+        typeStackLengthBeforeBranches = writer->typeStack->length;
+
+        MUST (wasmLabelStackPush(
+            writer->labelStack,
+            typeStackLengthBeforeBranches,
+            blockType,
+            &label
+        ))
+
+        labelStackIndex = writer->labelStack->length - 1;
+        writer->labelStack->labels[labelStackIndex].catches = true;
+
+        if (writer->pretty) {
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "{\n"))
+            writer->indent++;
+        }
+    }
+
+    MUST (wasmCWriteFunctionCode(writer, opcode))
+
+    if (!ignore) {
+        /* Exceptions in the catch clauses go to the enclosing handler */
+        writer->labelStack->labels[labelStackIndex].catches = false;
+
+        if (writer->pretty) {
+            writer->indent--;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "}\n"))
+        }
+
+        if (!writer->ignore) {
+            MUST (wasmCWriteGoto(writer, labelStackIndex))
+        }
+        writer->ignore = false;
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (stringBuilderAppend(writer->builder, handlerNamePrefix))
+        MUST (stringBuilderAppendI64(writer->builder, (I64) label.index))
+        MUST (wasmCWrite(writer, ":;\n"))
+    }
+
+    while (*opcode == wasmOpcodeCatch || *opcode == wasmOpcodeCatchAll) {
+        const bool all = *opcode == wasmOpcodeCatchAll;
+        U32 tagIndex = 0;
+
+        if (!all) {
+            MUST (wasmCReadTagIndex(writer, *opcode, &tagIndex))
+        }
+
+        if (!ignore) {
+            writer->typeStack->length = typeStackLengthBeforeBranches;
+
+            MUST (wasmCWriteIndent(writer))
+            if (all) {
+                catchesAll = true;
+                MUST (wasmCWrite(writer, "{\n"))
+            } else {
+                MUST (wasmCWrite(writer, "if (wasmPendingException.tag == "))
+                MUST (wasmCWriteStringTagName(writer->builder, tagIndex))
+                MUST (wasmCWrite(writer, ") {\n"))
+            }
+            writer->indent++;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "wasmException "))
+            MUST (stringBuilderAppend(writer->builder, caughtNamePrefix))
+            MUST (stringBuilderAppendI64(writer->builder, (I64) label.index))
+            MUST (wasmCWrite(writer, " = wasmPendingException;\n"))
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "wasmPendingException.tag = NULL;\n"))
+
+            if (!all) {
+                const WasmFunctionType tagType = wasmCGetTagType(writer->module, tagIndex);
+                U32 valueIndex = 0;
+                for (; valueIndex < tagType.parameterCount; valueIndex++) {
+                    const WasmValueType valueType = tagType.parameterTypes[valueIndex];
+                    const U32 stackIndex = writer->typeStack->length;
+
+                    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex, valueType))
+                    MUST (wasmTypeStackPush(writer->typeStack, valueType))
+
+                    MUST (wasmCWriteIndent(writer))
+                    MUST (wasmCWriteStringStackName(writer->builder, stackIndex, valueType))
+                    MUST (wasmCWriteAssign(writer))
+                    MUST (wasmCWrite(writer, exceptionValueLoads[valueType]))
+                    MUST (stringBuilderAppend(writer->builder, caughtNamePrefix))
+                    MUST (stringBuilderAppendI64(writer->builder, (I64) label.index))
+                    MUST (wasmCWrite(writer, ".values["))
+                    MUST (stringBuilderAppendI64(writer->builder, (I64) valueIndex))
+                    MUST (wasmCWrite(writer, "]"))
+                    if (valueType == wasmValueTypeF32 || valueType == wasmValueTypeF64) {
+                        MUST (wasmCWrite(writer, ")"))
+                    }
+                    MUST (wasmCWrite(writer, ";\n"))
+                }
+            }
+        }
+
+        MUST (wasmCWriteFunctionCode(writer, opcode))
+
+        if (!ignore) {
+            if (!writer->ignore) {
+                MUST (wasmCWriteGoto(writer, labelStackIndex))
+            }
+            writer->ignore = false;
+
+            writer->indent--;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "}\n"))
+        }
+    }
+
+    if (*opcode == wasmOpcodeDelegate) {
+        /* The label index counts from the block enclosing the try block */
+        U32 depth = 0;
+        if (leb128ReadU32(writer->code, &depth) == 0) {
+            fprintf(stderr, "w2c2: invalid delegate instruction encoding\n");
+            return false;
+        }
+        if (!ignore) {
+            if (depth >= labelStackIndex) {
+                fprintf(stderr, "w2c2: invalid delegate instruction: invalid label index\n");
+                return false;
+            }
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteUnwind(writer, labelStackIndex - 1 - depth))
+        }
+    } else if (!ignore && !catchesAll) {
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteUnwind(writer, labelStackIndex))
+    }
+
+    if (!ignore) {
+        MUST (wasmCWriteLabel(writer, label.index))
+
+        writer->typeStack->length = typeStackLengthBeforeBranches;
+
+        wasmLabelStackPop(writer->labelStack);
+
+        if (blockType != NULL) {
+            MUST (wasmTypeStackPush(writer->typeStack, blockValueType))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteThrowExpr(
+    WasmCFunctionWriter* writer
+) {
+    U32 tagIndex = 0;
+    MUST (wasmCReadTagIndex(writer, wasmOpcodeThrow, &tagIndex))
+
+    if (!writer->ignore) {
+        const WasmFunctionType tagType = wasmCGetTagType(writer->module, tagIndex);
+        const U32 valueCount = tagType.parameterCount;
+        U32 valueIndex = 0;
+
+        if (valueCount > WASM_EXCEPTION_VALUES) {
+            fprintf(stderr, "w2c2: exceptions with more than %u values are not supported\n", WASM_EXCEPTION_VALUES);
+            return false;
+        }
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "wasmPendingException.tag = "))
+        MUST (wasmCWriteStringTagName(writer->builder, tagIndex))
+        MUST (wasmCWrite(writer, ";\n"))
+
+        for (; valueIndex < valueCount; valueIndex++) {
+            const WasmValueType valueType = tagType.parameterTypes[valueIndex];
+            const U32 stackIndex = wasmTypeStackGetTopIndex(writer->typeStack, valueCount - valueIndex - 1);
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "wasmPendingException.values["))
+            MUST (stringBuilderAppendI64(writer->builder, (I64) valueIndex))
+            MUST (wasmCWrite(writer, "]"))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWrite(writer, exceptionValueStores[valueType]))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex, valueType))
+            if (valueType == wasmValueTypeF32 || valueType == wasmValueTypeF64) {
+                MUST (wasmCWrite(writer, ")"))
+            }
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+
+        wasmTypeStackDrop(writer->typeStack, valueCount);
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteUnwind(writer, writer->labelStack->length - 1))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteRethrowExpr(
+    WasmCFunctionWriter* writer
+) {
+    WasmBranchInstruction instruction;
+    if (!wasmBranchInstructionRead(writer->code, wasmOpcodeRethrow, &instruction)) {
+        fprintf(stderr, "w2c2: invalid rethrow instruction encoding\n");
+        return false;
+    }
+
+    if (!writer->ignore) {
+        WasmLabel label;
+
+        if (instruction.labelIndex >= writer->labelStack->length) {
+            fprintf(stderr, "w2c2: invalid rethrow instruction: invalid label index\n");
+            return false;
+        }
+        label = writer->labelStack->labels[wasmLabelStackGetTopIndex(writer->labelStack, instruction.labelIndex)];
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "wasmPendingException = "))
+        MUST (stringBuilderAppend(writer->builder, caughtNamePrefix))
+        MUST (stringBuilderAppendI64(writer->builder, (I64) label.index))
+        MUST (wasmCWrite(writer, ";\n"))
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteUnwind(writer, writer->labelStack->length - 1))
+    }
+
+    return true;
+}
+
+/*
+ * wasmCWriteLineDirective maps the code of the next instruction
+ * to its source line, if the module has DWARF line information
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLineDirective(
+    WasmCFunctionWriter* writer
+) {
+    const WasmDebugLines* debugLines = &writer->module->debugLines;
+    StringBuilder* builder = writer->builder;
+    const WasmDebugLine* row = NULL;
+    const char* path = NULL;
+
+    if (debugLines->lineCount == 0) {
+        return true;
+    }
+
+    row = wasmDebugLinesFind(
+        debugLines,
+        (U32) (writer->code->data - writer->module->codeSectionStart)
+    );
+    if (row == NULL) {
+        return true;
+    }
+    path = debugLines->files[row->fileIndex];
+    if (path[0] == '\0') {
+        return true;
+    }
+
+    /* Each line written since the last directive advanced the line number */
+    for (; writer->lineScanned < builder->length; writer->lineScanned++) {
+        if (builder->string[writer->lineScanned] == '\n') {
+            writer->line++;
+        }
+    }
+
+    if (row->fileIndex == writer->lineFileIndex && row->line == writer->line) {
+        return true;
+    }
+
+    if (builder->length > 0 && builder->string[builder->length - 1] != '\n') {
+        MUST (stringBuilderAppendChar(builder, '\n'))
+    }
+    MUST (stringBuilderAppend(builder, "#line "))
+    MUST (stringBuilderAppendI64(builder, (I64) row->line))
+    MUST (stringBuilderAppend(builder, " \""))
+    for (; *path != '\0'; path++) {
+        if (*path == '"' || *path == '\\') {
+            MUST (stringBuilderAppendChar(builder, '\\'))
+        }
+        MUST (stringBuilderAppendChar(builder, *path))
+    }
+    MUST (stringBuilderAppend(builder, "\"\n"))
+
+    writer->lineFileIndex = row->fileIndex;
+    writer->line = row->line;
+    writer->lineScanned = builder->length;
+
+    return true;
+}
+
+/*
+ * wasmCWriteFileLineDirective maps the signature and prologue of a function
+ * to the source line of its first instruction
+ */
+static
+void
+wasmCWriteFileLineDirective(
+    FILE* file,
+    const WasmModule* module,
+    const U8* code
+) {
+    const WasmDebugLines* debugLines = &module->debugLines;
+    const WasmDebugLine* row = NULL;
+    const char* path = NULL;
+
+    if (debugLines->lineCount == 0) {
+        return;
+    }
+
+    row = wasmDebugLinesFind(debugLines, (U32) (code - module->codeSectionStart));
+    if (row == NULL) {
+        return;
+    }
+    path = debugLines->files[row->fileIndex];
+    if (path[0] == '\0') {
+        return;
+    }
+
+    fprintf(file, "#line %u \"", row->line);
+    for (; *path != '\0'; path++) {
+        if (*path == '"' || *path == '\\') {
+            fputc('\\', file);
+        }
+        fputc(*path, file);
+    }
+    fputs("\"\n", file);
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionCode(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+) {
+    while (true) {
+        MUST (wasmCWriteLineDirective(writer))
+        if (!wasmOpcodeRead(writer->code, opcode)) {
+            break;
+        }
+        switch (*opcode) {
+            case wasmOpcodeNop:
+                break;
+            case wasmOpcodeElse:
+            case wasmOpcodeEnd:
+            case wasmOpcodeCatch:
+            case wasmOpcodeCatchAll:
+            case wasmOpcodeDelegate:
+                return true;
+            case wasmOpcodeIf: {
+                MUST (wasmCWriteIfExpr(writer, opcode))
+                if (*opcode == wasmOpcodeElse) {
+                    return true;
+                }
+                break;
+            }
+            case wasmOpcodeBlock: {
+                MUST (wasmCWriteBlockExpr(writer, opcode))
+                if (*opcode == wasmOpcodeElse) {
+                    return true;
+                }
+                break;
+            }
+            case wasmOpcodeLoop: {
+                writer->loops = true;
+                writer->loopDepth++;
+                MUST (wasmCWriteLoopExpr(writer, opcode))
+                writer->loopDepth--;
+                if (*opcode == wasmOpcodeElse) {
+                    return true;
+                }
+                break;
+            }
+            case wasmOpcodeTry: {
+                MUST (wasmCWriteTryExpr(writer, opcode))
+                break;
+            }
+            case wasmOpcodeThrow: {
+                MUST (wasmCWriteThrowExpr(writer))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeRethrow: {
+                MUST (wasmCWriteRethrowExpr(writer))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeCall: {
+                MUST (wasmCWriteCallExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeCallIndirect: {
+                MUST (wasmCWriteCallIndirectExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeReturnCall: {
+                MUST (wasmCWriteCallExpr(writer, *opcode))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeReturnCallIndirect: {
+                MUST (wasmCWriteCallIndirectExpr(writer, *opcode))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeBr: {
+                MUST (wasmCWriteBranchExpr(writer, *opcode))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeBrIf: {
+                MUST (wasmCWriteBranchIfExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeBrTable: {
+                MUST (wasmCWriteBranchTableExpr(writer, *opcode))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeLocalGet: {
+                MUST (wasmCWriteLocalGetExpr(writer))
+                break;
+            }
+            case wasmOpcodeLocalSet:
+            case wasmOpcodeLocalTee: {
+                MUST (wasmCWriteLocalAssignmentExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeGlobalGet: {
+                MUST (wasmCWriteGlobalGetExpr(writer))
+                break;
+            }
+            case wasmOpcodeGlobalSet: {
+                MUST (wasmCWriteGlobalSetExpr(writer))
+                break;
+            }
+            case wasmOpcodeI32Const:
+            case wasmOpcodeI64Const:
+            case wasmOpcodeF32Const:
+            case wasmOpcodeF64Const: {
+                MUST (wasmCWriteConstExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeI32Load:
+            case wasmOpcodeI64Load:
+            case wasmOpcodeF32Load:
+            case wasmOpcodeF64Load:
+            case wasmOpcodeI32Load8S:
+            case wasmOpcodeI32Load8U:
+            case wasmOpcodeI32Load16S:
+            case wasmOpcodeI32Load16U:
+            case wasmOpcodeI64Load8S:
+            case wasmOpcodeI64Load8U:
+            case wasmOpcodeI64Load16S:
+            case wasmOpcodeI64Load16U:
+            case wasmOpcodeI64Load32S:
+            case wasmOpcodeI64Load32U: {
+                MUST (wasmCWriteLoadExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeI32Store:
+            case wasmOpcodeI64Store:
+            case wasmOpcodeF32Store:
+            case wasmOpcodeF64Store:
+            case wasmOpcodeI32Store8:
+            case wasmOpcodeI32Store16:
+            case wasmOpcodeI64Store8:
+            case wasmOpcodeI64Store16:
+            case wasmOpcodeI64Store32: {
+                MUST (wasmCWriteStoreExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeMemorySize: {
+                MUST (wasmCWriteMemorySize(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeMemoryGrow: {
+                MUST (wasmCWriteMemoryGrow(writer, *opcode))
+                break;
+            }
+            default: {
+                if (writer->ignore) {
+                    break;
+                }
+
+                switch (*opcode) {
+                    case wasmOpcodeDrop: {
+                        wasmTypeStackDrop(writer->typeStack, 1);
+                        break;
+                    }
+                    case wasmOpcodeUnreachable: {
+                        MUST (wasmCWriteIndent(writer))
+                        MUST (wasmCWrite(writer, "UNREACHABLE;\n"))
+                        writer->ignore = true;
+                        break;
+                    }
+                    case wasmOpcodeSelect: {
+                        MUST (wasmCWriteSelectExpr(writer))
+                        break;
+                    }
+                    case wasmOpcodeReturn: {
+                        MUST (wasmCWriteGoto(writer, 0))
+                        writer->ignore = true;
+                        break;
+                    }
+                    case wasmOpcodeI32Eq:
+                    case wasmOpcodeI64Eq:
+                    case wasmOpcodeF32Eq:
+                    case wasmOpcodeF64Eq: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "==", false))
+                        break;
+                    }
+                    case wasmOpcodeI32Ne:
+                    case wasmOpcodeI64Ne:
+                    case wasmOpcodeF32Ne:
+                    case wasmOpcodeF64Ne: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "!=", false))
+                        break;
+                    }
+                    case wasmOpcodeI32LtS:
+                    case wasmOpcodeI64LtS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, "<"))
+                        break;
+                    }
+                    case wasmOpcodeI32LtU:
+                    case wasmOpcodeI64LtU:
+                    case wasmOpcodeF32Lt:
+                    case wasmOpcodeF64Lt: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "<", false))
+                        break;
+                    }
+                    case wasmOpcodeI32LeS:
+                    case wasmOpcodeI64LeS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, "<="))
+                        break;
+                    }
+                    case wasmOpcodeI32LeU:
+                    case wasmOpcodeI64LeU:
+                    case wasmOpcodeF32Le:
+                    case wasmOpcodeF64Le: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "<=", false))
+                        break;
+                    }
+                    case wasmOpcodeI32GtS:
+                    case wasmOpcodeI64GtS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, ">"))
+                        break;
+                    }
+                    case wasmOpcodeI32GtU:
+                    case wasmOpcodeI64GtU:
+                    case wasmOpcodeF32Gt:
+                    case wasmOpcodeF64Gt: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, ">", false))
+                        break;
+                    }
+                    case wasmOpcodeI32GeS:
+                    case wasmOpcodeI64GeS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, ">="))
+                        break;
+                    }
+                    case wasmOpcodeI32GeU:
+                    case wasmOpcodeI64GeU:
+                    case wasmOpcodeF32Ge:
+                    case wasmOpcodeF64Ge: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, ">=", false))
+                        break;
+                    }
+                    case wasmOpcodeI32Add:
+                    case wasmOpcodeI64Add:
+                    case wasmOpcodeF32Add:
+                    case wasmOpcodeF64Add: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "+", true))
+                        break;
+                    }
+                    case wasmOpcodeI32Sub:
+                    case wasmOpcodeI64Sub:
+                    case wasmOpcodeF32Sub:
+                    case wasmOpcodeF64Sub: {
+                        if (!writer->ignore) {
+                            MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "-", true))
+                        }
+                        break;
+                    }
+                    case wasmOpcodeI32Mul:
+                    case wasmOpcodeI64Mul:
+                    case wasmOpcodeF32Mul:
+                    case wasmOpcodeF64Mul: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "*", true))
+                        break;
+                    }
+                    case wasmOpcodeI32DivS: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I32_DIV_S"))
+                        break;
+                    }
+                    case wasmOpcodeI64DivS: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I64_DIV_S"))
+                        break;
+                    }
+                    case wasmOpcodeI32DivU:
+                    case wasmOpcodeI64DivU: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "DIV_U"))
+                        break;
+                    }
+                    case wasmOpcodeF32Div:
+                    case wasmOpcodeF64Div: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "/", true))
+                        break;
+                    }
+                    case wasmOpcodeI32Eqz:
+                    case wasmOpcodeI64Eqz: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "!"))
+                        break;
+                    }
+                    case wasmOpcodeI32And:
+                    case wasmOpcodeI64And: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "&", true))
+                        break;
+                    }
+                    case wasmOpcodeI32Or:
+                    case wasmOpcodeI64Or: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "|", true))
+                        break;
+                    }
+                    case wasmOpcodeI32Xor:
+                    case wasmOpcodeI64Xor: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, *opcode, "^", true))
+                        break;
+                    }
+                    case wasmOpcodeI32RemS: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I32_REM_S"))
+                        break;
+                    }
+                    case wasmOpcodeI64RemS: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I64_REM_S"))
+                        break;
+                    }
+                    case wasmOpcodeI32RemU:
+                    case wasmOpcodeI64RemU: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "REM_U"))
+                        break;
+                    }
+                    case wasmOpcodeI32Clz: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_CLZ"))
+                        break;
+                    }
+                    case wasmOpcodeI64Clz: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_CLZ"))
+                        break;
+                    }
+                    case wasmOpcodeI32Ctz: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_CTZ"))
+                        break;
+                    }
+                    case wasmOpcodeI64Ctz: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_CTZ"))
+                        break;
+                    }
+                    case wasmOpcodeI32PopCnt: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_POPCNT"))
+                        break;
+                    }
+                    case wasmOpcodeI64PopCnt: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_POPCNT"))
+                        break;
+                    }
+                    case wasmOpcodeF32Neg:
+                    case wasmOpcodeF64Neg: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "-"))
+                        break;
+                    }
+                    case wasmOpcodeF32Abs: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "fabsf"))
+                        break;
+                    }
+                    case wasmOpcodeF64Abs: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "fabs"))
+                        break;
+                    }
+                    case wasmOpcodeF32Sqrt: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "sqrtf"))
+                        break;
+                    }
+                    case wasmOpcodeF64Sqrt: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "sqrt"))
+                        break;
+                    }
+                    case wasmOpcodeF32Ceil: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "ceilf"))
+                        break;
+                    }
+                    case wasmOpcodeF64Ceil: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "ceil"))
+                        break;
+                    }
+                    case wasmOpcodeF32Floor: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "floorf"))
+                        break;
+                    }
+                    case wasmOpcodeF64Floor: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "floor"))
+                        break;
+                    }
+                    case wasmOpcodeF32Trunc: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "truncf"))
+                        break;
+                    }
+                    case wasmOpcodeF64Trunc: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "trunc"))
+                        break;
+                    }
+                    case wasmOpcodeF32Nearest: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "nearbyintf"))
+                        break;
+                    }
+                    case wasmOpcodeF64Nearest: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "nearbyint"))
+                        break;
+                    }
+                    case wasmOpcodeI32Shl:
+                    case wasmOpcodeI64Shl: {
+                        MUST (wasmCWriteShiftLeftExpr(writer, *opcode))
+                        break;
+                    }
+                    case wasmOpcodeI32ShrS:
+                    case wasmOpcodeI64ShrS: {
+                        MUST (wasmCWriteSignedShiftRightExpr(writer, *opcode))
+                        break;
+                    }
+                    case wasmOpcodeI32ShrU:
+                    case wasmOpcodeI64ShrU: {
+                        MUST (wasmCWriteUnsignedShiftRightExpr(writer, *opcode))
+                        break;
+                    }
+                    case wasmOpcodeI32Rotl: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I32_ROTL"))
+                        break;
+                    }
+                    case wasmOpcodeI64Rotl: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I64_ROTL"))
+                        break;
+                    }
+                    case wasmOpcodeI32Rotr: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I32_ROTR"))
+                        break;
+                    }
+                    case wasmOpcodeI64Rotr: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "I64_ROTR"))
+                        break;
+                    }
+                    case wasmOpcodeF32Min:
+                    case wasmOpcodeF64Min: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "FMIN"))
+                        break;
+                    }
+                    case wasmOpcodeF32Max:
+                    case wasmOpcodeF64Max: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "FMAX"))
+                        break;
+                    }
+                    case wasmOpcodeF32CopySign: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "copysignf"))
+                        break;
+                    }
+                    case wasmOpcodeF64CopySign: {
+                        MUST (wasmCWritePrefixBinaryExpr(writer, *opcode, "copysign"))
+                        break;
+                    }
+                    case wasmOpcodeI64ExtendI32S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(U64)(I64)(I32)"))
+                        break;
+                    }
+                    case wasmOpcodeI64ExtendI32U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(U64)"))
+                        break;
+                    }
+                    case wasmOpcodeI32WrapI64: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(U32)"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncF32S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_S_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncF32S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_S_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncF64S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_S_F64"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncF64S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_S_F64"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncF32U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_U_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncF32U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_U_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncF64U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_U_F64"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncF64U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_U_F64"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncSatF32S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_SAT_S_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncSatF32S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_SAT_S_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncSatF64S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_SAT_S_F64"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncSatF64S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_SAT_S_F64"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncSatF32U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_SAT_U_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncSatF32U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_SAT_U_F32"))
+                        break;
+                    }
+                    case wasmOpcodeI32TruncSatF64U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I32_TRUNC_SAT_U_F64"))
+                        break;
+                    }
+                    case wasmOpcodeI64TruncSatF64U: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "I64_TRUNC_SAT_U_F64"))
+                        break;
+                    }
+                    case wasmOpcodeF32ConvertI32S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F32)(I32)"))
+                        break;
+                    }
+                    case wasmOpcodeF32ConvertI64S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F32)(I64)"))
+                        break;
+                    }
+                    case wasmOpcodeF32ConvertI32U:
+                    case wasmOpcodeF32DemoteF64: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F32)"))
+                        break;
+                    }
+                    case wasmOpcodeF32ConvertI64U: {
+                        /* TODO */
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F32)"))
+                        break;
+                    }
+                    case wasmOpcodeF64ConvertI32S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F64)(I32)"))
+                        break;
+                    }
+                    case wasmOpcodeF64ConvertI64S: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F64)(I64)"))
+                        break;
+                    }
+                    case wasmOpcodeF64ConvertI32U:
+                    case wasmOpcodeF64PromoteF32: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F64)"))
+                        break;
+                    }
+                    case wasmOpcodeF64ConvertI64U: {
+                        /* TODO */
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "(F64)"))
+                        break;
+                    }
+                    case wasmOpcodeF32ReinterpretI32: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "f32_reinterpret_i32"))
+                        break;
+                    }
+                    case wasmOpcodeI32ReinterpretF32: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "i32_reinterpret_f32"))
+                        break;
+                    }
+                    case wasmOpcodeF64ReinterpretI64: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "f64_reinterpret_i64"))
+                        break;
+                    }
+                    case wasmOpcodeI64ReinterpretF64: {
+                        MUST (wasmCWriteUnaryExpr(writer, *opcode, "i64_reinterpret_f64"))
+                        break;
+                    }
+                    default:
+                        fprintf(stderr, "w2c2: unsupported opcode %s\n", wasmOpcodeDescription(*opcode));
+                        return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static
+void
+wasmCWriteStackDeclarations(
+    FILE* file,
+    const WasmTypeStack* stackDeclarations,
+    bool pretty
+) {
+    WasmValueType testType = 0;
+    for (; testType < wasmValueType_count; testType++) {
+        U32 written = 0;
+
+        U32 stackDeclarationIndex = 0;
+        for (; stackDeclarationIndex < stackDeclarations->length; stackDeclarationIndex++) {
+            WasmValueType entry = stackDeclarations->valueTypes[stackDeclarationIndex];
+            if (!entry) {
+                continue;
+            }
+            if (!wasmTypeStackIsSet(stackDeclarations, stackDeclarationIndex, testType)) {
+                continue;
+            }
+            if (written == 0) {
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                fputs(valueTypeNames[testType], file);
+                fputc(' ', file);
+            } else {
+                if (pretty) {
+                    fputs(", ", file);
+                } else {
+                    fputc(',', file);
+                }
+            }
+
+            wasmCWriteFileStackName(file, stackDeclarationIndex, testType);
+
+            written++;
+        }
+
+        if (written > 0) {
+            fputs(";\n", file);
+        }
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionReturn(
+    WasmCFunctionWriter* writer,
+    WasmFunctionType functionType
+) {
+    if (!functionType.resultCount) {
+        return true;
+    }
+
+    if (writer->stackDeclarations->length > 0) {
+        /* TODO: add support for multiple result values */
+        const WasmValueType returnType = functionType.resultTypes[0];
+        wasmTypeStackClear(writer->typeStack);
+        MUST (wasmTypeStackPush(writer->typeStack, returnType))
+
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, returnType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "return "))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, returnType))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCTranslateFunctionBody(
+    StringBuilder* stringBuilder,
+    WasmTypeStack* typeStack,
+    WasmTypeStack* stackDeclarations,
+    WasmLabelStack* labelStack,
+    const WasmModule* module,
+    const WasmFunction function,
+    bool pretty,
+    bool* hotCallees,
+    bool* tailCallTypes,
+    bool* calls,
+    bool* loops,
+    bool* makesTailCalls
+) {
+    Buffer code = function.code;
+    WasmOpcode opcode = wasmOpcodeUnreachable;
+    WasmLabel label = wasmEmptyLabel;
+    WasmValueType* resultType = NULL;
+
+    WasmFunctionType functionType =
+        module->functionTypes.functionTypes[function.functionTypeIndex];
+
+    if (functionType.resultCount) {
+        resultType = &functionType.resultTypes[0];
+        /* TODO: add support for multiple result values */
+        if (functionType.resultCount > 1) {
+            fprintf(stderr, "w2c2: function with multiple return values\n");
+            return false;
+        }
+    } else {
+        resultType = NULL;
+    }
+
+    {
+        WasmCFunctionWriter writer;
+        writer.builder = stringBuilder;
+        writer.typeStack = typeStack;
+        writer.stackDeclarations = stackDeclarations;
+        writer.labelStack = labelStack;
+        writer.module = module;
+        writer.function = function;
+        writer.code = &code;
+        writer.indent = 0;
+        writer.ignore = false;
+        writer.pretty = pretty;
+        writer.calls = false;
+        writer.loops = false;
+        writer.loopDepth = 0;
+        writer.hotCallees = hotCallees;
+        writer.exceptions = module->tags.count > 0;
+        writer.tailCalls = false;
+        writer.tailCallTypes = tailCallTypes;
+        writer.lineFileIndex = (U32) -1;
+        writer.line = 0;
+        writer.lineScanned = 0;
+
+        MUST (wasmLabelStackPush(writer.labelStack, 0, resultType, &label))
+        MUST (wasmCWriteFunctionCode(&writer, &opcode))
+        MUST (wasmCWriteLabel(&writer, label.index))
+        MUST (wasmCWriteFunctionReturn(&writer, functionType))
+
+        *calls = writer.calls;
+        *loops = writer.loops;
+        *makesTailCalls = writer.tailCalls;
+    }
+
+    return true;
+}
+
+static
+void
+wasmCWriteFunctionBody(
+    FILE* file,
+    const WasmTypeStack* stackDeclarations,
+    const WasmModule* module,
+    const WasmFunction function,
+    const StringBuilder* stringBuilder,
+    bool calls,
+    bool pretty
+) {
+    fputs("{\n", file);
+    wasmCWriteFileLocalsDeclarations(file, module, function, pretty);
+    wasmCWriteStackDeclarations(file, stackDeclarations, pretty);
+    /*
+     * Without loops or calls, a function runs a bounded number of instructions,
+     * so only functions which may recurse check for interruption on entry
+     */
+    if (calls) {
+        fputs("WASM_INTERRUPT_CHECK();\n", file);
+    }
+    fputs(stringBuilder->string, file);
+    fputs("}\n", file);
+}
+
+static
+void
+wasmCWriteFileParameters(
+    FILE* file,
+    WasmFunctionType functionType,
+    bool pretty
+) {
+    fputc('(', file);
+    {
+        U32 parameterIndex = 0;
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+            if (parameterIndex > 0) {
+                if (pretty) {
+                    fputs(", ", file);
+                } else {
+                    fputc(',', file);
+                }
+            }
+            {
+                const char* parameterTypeName = valueTypeNames[parameterType];
+                fputs(parameterTypeName, file);
+            }
+        }
+    }
+    fputc(')', file);
+}
+
+static
+void
+wasmCWriteFunctionImports(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 functionIndex = 0;
+    U32 functionImportCount = module->functionImports.length;
+    for (; functionIndex < functionImportCount; functionIndex++) {
+        const WasmFunctionImport import = module->functionImports.imports[functionIndex];
+        const WasmFunctionType functionType =
+            module->functionTypes.functionTypes[import.functionTypeIndex];
+
+        fputs("extern ", file);
+        fputs(wasmCGetReturnType(functionType), file);
+        fputc(' ', file);
+        wasmCWriteFileFunctionName(file, module, functionIndex, false);
+        wasmCWriteFileParameters(file, functionType, pretty);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteFunctionDeclarations(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 functionImportCount = module->functionImports.length;
+
+    U32 functionIndex = 0;
+    for (; functionIndex < module->functions.count; functionIndex++) {
+        const WasmFunction function = module->functions.functions[functionIndex];
+        wasmCWriteFileFunctionSignature(file, module, function, functionImportCount + functionIndex, false, pretty);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteBaseInclude(
+    FILE* file,
+    const WasmModule* module
+);
+
+static
+FILE*
+wasmCOpenImplementationFile(
+    const WasmModule* module,
+    const char* filename
+) {
+    FILE* file = fopen(filename, "w");
+    if (file == NULL) {
+        fprintf(stderr, "w2c2: failed to open file %s for writing\n", filename);
+        return NULL;
+    }
+    wasmCWriteBaseInclude(file, module);
+    fputs("#include \"decls.h\"\n\n", file);
+    return file;
+}
+
+/*
+ * Without a profile, functions which contain a loop or are called inside one are hot.
+ * Calls are only found by translating the callers, so all functions are translated up front
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCFindHotLoops(
+    const WasmModule* module
+) {
+    U32 functionCount = module->functions.count;
+    U32 functionIndex = 0;
+
+    WasmTypeStack typeStack = wasmEmptyTypeStack;
+    WasmTypeStack stackDeclarations = wasmEmptyTypeStack;
+    WasmLabelStack labelStack = wasmEmptyLabelStack;
+
+    if (tiering.hotFunctions == NULL) {
+        tiering.hotFunctions = calloc(functionCount + 1, sizeof(bool));
+        if (tiering.hotFunctions == NULL) {
+            fprintf(stderr, "w2c2: failed to allocate hot functions\n");
+            return false;
+        }
+    }
+
+    for (; functionIndex < functionCount; functionIndex++) {
+        const WasmFunction function = module->functions.functions[functionIndex];
+        StringBuilder body = emptyStringBuilder;
+        bool calls = false;
+        bool loops = false;
+        bool makesTailCalls = false;
+
+        wasmTypeStackClear(&typeStack);
+        wasmTypeStackClear(&stackDeclarations);
+        wasmLabelStackClear(&labelStack);
+
+        MUST (stringBuilderInitialize(&body))
+        MUST (wasmCTranslateFunctionBody(
+            &body,
+            &typeStack,
+            &stackDeclarations,
+            &labelStack,
+            module,
+            function,
+            false,
+            tiering.hotFunctions,
+            NULL,
+            &calls,
+            &loops,
+            &makesTailCalls
+        ))
+        stringBuilderFree(&body);
+
+        if (loops) {
+            tiering.hotFunctions[functionIndex] = true;
+        }
+    }
+
+    wasmTypeStackFree(typeStack);
+    wasmTypeStackFree(stackDeclarations);
+    wasmLabelStackFree(labelStack);
+
+    return true;
+}
+
+/*
+ * Finds the functions which make tail calls, so calls of them (and all indirect calls)
+ * make the tail calls they leave pending, and the types of the tail called functions,
+ * which get a thunk (see wasmCWriteTailCall). Only functions whose code contains
+ * the opcode of a tail call are translated
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCFindTailCalls(
+    const WasmModule* module
+) {
+    U32 functionCount = module->functions.count;
+    U32 functionIndex = 0;
+
+    WasmTypeStack typeStack = wasmEmptyTypeStack;
+    WasmTypeStack stackDeclarations = wasmEmptyTypeStack;
+    WasmLabelStack labelStack = wasmEmptyLabelStack;
+
+    tailCalls.callers = calloc(functionCount + 1, sizeof(bool));
+    tailCalls.types = calloc(module->functionTypes.count + 1, sizeof(bool));
+    tailCalls.any = false;
+    if (tailCalls.callers == NULL || tailCalls.types == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate tail calls\n");
+        return false;
+    }
+
+    for (; functionIndex < functionCount; functionIndex++) {
+        const WasmFunction function = module->functions.functions[functionIndex];
+        StringBuilder body = emptyStringBuilder;
+        bool calls = false;
+        bool loops = false;
+        bool makesTailCalls = false;
+
+        if (memchr(function.code.data, wasmOpcodeReturnCall, function.code.length) == NULL
+            && memchr(function.code.data, wasmOpcodeReturnCallIndirect, function.code.length) == NULL) {
+            continue;
+        }
+
+        wasmTypeStackClear(&typeStack);
+        wasmTypeStackClear(&stackDeclarations);
+        wasmLabelStackClear(&labelStack);
+
+        MUST (stringBuilderInitialize(&body))
+        MUST (wasmCTranslateFunctionBody(
+            &body,
+            &typeStack,
+            &stackDeclarations,
+            &labelStack,
+            module,
+            function,
+            false,
+            NULL,
+            tailCalls.types,
+            &calls,
+            &loops,
+            &makesTailCalls
+        ))
+        stringBuilderFree(&body);
+
+        if (makesTailCalls) {
+            tailCalls.callers[functionIndex] = true;
+            tailCalls.any = true;
+        }
+    }
+
+    wasmTypeStackFree(typeStack);
+    wasmTypeStackFree(stackDeclarations);
+    wasmLabelStackFree(labelStack);
+
+    return true;
+}
+
+/*
+ * Hot functions (see WasmCTiering) are written to hotFile, which is opened
+ * on demand as hot_<fileIndex>.c. Without a hotFile, all are written to file
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionImplementations(
+    FILE* file,
+    FILE** hotFile,
+    U32 fileIndex,
+    const WasmModule* module,
+    U32 startIndex,
+    U32 endIndex,
+    bool pretty
+) {
+    U32 functionImportCount = module->functionImports.length;
+
+    WasmTypeStack typeStack = wasmEmptyTypeStack;
+    WasmTypeStack stackDeclarations = wasmEmptyTypeStack;
+    WasmLabelStack labelStack = wasmEmptyLabelStack;
+
+    const U8* releaseStart = NULL;
+
+    U32 functionIndex = startIndex;
+    if (startIndex < endIndex) {
+        releaseStart = module->functions.functions[startIndex].code.data;
+    }
+    for (; functionIndex < endIndex; functionIndex++) {
+        const WasmFunction function = module->functions.functions[functionIndex];
+        StringBuilder body = emptyStringBuilder;
+        bool calls = false;
+        bool loops = false;
+        bool makesTailCalls = false;
+        FILE* functionFile = file;
+
+        wasmTypeStackClear(&typeStack);
+        wasmTypeStackClear(&stackDeclarations);
+        wasmLabelStackClear(&labelStack);
+
+        MUST (stringBuilderInitialize(&body))
+        MUST (wasmCTranslateFunctionBody(
+            &body,
+            &typeStack,
+            &stackDeclarations,
+            &labelStack,
+            module,
+            function,
+            pretty,
+            NULL,
+            NULL,
+            &calls,
+            &loops,
+            &makesTailCalls
+        ))
+
+        if (hotFile != NULL && tiering.hotFunctions != NULL && tiering.hotFunctions[functionIndex]) {
+            if (*hotFile == NULL) {
+                char filename[32];
+                sprintf(filename, "hot_%05d.c", fileIndex);
+                *hotFile = wasmCOpenImplementationFile(module, filename);
+                if (*hotFile == NULL) {
+                    return false;
+                }
+            }
+            functionFile = *hotFile;
+        }
+
+        wasmCWriteFileLineDirective(functionFile, module, function.code.data);
+        wasmCWriteFileFunctionSignature(functionFile, module, function, functionImportCount + functionIndex, true, pretty);
+        fputc(' ', functionFile);
+        wasmCWriteFunctionBody(functionFile, &stackDeclarations, module, function, &body, calls, pretty);
+        fputs("\n", functionFile);
+
+        stringBuilderFree(&body);
+
+        /* Give back the code of translated functions, so only the functions in progress are resident */
+        {
+            const U8* codeEnd = function.code.data + function.code.length;
+            if ((size_t) (codeEnd - releaseStart) >= FILE_RELEASE_SIZE) {
+                releaseFileRange(releaseStart, (size_t) (codeEnd - releaseStart));
+                releaseStart = codeEnd;
+            }
+        }
+    }
+
+    if (releaseStart != NULL) {
+        const WasmFunction last = module->functions.functions[endIndex - 1];
+        releaseFileRange(releaseStart, (size_t) (last.code.data + last.code.length - releaseStart));
+    }
+
+    wasmTypeStackFree(typeStack);
+    wasmTypeStackFree(stackDeclarations);
+    wasmLabelStackFree(labelStack);
+
+    return true;
+}
+
+static
+void
+wasmCWriteGlobalImports(
+    FILE* file,
+    const WasmModule* module
+) {
+    U32 globalIndex = 0;
+    for (; globalIndex < module->globalImports.length; globalIndex++) {
+        WasmGlobalImport import = module->globalImports.imports[globalIndex];
+        fputs("extern ", file);
+        fputs(valueTypeNames[import.globalType.valueType], file);
+        wasmCWriteFileGlobalName(file, module, globalIndex, false);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteGlobals(
+    FILE* file,
+    const WasmModule* module,
+    const char* keyword
+) {
+    U32 globalIndex = 0;
+    for (; globalIndex < module->globals.count; globalIndex++) {
+        WasmGlobal global = module->globals.globals[globalIndex];
+        if (keyword != NULL) {
+            fputs(keyword, file);
+            fputc(' ', file);
+        }
+        fputs(valueTypeNames[global.type.valueType], file);
+        fputc(' ', file);
+        wasmCWriteFileGlobalName(file, module, module->globalImports.length + globalIndex, false);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteConstantExpr(
+    StringBuilder* builder,
+    const WasmModule* module,
+    Buffer code
+) {
+    WasmOpcode opcode;
+    MUST (wasmOpcodeRead(&code, &opcode))
+    switch (opcode) {
+        case wasmOpcodeI32Const:
+        case wasmOpcodeI64Const:
+        case wasmOpcodeF32Const:
+        case wasmOpcodeF64Const: {
+            WasmValueType resultType = wasmOpcodeResultType(opcode);
+            WasmConstInstruction instruction;
+            if (!wasmConstInstructionRead(&code, opcode, &instruction)) {
+                fprintf(stderr, "w2c2: invalid const instruction\n");
+                return false;
+            }
+            MUST (wasmCWriteLiteral(builder, resultType, instruction.value))
+            break;
+        }
+        case wasmOpcodeGlobalGet: {
+            WasmGlobalInstruction instruction;
+            MUST (wasmGlobalInstructionRead(&code, opcode, &instruction))
+            MUST (wasmCWriteStringGlobalName(builder, module, instruction.globalIndex, false))
+            break;
+        }
+        default: {
+            fprintf(stderr, "w2c2: invalid init expression instruction %s\n", wasmOpcodeDescription(opcode));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInitGlobals(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 globalIndex = 0;
+
+    fputs("static void initGlobals(void) {\n", file);
+
+    for (; globalIndex < module->globals.count; globalIndex++) {
+        WasmGlobal global = module->globals.globals[globalIndex];
+
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        wasmCWriteFileGlobalName(file, module, module->globalImports.length + globalIndex, false);
+        fputs(" = ", file);
+        {
+            Buffer code = global.init;
+            StringBuilder stringBuilder = emptyStringBuilder;
+
+            MUST (stringBuilderInitialize(&stringBuilder))
+            MUST (wasmCWriteConstantExpr(&stringBuilder, module, code))
+            fputs(stringBuilder.string, file);
+            stringBuilderFree(&stringBuilder);
+        }
+        fputs(";\n", file);
+    }
+
+    fputs("}\n\n", file);
+
+    return true;
+}
+
+static
+void
+wasmCWriteExportName(
+    FILE* file,
+    const char* name
+) {
+    wasmCWriteFileSymbolPrefix(file);
+    fputs("e_", file);
+    wasmCWriteFileEscaped(file, name);
+}
+
+static
+void
+wasmCWriteFunctionExport(
+    FILE* file,
+    const WasmModule* module,
+    WasmExport export,
+    WasmFunction function,
+    bool external,
+    bool pretty
+) {
+    const WasmFunctionType functionType =
+        module->functionTypes.functionTypes[function.functionTypeIndex];
+
+    if (external) {
+        fputs("extern ", file);
+    }
+    fputs(wasmCGetReturnType(functionType), file);
+    fputs(" (*", file);
+    wasmCWriteExportName(file, export.name);
+    fputc(')', file);
+    wasmCWriteFileParameters(file, functionType, pretty);
+    fputs(";\n\n", file);
+}
+
+static
+void
+wasmCWriteMemoryExport(
+    FILE* file,
+    WasmExport export,
+    bool external
+) {
+    if (external) {
+        fputs("extern ", file);
+    }
+    fputs("wasmMemory (*", file);
+    wasmCWriteExportName(file, export.name);
+    fputs(");\n\n", file);
+}
+
+static
+void
+wasmCWriteExports(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty,
+    bool external
+) {
+    U32 exportIndex = 0;
+    for (; exportIndex < module->exports.count; exportIndex++) {
+        WasmExport export = module->exports.exports[exportIndex];
+        switch (export.kind) {
+            case wasmExportKindFunction: {
+                U32 functionImportCount = module->functionImports.length;
+                U32 functionIndex = export.index - functionImportCount;
+                const WasmFunction function = module->functions.functions[functionIndex];
+                wasmCWriteFunctionExport(file, module, export, function, external, pretty);
+                break;
+            }
+            case wasmExportKindMemory: {
+                wasmCWriteMemoryExport(file, export, external);
+                break;
+            }
+
+            /* TODO: other export kinds */
+        }
+    }
+}
+
+static
+void
+wasmCWriteInitExports(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 exportIndex = 0;
+
+    wasmCWriteExports(file, module, pretty, false);
+
+    fputs("static void initExports(void) {\n", file);
+
+    for (; exportIndex < module->exports.count; exportIndex++) {
+        const WasmExport export = module->exports.exports[exportIndex];
+        switch (export.kind) {
+            case wasmExportKindFunction: {
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                wasmCWriteExportName(file, export.name);
+                fputs(" = ", file);
+                wasmCWriteFileEntryName(file, module, export.index, true);
+                fputs(";\n", file);
+                break;
+            }
+            case wasmExportKindMemory: {
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                wasmCWriteExportName(file, export.name);
+                fputs(" = ", file);
+                wasmCWriteFileMemoryName(file, module, export.index, true);
+                fputs(";\n", file);
+                break;
+            }
+
+            /* TODO: other export kinds */
+        }
+    }
+
+    fputs("}\n\n", file);
+}
+
+static
+void
+wasmCWriteDataSegments(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 dataSegmentIndex = 0;
+    for (; dataSegmentIndex < module->dataSegments.count; dataSegmentIndex++) {
+        WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+        fputs("const U8 ", file);
+        wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
+        fputs("[] = {\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        {
+            U32 byteIndex = 0;
+            for (; byteIndex < dataSegment.bytes.length; byteIndex++) {
+                fprintf(file, "0x%x", dataSegment.bytes.data[byteIndex]);
+                if (pretty) {
+                    fputs(", ", file);
+                } else {
+                    fputc(',', file);
+                }
+            }
+        }
+        fputs("\n};\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteMemoryImports(
+    FILE* file,
+    const WasmModule* module
+) {
+    U32 memoryIndex = 0;
+    for (; memoryIndex < module->memoryImports.length; memoryIndex++) {
+        fputs("extern wasmMemory ", file);
+        wasmCWriteFileMemoryName(file, module, memoryIndex, false);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteMemories(
+    FILE* file,
+    const WasmModule* module,
+    const char* keyword
+) {
+    U32 memoryIndex = 0;
+    for (; memoryIndex < module->memories.count; memoryIndex++) {
+        if (keyword != NULL) {
+            fputs(keyword, file);
+            fputc(' ', file);
+        }
+        fputs("wasmMemory ", file);
+        wasmCWriteFileMemoryName(file, module, module->memoryImports.length + memoryIndex, false);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInitMemories(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    fputs("static void initMemories(void) {\n", file);
+
+    {
+        U32 memoryIndex = 0;
+        for (; memoryIndex < module->memories.count; memoryIndex++) {
+            WasmMemory memory = module->memories.memories[memoryIndex];
+
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("wasmAllocateMemory(", file);
+            wasmCWriteFileMemoryName(file, module, module->memoryImports.length + memoryIndex, true);
+            fprintf(file, ", %u, %u);\n", memory.min, memory.max);
+        }
+    }
+
+    {
+        U32 dataSegmentIndex = 0;
+        for (; dataSegmentIndex < module->dataSegments.count; dataSegmentIndex++) {
+            WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("LOAD_DATA(", file);
+            wasmCWriteFileMemoryName(file, module, dataSegment.memoryIndex, false);
+            fputs(", ", file);
+            {
+                Buffer code = dataSegment.offset;
+                StringBuilder stringBuilder = emptyStringBuilder;
+
+                MUST (stringBuilderInitialize(&stringBuilder))
+                MUST (wasmCWriteConstantExpr(&stringBuilder, module, code))
+                fputs(stringBuilder.string, file);
+                stringBuilderFree(&stringBuilder);
+            }
+            fputs(", ", file);
+            wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
+            fprintf(file, ", %lu);\n", dataSegment.bytes.length);
+        }
+    }
+
+    fputs("}\n\n", file);
+
+    return true;
+}
+
+static
+void
+wasmCWriteTableImports(
+    FILE* file,
+    const WasmModule* module
+) {
+    U32 tableIndex = 0;
+    for (; tableIndex < module->tableImports.length; tableIndex++) {
+        fputs("extern wasmTable ", file);
+        wasmCWriteFileTableName(file, module, tableIndex, false);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteTables(
+    FILE* file,
+    const WasmModule* module,
+    const char* keyword
+) {
+    U32 tableIndex = 0;
+    for (; tableIndex < module->tables.count; tableIndex++) {
+        if (keyword != NULL) {
+            fputs(keyword, file);
+            fputc(' ', file);
+        }
+        fputs("wasmTable ", file);
+        wasmCWriteFileTableName(file, module, module->tableImports.length + tableIndex, false);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteTags(
+    FILE* file,
+    const WasmModule* module,
+    const char* keyword
+) {
+    U32 tagIndex = 0;
+    for (; tagIndex < module->tags.count; tagIndex++) {
+        if (keyword != NULL) {
+            fputs(keyword, file);
+            fputc(' ', file);
+        }
+        fputs("wasmTag ", file);
+        wasmCWriteFileTagName(file, tagIndex);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteFileNamedParameters(
+    FILE* file,
+    WasmFunctionType functionType
+);
+
+static
+void
+wasmCWriteFileArguments(
+    FILE* file,
+    WasmFunctionType functionType
+);
+
+static
+void
+wasmCWriteFileEntryFunctionSignature(
+    FILE* file,
+    const WasmModule* module,
+    U32 functionIndex
+) {
+    const WasmFunctionType functionType =
+        module->functionTypes.functionTypes[wasmCGetFunctionTypeIndex(module, functionIndex)];
+    fputs(wasmCGetReturnType(functionType), file);
+    fputc(' ', file);
+    wasmCWriteFileEntryName(file, module, functionIndex, false);
+    wasmCWriteFileNamedParameters(file, functionType);
+}
+
+/*
+ * The arguments of pending tail calls, the thunks which make them (see wasmCWriteTailCall),
+ * and the entry functions of wasmCIsTailCallEntry
+ */
+static
+void
+wasmCWriteTailCallDeclarations(
+    FILE* file,
+    const WasmModule* module,
+    const char* keyword
+) {
+    U32 functionTypeIndex = 0;
+    U32 functionIndex = 0;
+    if (!tailCalls.any) {
+        return;
+    }
+    for (; functionTypeIndex < module->functionTypes.count; functionTypeIndex++) {
+        const WasmFunctionType functionType = module->functionTypes.functionTypes[functionTypeIndex];
+        U32 parameterIndex = 0;
+        if (!tailCalls.types[functionTypeIndex]) {
+            continue;
+        }
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            fputs(keyword, file);
+            fputc(' ', file);
+            fputs(valueTypeNames[functionType.parameterTypes[parameterIndex]], file);
+            fputc(' ', file);
+            wasmCWriteFileTailCallArgumentName(file, functionTypeIndex, parameterIndex);
+            fputs(";\n", file);
+        }
+        if (keyword == keywordStatic) {
+            fputs("static ", file);
+        }
+        fputs(wasmCGetReturnType(functionType), file);
+        fputc(' ', file);
+        wasmCWriteFileTailCallName(file, functionTypeIndex);
+        fputs("(void);\n\n", file);
+    }
+
+    for (functionIndex = 0; functionIndex < module->functions.count; functionIndex++) {
+        const U32 moduleFunctionIndex = module->functionImports.length + functionIndex;
+        if (!wasmCIsTailCallEntry(module, moduleFunctionIndex)) {
+            continue;
+        }
+        if (keyword == keywordStatic) {
+            fputs("static ", file);
+        }
+        wasmCWriteFileEntryFunctionSignature(file, module, moduleFunctionIndex);
+        fputs(";\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteTailCallThunks(
+    FILE* file,
+    const WasmModule* module,
+    bool parallel,
+    bool pretty
+) {
+    U32 functionTypeIndex = 0;
+    if (!tailCalls.any) {
+        return;
+    }
+    for (; functionTypeIndex < module->functionTypes.count; functionTypeIndex++) {
+        const WasmFunctionType functionType = module->functionTypes.functionTypes[functionTypeIndex];
+        U32 parameterIndex = 0;
+        if (!tailCalls.types[functionTypeIndex]) {
+            continue;
+        }
+        /* A single file has the definitions of the arguments in its declarations */
+        if (parallel) {
+            for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+                fputs(valueTypeNames[functionType.parameterTypes[parameterIndex]], file);
+                fputc(' ', file);
+                wasmCWriteFileTailCallArgumentName(file, functionTypeIndex, parameterIndex);
+                fputs(";\n", file);
+            }
+            parameterIndex = 0;
+        }
+        fputs(wasmCGetReturnType(functionType), file);
+        fputc(' ', file);
+        wasmCWriteFileTailCallName(file, functionTypeIndex);
+        fputs("(void) {\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        if (functionType.resultCount > 0) {
+            fputs("return ", file);
+        }
+        fputs("((", file);
+        fputs(wasmCGetReturnType(functionType), file);
+        fputs(" (*)", file);
+        wasmCWriteFileParameters(file, functionType, pretty);
+        fputs(") wasmTailCallee)(", file);
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            if (parameterIndex > 0) {
+                fputs(", ", file);
+            }
+            wasmCWriteFileTailCallArgumentName(file, functionTypeIndex, parameterIndex);
+        }
+        fputs(");\n}\n\n", file);
+    }
+}
+
+static
+void
+wasmCWriteTailCallEntries(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 functionIndex = 0;
+    for (; functionIndex < module->functions.count; functionIndex++) {
+        const U32 moduleFunctionIndex = module->functionImports.length + functionIndex;
+        const WasmFunctionType functionType =
+            module->functionTypes.functionTypes[module->functions.functions[functionIndex].functionTypeIndex];
+        if (!wasmCIsTailCallEntry(module, moduleFunctionIndex)) {
+            continue;
+        }
+        wasmCWriteFileEntryFunctionSignature(file, module, moduleFunctionIndex);
+        fputs(" {\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        if (functionType.resultCount > 0) {
+            const char* resultTypeName = valueTypeNames[functionType.resultTypes[0]];
+            fputs(resultTypeName, file);
+            fputs(" result = ", file);
+            wasmCWriteFileFunctionName(file, module, moduleFunctionIndex, false);
+            wasmCWriteFileArguments(file, functionType);
+            fputs(";\n", file);
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fprintf(file, "WASM_TAIL_CALLS(%s, result);\n", resultTypeName);
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("return result;\n", file);
+        } else {
+            wasmCWriteFileFunctionName(file, module, moduleFunctionIndex, false);
+            wasmCWriteFileArguments(file, functionType);
+            fputs(";\n", file);
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("WASM_TAIL_CALLS_VOID();\n", file);
+        }
+        fputs("}\n\n", file);
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInitTables(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    fputs("static void initTables(void) {\n", file);
+
+    if (module->elementSegments.count > 0) {
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fputs("U32 offset;\n", file);
+    }
+
+    {
+        U32 tableIndex = 0;
+        for (; tableIndex < module->tables.count; tableIndex++) {
+            WasmTable table = module->tables.tables[tableIndex];
+
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("wasmAllocateTable(", file);
+            wasmCWriteFileTableName(file, module, module->tableImports.length + tableIndex, true);
+            fprintf(file, ", %u, %u);\n", table.min, table.max);
+        }
+    }
+
+
+    {
+        U32 elementSegmentIndex = 0;
+        for (; elementSegmentIndex < module->elementSegments.count; elementSegmentIndex++) {
+            WasmElementSegment elementSegment = module->elementSegments.elementSegments[elementSegmentIndex];
+
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("offset = ", file);
+            {
+                Buffer code = elementSegment.offset;
+                StringBuilder stringBuilder = emptyStringBuilder;
+
+                MUST (stringBuilderInitialize(&stringBuilder))
+                MUST (wasmCWriteConstantExpr(&stringBuilder, module, code))
+                fputs(stringBuilder.string, file);
+                stringBuilderFree(&stringBuilder);
+            }
+            fputs(";\n", file);
+
+            {
+                U32 functionIndexIndex = 0;
+                for (; functionIndexIndex < elementSegment.functionIndexCount; functionIndexIndex++) {
+                    U32 functionIndex = elementSegment.functionIndices[functionIndexIndex];
+                    if (pretty) {
+                        fputs(indentation, file);
+                    }
+                    wasmCWriteFileTableName(file, module, elementSegment.tableIndex, false);
+                    fprintf(file, ".data[offset + %u] = (wasmFunc)(", functionIndexIndex);
+                    wasmCWriteFileFunctionName(file, module, functionIndex, true);
+                    fputs(");\n", file);
+                }
+            }
+        }
+    }
+
+    fputs("}\n\n", file);
+
+    return true;
+}
+
+static
+void
+wasmCWriteBaseInclude(
+    FILE* file,
+    const WasmModule* module
+) {
+    U32 fixedMemoryPages = 0;
+    if (wasmCGetFixedMemoryPages(module, &fixedMemoryPages)) {
+        fprintf(file, "#define WASM_FIXED_MEMORY_PAGES %uu\n", fixedMemoryPages);
+    }
+    if (wasmCIsMemory64(module)) {
+        fputs("#define WASM_MEMORY64 1\n", file);
+    }
+    fputs("#include \"w2c2_base.h\"\n\n", file);
+}
+
+static
+void
+wasmCWriteFileNamedParameters(
+    FILE* file,
+    WasmFunctionType functionType
+) {
+    U32 parameterIndex = 0;
+    fputc('(', file);
+    for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+        if (parameterIndex > 0) {
+            fputs(", ", file);
+        }
+        fputs(valueTypeNames[functionType.parameterTypes[parameterIndex]], file);
+        fputc(' ', file);
+        wasmCWriteFileLocalName(file, parameterIndex);
+    }
+    if (functionType.parameterCount == 0) {
+        fputs("void", file);
+    }
+    fputc(')', file);
+}
+
+static
+void
+wasmCWriteFileArguments(
+    FILE* file,
+    WasmFunctionType functionType
+) {
+    U32 parameterIndex = 0;
+    fputc('(', file);
+    for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+        if (parameterIndex > 0) {
+            fputs(", ", file);
+        }
+        wasmCWriteFileLocalName(file, parameterIndex);
+    }
+    fputc(')', file);
+}
+
+/*
+ * Writes the name under which linked modules call an exported function
+ */
+static
+void
+wasmCWriteFileLinkedExportName(
+    FILE* file,
+    WasmExport export
+) {
+    fputs(functionNamePrefix, file);
+    fputc('_', file);
+    wasmCWriteFileEscaped(file, linkage.name);
+    fputc('_', file);
+    wasmCWriteFileEscaped(file, export.name);
+}
+
+static
+bool
+wasmCIsLinkedExport(
+    const WasmModule* module,
+    WasmExport export
+) {
+    return linkage.name != NULL
+        && export.kind == wasmExportKindFunction
+        && export.index >= module->functionImports.length;
+}
+
+static
+void
+wasmCWriteLinkedExportDeclarations(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 exportIndex = 0;
+    for (; exportIndex < module->exports.count; exportIndex++) {
+        const WasmExport export = module->exports.exports[exportIndex];
+        WasmFunctionType functionType;
+        if (!wasmCIsLinkedExport(module, export)) {
+            continue;
+        }
+        functionType = module->functionTypes.functionTypes[
+            module->functions.functions[export.index - module->functionImports.length].functionTypeIndex
+        ];
+        fputs(wasmCGetReturnType(functionType), file);
+        fputc(' ', file);
+        wasmCWriteFileLinkedExportName(file, export);
+        wasmCWriteFileParameters(file, functionType, pretty);
+        fputs(";\n\n", file);
+    }
+}
+
+/*
+ * Exported functions of a named module (-n) get external definitions,
+ * which linked modules call directly, and which LTO can inline
+ */
+static
+void
+wasmCWriteLinkedExports(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    U32 exportIndex = 0;
+    for (; exportIndex < module->exports.count; exportIndex++) {
+        const WasmExport export = module->exports.exports[exportIndex];
+        WasmFunctionType functionType;
+        if (!wasmCIsLinkedExport(module, export)) {
+            continue;
+        }
+        functionType = module->functionTypes.functionTypes[
+            module->functions.functions[export.index - module->functionImports.length].functionTypeIndex
+        ];
+        fputs(wasmCGetReturnType(functionType), file);
+        fputc(' ', file);
+        wasmCWriteFileLinkedExportName(file, export);
+        wasmCWriteFileNamedParameters(file, functionType);
+        fputs(" {\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        if (functionType.resultCount > 0) {
+            fputs("return ", file);
+        }
+        wasmCWriteFileEntryName(file, module, export.index, false);
+        wasmCWriteFileArguments(file, functionType);
+        fputs(";\n}\n\n", file);
+    }
+}
+
+/*
+ * The function imports of a prefixed module (-x), which no linked module provides,
+ * call the host's implementation, with the module's memory as the one host functions access
+ */
+static
+void
+wasmCWriteImportStubs(
+    FILE* file,
+    const WasmModule* module,
+    bool pretty
+) {
+    bool hasMemory = module->memoryImports.length + module->memories.count > 0;
+    U32 functionIndex = 0;
+
+    if (linkage.prefix == NULL) {
+        return;
+    }
+
+    for (; functionIndex < module->functionImports.length; functionIndex++) {
+        const WasmFunctionImport import = module->functionImports.imports[functionIndex];
+        const WasmFunctionType functionType =
+            module->functionTypes.functionTypes[import.functionTypeIndex];
+        const char* returnType = wasmCGetReturnType(functionType);
+        bool hasResult = functionType.resultCount > 0;
+
+        if (wasmCIsLinkedModule(import.module)) {
+            continue;
+        }
+
+        /* The host's implementation, as used by an unprefixed module */
+        fprintf(file, "extern %s (*%s_", returnType, functionNamePrefix);
+        wasmCWriteFileEscaped(file, import.module);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, import.name);
+        fputc(')', file);
+        wasmCWriteFileParameters(file, functionType, pretty);
+        fputs(";\n\n", file);
+
+        fprintf(file, "static %s import%u", returnType, functionIndex);
+        wasmCWriteFileNamedParameters(file, functionType);
+        fputs(" {\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fputs("wasmMemory* memory = wasmImportMemory;\n", file);
+        if (hasResult) {
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fprintf(file, "%s result;\n", returnType);
+        }
+        if (hasMemory) {
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("wasmImportMemory = ", file);
+            wasmCWriteFileMemoryName(file, module, 0, true);
+            fputs(";\n", file);
+        }
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        if (hasResult) {
+            fputs("result = ", file);
+        }
+        fprintf(file, "(*%s_", functionNamePrefix);
+        wasmCWriteFileEscaped(file, import.module);
+        fputc('_', file);
+        wasmCWriteFileEscaped(file, import.name);
+        fputc(')', file);
+        wasmCWriteFileArguments(file, functionType);
+        fputs(";\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fputs("wasmImportMemory = memory;\n", file);
+        if (hasResult) {
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("return result;\n", file);
+        }
+        fputs("}\n\n", file);
+
+        fputs(returnType, file);
+        fputs(" (*", file);
+        wasmCWriteFileFunctionName(file, module, functionIndex, true);
+        fputc(')', file);
+        wasmCWriteFileParameters(file, functionType, pretty);
+        fprintf(file, " = import%u;\n\n", functionIndex);
+    }
+}
+
+static
+void
+wasmCWriteModuleDeclarations(
+    FILE* file,
+    const WasmModule* module,
+    bool parallel,
+    bool pretty
+) {
+    const char* keyword = parallel ? keywordExtern : keywordStatic;
+
+    wasmCWriteFunctionImports(file, module, pretty);
+    wasmCWriteFunctionDeclarations(file, module, pretty);
+
+    wasmCWriteMemoryImports(file, module);
+    wasmCWriteMemories(file, module, keyword);
+
+    wasmCWriteTableImports(file, module);
+    wasmCWriteTables(file, module, keyword);
+
+    wasmCWriteGlobalImports(file, module);
+    wasmCWriteGlobals(file, module, keyword);
+
+    wasmCWriteTags(file, module, keyword);
+
+    wasmCWriteTailCallDeclarations(file, module, keyword);
+
+    wasmCWriteExports(file, module, pretty, true);
+
+    wasmCWriteLinkedExportDeclarations(file, module, pretty);
+}
+
+static
+void
+wasmCWriteInitFunction(
+    const WasmModule* module,
+    FILE* file,
+    bool pretty
+) {
+    fputs("void ", file);
+    wasmCWriteFileSymbolPrefix(file);
+    fputs("init(void) {\n", file);
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs("initMemories();\n", file);
+
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs("initTables();\n", file);
+
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs("initGlobals();\n", file);
+
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs("initExports();\n", file);
+
+    if (module->hasStartFunction) {
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        wasmCWriteFileEntryName(file, module, module->startFunctionIndex, false);
+        fputs("();\n", file);
+    }
+
+    fputs("}\n", file);
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteDeclarations(
+    const WasmModule* module,
+    FILE* singleFile,
+    bool pretty
+) {
+    bool parallel = singleFile == NULL;
+    FILE* file = singleFile;
+
+    if (parallel) {
+        file = fopen("decls.h", "w");
+        if (file == NULL) {
+            return false;
+        }
+        wasmCWriteBaseInclude(file, module);
+    }
+
+    wasmCWriteModuleDeclarations(file, module, parallel, pretty);
+
+    if (parallel) {
+        fclose(file);
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInits(
+    const WasmModule* module,
+    FILE* singleFile,
+    bool pretty
+) {
+    bool parallel = singleFile == NULL;
+    FILE* file = singleFile;
+
+    if (parallel) {
+        file = fopen("inits.c", "w");
+        if (file == NULL) {
+            return false;
+        }
+        wasmCWriteBaseInclude(file, module);
+        fputs("#include \"decls.h\"\n\n", file);
+    }
+
+    wasmCWriteDataSegments(file, module, pretty);
+
+    if (parallel) {
+        wasmCWriteMemories(file, module, NULL);
+        wasmCWriteTables(file, module, NULL);
+        wasmCWriteGlobals(file, module, NULL);
+        wasmCWriteTags(file, module, NULL);
+    }
+
+    wasmCWriteTailCallThunks(file, module, parallel, pretty);
+    wasmCWriteTailCallEntries(file, module, pretty);
+
+    MUST (wasmCWriteInitMemories(file, module, pretty))
+    MUST (wasmCWriteInitTables(file, module, pretty))
+    wasmCWriteInitExports(file, module, pretty);
+    MUST (wasmCWriteInitGlobals(file, module, pretty))
+
+    wasmCWriteInitFunction(module, file, pretty);
+
+    wasmCWriteImportStubs(file, module, pretty);
+    wasmCWriteLinkedExports(file, module, pretty);
+
+    if (parallel) {
+        fclose(file);
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteImplementationFile(
+    const WasmModule* module,
+    U32 fileIndex,
+    U32 functionsPerFile,
+    FILE* singleFile,
+    U32 startFunctionIndex,
+    bool pretty
+) {
+    U32 functionCount = module->functions.count;
+    bool parallel = singleFile == NULL;
+    FILE* file = singleFile;
+    FILE* hotFile = NULL;
+
+    U32 endIndex = startFunctionIndex + functionsPerFile;
+    if (endIndex > functionCount) {
+        endIndex = functionCount;
+    }
+
+    /* Do not create empty files */
+    if (startFunctionIndex > endIndex) {
+        return true;
+    }
+
+    if (parallel) {
+        char filename[2048];
+        sprintf(filename, "%05d.c", fileIndex);
+        file = wasmCOpenImplementationFile(module, filename);
+        if (file == NULL) {
+            return false;
+        }
+    }
+
+    {
+        MUST (wasmCWriteFunctionImplementations(
+            file,
+            parallel ? &hotFile : NULL,
+            fileIndex,
+            module,
+            startFunctionIndex,
+            endIndex,
+            pretty
+        ))
+    }
+
+    if (parallel) {
+        fclose(file);
+    }
+    if (hotFile != NULL) {
+        fclose(hotFile);
+    }
+
+    return true;
+}
+
+typedef struct WasmCDeclarationsWriterJob {
+    pthread_t thread;
+    const WasmModule* module;
+    bool pretty;
+    bool result;
+} WasmCDeclarationsWriterJob;
+
+
+static
+void*
+wasmCDeclarationsWriterThread(
+    void* arg
+) {
+    WasmCDeclarationsWriterJob* job = (WasmCDeclarationsWriterJob *) arg;
+    bool result = wasmCWriteDeclarations(job->module, NULL, job->pretty);
+    if (!result) {
+        fprintf(stderr, "w2c2: failed to write declarations\n");
+    }
+    job->result = result;
+
+    return NULL;
+}
+
+/*
+ * Implementation files are handed out one at a time, so workers stay busy
+ * until the last file, even if the sizes of the functions vary a lot
+ */
+typedef struct WasmCImplementationQueue {
+    pthread_mutex_t mutex;
+    U32 nextFileIndex;
+    U32 fileCount;
+} WasmCImplementationQueue;
+
+typedef struct WasmCImplementationWriterJob {
+    pthread_t thread;
+    U32 jobIndex;
+    U32 functionsPerFile;
+    WasmCImplementationQueue* queue;
+    const WasmModule* module;
+    bool pretty;
+    bool result;
+} WasmCImplementationWriterJob;
+
+static
+void*
+wasmCImplementationWriterThread(
+    void* arg
+) {
+    WasmCImplementationWriterJob* job = (WasmCImplementationWriterJob*) arg;
+
+    U32 jobIndex = job->jobIndex;
+    U32 functionsPerFile = job->functionsPerFile;
+    WasmCImplementationQueue* queue = job->queue;
+    const WasmModule* module = job->module;
+    bool pretty = job->pretty;
+
+    while (true) {
+        U32 fileIndex = 0;
+        U32 startFunctionIndex = 0;
+        bool result = false;
+
+        pthread_mutex_lock(&queue->mutex);
+        fileIndex = queue->nextFileIndex;
+        if (fileIndex < queue->fileCount) {
+            queue->nextFileIndex++;
+        }
+        pthread_mutex_unlock(&queue->mutex);
+
+        if (fileIndex >= queue->fileCount) {
+            break;
+        }
+
+        startFunctionIndex = fileIndex * functionsPerFile;
+
+        result = wasmCWriteImplementationFile(
+            module,
+            fileIndex,
+            functionsPerFile,
+            NULL,
+            startFunctionIndex,
+            pretty
+        );
+        if (!result) {
+            fprintf(
+                stderr,
+                "w2c2: failed to write implementation (job %d, file %d, start func %d)\n",
+                jobIndex,
+                fileIndex,
+                startFunctionIndex
+            );
+            job->result = false;
+            return NULL;
+        }
+    }
+
+    job->result = true;
+
+    return NULL;
+}
+
+typedef struct WasmCInitsWriterJob {
+    pthread_t thread;
+    const WasmModule* module;
+    bool pretty;
+    bool result;
+} WasmCInitsWriterJob;
+
+
+static
+void*
+wasmCInitsWriterThread(
+    void* arg
+) {
+    WasmCInitsWriterJob* job = (WasmCInitsWriterJob *) arg;
+    bool result = wasmCWriteInits(job->module, NULL, job->pretty);
+    if (!result) {
+        fprintf(stderr, "w2c2: failed to write inits\n");
+    }
+    job->result = result;
+    return NULL;
+}
+
+static
+WasmFunctionType
+wasmCGetFunctionType(
+    const WasmModule* module,
+    U32 functionIndex
+) {
+    U32 functionImportCount = module->functionImports.length;
+    if (functionIndex < functionImportCount) {
+        const WasmFunctionImport import = module->functionImports.imports[functionIndex];
+        return module->functionTypes.functionTypes[import.functionTypeIndex];
+    } else {
+        const WasmFunction function = module->functions.functions[functionIndex - functionImportCount];
+        return module->functionTypes.functionTypes[function.functionTypeIndex];
+    }
+}
+
+static
+void
+wasmCWriteExportWrapperSignature(
+    FILE* file,
+    const WasmExport export,
+    const WasmFunctionType functionType
+) {
+    U32 parameterIndex = 0;
+
+    fputs("bool wasm_", file);
+    wasmCWriteFileEscaped(file, export.name);
+    fputc('(', file);
+    for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+        const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+        fputs(valueTypeNames[parameterType], file);
+        fputc(' ', file);
+        wasmCWriteFileLocalName(file, parameterIndex);
+        fputs(", ", file);
+    }
+    if (functionType.resultCount == 1) {
+        fputs(valueTypeNames[functionType.resultTypes[0]], file);
+        fputs("* result, ", file);
+    }
+    fputs("Trap* trap)", file);
+}
+
+/*
+ * Only exported functions with at most one result get a wrapper
+ */
+static
+bool
+wasmCIsWrappedExport(
+    const WasmModule* module,
+    const WasmExport export
+) {
+    return export.kind == wasmExportKindFunction
+        && wasmCGetFunctionType(module, export.index).resultCount <= 1;
+}
+
+static
+bool
+wasmCIsInitializeExport(
+    const WasmModule* module,
+    const WasmExport export
+) {
+    if (export.kind != wasmExportKindFunction || strcmp(export.name, "_initialize") != 0) {
+        return false;
+    }
+    {
+        const WasmFunctionType functionType = wasmCGetFunctionType(module, export.index);
+        return functionType.parameterCount == 0 && functionType.resultCount == 0;
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteExportsHeader(
+    const WasmModule* module
+) {
+    U32 exportIndex = 0;
+
+    FILE* file = fopen("exports.h", "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    fputs("#ifndef W2C2_EXPORTS_H\n#define W2C2_EXPORTS_H\n\n", file);
+    wasmCWriteBaseInclude(file, module);
+
+    fputs(
+        "/*\n"
+        " * Trap-safe wrappers for the exported functions.\n"
+        " * They return false if the call trapped, and store the trap reason if trap is not NULL\n"
+        " */\n\n",
+        file
+    );
+
+    fputs("/* Initializes the module and runs its _initialize export, if any */\n", file);
+    fputs("bool wasmInstantiate(Trap* trap);\n\n", file);
+
+    for (; exportIndex < module->exports.count; exportIndex++) {
+        const WasmExport export = module->exports.exports[exportIndex];
+        if (!wasmCIsWrappedExport(module, export)) {
+            continue;
+        }
+        wasmCWriteExportWrapperSignature(file, export, wasmCGetFunctionType(module, export.index));
+        fputs(";\n\n", file);
+    }
+
+    fputs("#endif /* W2C2_EXPORTS_H */\n", file);
+
+    fclose(file);
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteExportsImplementation(
+    const WasmModule* module
+) {
+    U32 exportIndex = 0;
+    bool hasInitialize = false;
+
+    FILE* file = fopen("exports.c", "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    wasmCWriteBaseInclude(file, module);
+    fputs("#include \"decls.h\"\n", file);
+    fputs("#include \"exports.h\"\n\n", file);
+
+    fputs("extern void init(void);\n\n", file);
+    fputs("jmp_buf* wasmTrapTarget = NULL;\n\n", file);
+
+    for (; exportIndex < module->exports.count; exportIndex++) {
+        const WasmExport export = module->exports.exports[exportIndex];
+        WasmFunctionType functionType;
+        U32 parameterIndex = 0;
+
+        if (!wasmCIsWrappedExport(module, export)) {
+            continue;
+        }
+        if (wasmCIsInitializeExport(module, export)) {
+            hasInitialize = true;
+        }
+
+        functionType = wasmCGetFunctionType(module, export.index);
+
+        wasmCWriteExportWrapperSignature(file, export, functionType);
+        fputs(" {\n", file);
+        fputs(
+            "    jmp_buf target;\n"
+            "    jmp_buf* previousTarget = wasmTrapTarget;\n"
+            "    int code;\n"
+            "    wasmTrapTarget = &target;\n"
+            "    code = setjmp(target);\n"
+            "    if (code == 0) {\n"
+            "        ",
+            file
+        );
+        if (functionType.resultCount == 1) {
+            fputs("*result = ", file);
+        }
+        wasmCWriteFileEntryName(file, module, export.index, false);
+        fputc('(', file);
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            if (parameterIndex > 0) {
+                fputs(", ", file);
+            }
+            wasmCWriteFileLocalName(file, parameterIndex);
+        }
+        fputs(");\n", file);
+        if (module->tags.count > 0) {
+            fputs(
+                "        if (wasmPendingException.tag != NULL) {\n"
+                "            wasmPendingException.tag = NULL;\n"
+                "            code = trapUncaughtException + 1;\n"
+                "        }\n",
+                file
+            );
+        }
+        fputs(
+            "    }\n"
+            "    wasmTrapTarget = previousTarget;\n"
+            "    if (code != 0 && trap != NULL) {\n"
+            "        *trap = (Trap)(code - 1);\n"
+            "    }\n"
+            "    return code == 0;\n"
+            "}\n\n",
+            file
+        );
+    }
+
+    fputs("bool wasmInstantiate(Trap* trap) {\n", file);
+    fputs("    init();\n", file);
+    if (hasInitialize) {
+        fputs("    return wasm_X5Finitialize(trap);\n", file);
+    } else {
+        fputs("    (void)trap;\n", file);
+        fputs("    return true;\n", file);
+    }
+    fputs("}\n", file);
+
+    fclose(file);
+
+    return true;
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmCWriteModule(
+    const char* outputPath,
+    const WasmModule* module,
+    U32 jobCount,
+    U32 functionsPerFile,
+    bool pretty,
+    bool exportWrappers,
+    const WasmCLinkage* moduleLinkage,
+    const WasmCTiering* moduleTiering
+) {
+    bool parallel = jobCount > 1;
+    FILE *singleFile = NULL;
+
+    U32 functionCount = module->functions.count;
+    WasmCImplementationQueue implementationQueue;
+
+    WasmCInitsWriterJob initsJob;
+    WasmCDeclarationsWriterJob declarationsJob;
+
+    WasmCImplementationWriterJob* implementationJobs =
+        calloc(jobCount * sizeof(WasmCImplementationWriterJob), 1);
+    if (implementationJobs == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate job\n");
+        return false;
+    }
+
+    linkage = *moduleLinkage;
+    tiering = *moduleTiering;
+    if (tiering.hotLoops) {
+        MUST (wasmCFindHotLoops(module))
+    }
+    MUST (wasmCFindTailCalls(module))
+
+    implementationQueue.nextFileIndex = 0;
+    implementationQueue.fileCount = 0;
+    if (functionsPerFile > 0) {
+        implementationQueue.fileCount =
+            (functionCount + functionsPerFile - 1) / functionsPerFile;
+    }
+
+    initsJob.module = module;
+    initsJob.pretty = pretty;
+
+    declarationsJob.module = module;
+    declarationsJob.pretty = pretty;
+
+    /* Change to output directory / open single file (if non-parallel) */
+
+    if (parallel) {
+        if (chdir(outputPath) < 0) {
+            fprintf(stderr, "w2c2: failed to change to output directory %s\n", outputPath);
+            return false;
+        }
+    } else {
+        if (outputPath == NULL) {
+            singleFile = stdout;
+        } else {
+            singleFile = fopen(outputPath, "w");
+            if (singleFile == NULL) {
+                fprintf(stderr, "w2c2: failed to open output file %s\n", outputPath);
+                return false;
+            }
+        }
+        wasmCWriteBaseInclude(singleFile, module);
+    }
+
+    /* Write declarations */
+
+    if (parallel) {
+        int err = pthread_create(
+            &declarationsJob.thread,
+            NULL,
+            wasmCDeclarationsWriterThread,
+            &declarationsJob
+        );
+        if (err) {
+            fprintf(stderr, "w2c2: failed to create declarations thread: %s\n", strerror(err));
+            return false;
+        }
+    } else {
+        if (!wasmCWriteDeclarations(module, singleFile, pretty)) {
+            fprintf(stderr, "w2c2: failed to write declarations\n");
+            return false;
+        }
+    }
+
+    /* Write implementations */
+
+    if (parallel) {
+        U32 jobIndex = 0;
+        pthread_mutex_init(&implementationQueue.mutex, NULL);
+        for (; jobIndex < jobCount; jobIndex++) {
+            WasmCImplementationWriterJob job;
+            job.jobIndex = jobIndex;
+            job.functionsPerFile = functionsPerFile;
+            job.queue = &implementationQueue;
+            job.module = module;
+            job.pretty = pretty;
+            implementationJobs[jobIndex] = job;
+
+            {
+                int err = pthread_create(
+                    &implementationJobs[jobIndex].thread,
+                    NULL,
+                    wasmCImplementationWriterThread,
+                    &implementationJobs[jobIndex]
+                );
+                if (err) {
+                    fprintf(stderr, "w2c2: failed to create implementations thread: %s\n", strerror(err));
+                    return false;
+                }
+            }
+        }
+    } else {
+        MUST (wasmCWriteImplementationFile(
+            module,
+            0,
+            functionsPerFile,
+            singleFile,
+            0,
+            pretty
+        ))
+    }
+
+    /* Write initializations code */
+
+    if (parallel) {
+        int err = pthread_create(
+            &initsJob.thread,
+            NULL,
+            wasmCInitsWriterThread,
+            &initsJob
+        );
+        if (err) {
+            fprintf(stderr, "w2c2: failed to create inits thread: %s\n", strerror(err));
+            return false;
+        }
+    } else {
+        if (!wasmCWriteInits(module, singleFile, pretty)) {
+            fprintf(stderr, "w2c2: failed to write inits\n");
+            return false;
+        }
+    }
+
+    /* Wait for threads */
+
+    if (parallel) {
+        /* Declarations */
+        {
+            int err = pthread_join(declarationsJob.thread, NULL);
+            if (err) {
+                fprintf(stderr, "w2c2: failed to join declarations thread: %s\n", strerror(err));
+                return false;
+            }
+
+            MUST (declarationsJob.result)
+        }
+
+        /* Implementations */
+        {
+            U32 jobIndex = 0;
+            for (; jobIndex < jobCount; jobIndex++) {
+                WasmCImplementationWriterJob* job = &implementationJobs[jobIndex];
+
+                int err = pthread_join(job->thread, NULL);
+                if (err) {
+                    fprintf(stderr, "w2c2: failed to join implementation thread: %s\n", strerror(err));
+                    return false;
+                }
+
+                MUST (job->result)
+            }
+
+            pthread_mutex_destroy(&implementationQueue.mutex);
+        }
+
+        /* Inits */
+        {
+            int err = pthread_join(initsJob.thread, NULL);
+            if (err) {
+                fprintf(stderr, "w2c2: failed to join inits thread: %s\n", strerror(err));
+                return false;
+            }
+
+            MUST (initsJob.result)
+        }
+    }
+
+    /* Write trap-safe export wrappers */
+
+    if (parallel && exportWrappers) {
+        if (!wasmCWriteExportsHeader(module) || !wasmCWriteExportsImplementation(module)) {
+            fprintf(stderr, "w2c2: failed to write export wrappers\n");
+            return false;
+        }
+    }
+
+    /* Close single file */
+
+    if (!parallel && outputPath != NULL) {
+        fclose(singleFile);
+    }
+
+    if (implementationJobs != NULL) {
+        free(implementationJobs);
+    }
+
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef W2C2_C_H
+#define W2C2_C_H
+
+#include "w2c2_base.h"
+#include "module.h"
+
+/*
+ * WasmCLinkage describes how a module is linked with other translated modules into one program
+ */
+typedef struct WasmCLinkage {
+    /* Prefix for the global symbols of the module, or NULL */
+    const char* prefix;
+    /* Module name under which other modules import the exported functions, or NULL */
+    const char* name;
+    /* Modules whose exported functions are called directly instead of through import pointers */
+    char** linkedModules;
+    U32 linkedModuleCount;
+} WasmCLinkage;
+
+static const WasmCLinkage wasmEmptyCLinkage = {NULL, NULL, NULL, 0};
+
+/*
+ * WasmCTiering selects hot functions, which are written to separate hot_*.c files,
+ * so they can be compiled with more optimization than the rest of the module
+ */
+typedef struct WasmCTiering {
+    /* Hot functions from a profile, indexed by function index without imports, or NULL */
+    bool* hotFunctions;
+    /* Whether functions containing a loop, or called inside one, are hot */
+    bool hotLoops;
+} WasmCTiering;
+
+static const WasmCTiering wasmEmptyCTiering = {NULL, false};
+
+bool
+WARN_UNUSED_RESULT
+wasmCWriteModule(
+    const char* outputPath,
+    const WasmModule* module,
+    U32 jobCount,
+    U32 functionsPerFile,
+    bool pretty,
+    bool exportWrappers,
+    const WasmCLinkage* linkage,
+    const WasmCTiering* tiering
+);
+
+#endif /* W2C2_C_H */
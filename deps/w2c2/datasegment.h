@@ -0,0 +1,16 @@
+#ifndef W2C2_DATASEGMENT_H
+#define W2C2_DATASEGMENT_H
+
+#include "w2c2_base.h"
+#include "buffer.h"
+#include "valuetype.h"
+
+typedef struct WasmDataSegment {
+    U32 memoryIndex;
+    Buffer offset;
+    Buffer bytes;
+} WasmDataSegment;
+
+static const WasmDataSegment wasmEmptyDataSegment = {0, {0, false}};
+
+#endif /* W2C2_DATASEGMENT_H */
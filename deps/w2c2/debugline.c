@@ -0,0 +1,718 @@
+#include <stdlib.h>
+#include <string.h>
+#include "debugline.h"
+#include "leb128.h"
+
+/* Line number program opcodes, see DWARF 5, section 6.2.5 */
+
+#define DW_LNS_copy 1
+#define DW_LNS_advance_pc 2
+#define DW_LNS_advance_line 3
+#define DW_LNS_set_file 4
+#define DW_LNS_const_add_pc 8
+#define DW_LNS_fixed_advance_pc 9
+
+#define DW_LNE_end_sequence 1
+#define DW_LNE_set_address 2
+#define DW_LNE_define_file 3
+
+/* Entry formats of DWARF 5 line table headers, see section 6.2.4.1 */
+
+#define DW_LNCT_path 1
+#define DW_LNCT_directory_index 2
+
+#define DW_FORM_block2 0x03
+#define DW_FORM_block4 0x04
+#define DW_FORM_data2 0x05
+#define DW_FORM_data4 0x06
+#define DW_FORM_data8 0x07
+#define DW_FORM_string 0x08
+#define DW_FORM_block 0x09
+#define DW_FORM_block1 0x0a
+#define DW_FORM_data1 0x0b
+#define DW_FORM_strp 0x0e
+#define DW_FORM_udata 0x0f
+#define DW_FORM_data16 0x1e
+#define DW_FORM_line_strp 0x1f
+
+typedef struct WasmDebugLineSequence {
+    U32 address;
+    U32 firstLine;
+    U32 lineCount;
+} WasmDebugLineSequence;
+
+typedef struct WasmDebugLinesBuilder {
+    const WasmDebugSections* sections;
+    WasmDebugLine* lines;
+    U32 lineCount;
+    U32 lineCapacity;
+    WasmDebugLineSequence* sequences;
+    U32 sequenceCount;
+    U32 sequenceCapacity;
+    char** files;
+    U32 fileCount;
+    U32 fileCapacity;
+} WasmDebugLinesBuilder;
+
+/* The header of the compilation unit being read */
+typedef struct WasmDebugLineUnit {
+    U16 version;
+    bool dwarf64;
+    U8 addressSize;
+    U8 minimumInstructionLength;
+    I8 lineBase;
+    U8 lineRange;
+    U8 opcodeBase;
+    const U8* standardOpcodeLengths;
+    const char** directories;
+    U32 directoryCount;
+    /* Index of the unit's first file in the builder's file table */
+    U32 firstFile;
+} WasmDebugLineUnit;
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugReadFixed(
+    Buffer* buffer,
+    U32 size,
+    U64* result
+) {
+    U64 value = 0;
+    U32 index = 0;
+
+    MUST (size <= 8 && buffer->length >= size)
+
+    /* WebAssembly DWARF is little-endian */
+    for (; index < size; index++) {
+        value |= (U64) buffer->data[index] << (8 * index);
+    }
+    bufferSkipUnchecked(buffer, size);
+
+    *result = value;
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugReadU32(
+    Buffer* buffer,
+    U32* result
+) {
+    U64 value = 0;
+    MUST (leb128ReadU64(buffer, &value) > 0)
+    MUST (value <= 0xFFFFFFFFull)
+    *result = (U32) value;
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugReadString(
+    Buffer* buffer,
+    const char** result
+) {
+    const U8* end = memchr(buffer->data, 0, buffer->length);
+    MUST (end != NULL)
+    *result = (const char*) buffer->data;
+    bufferSkipUnchecked(buffer, (size_t) (end - buffer->data) + 1);
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugReadStringAt(
+    Buffer section,
+    U64 offset,
+    const char** result
+) {
+    MUST (offset < section.length)
+    bufferSkipUnchecked(&section, (size_t) offset);
+    return wasmDebugReadString(&section, result);
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesAddFile(
+    WasmDebugLinesBuilder* builder,
+    const WasmDebugLineUnit* unit,
+    const char* name,
+    U32 directoryIndex
+) {
+    const char* directory = NULL;
+    char* path = NULL;
+    size_t nameLength = strlen(name);
+    size_t directoryLength = 0;
+
+    if (builder->fileCount == builder->fileCapacity) {
+        U32 capacity = builder->fileCapacity ? builder->fileCapacity * 2 : 16;
+        char** files = realloc(builder->files, capacity * sizeof(char*));
+        MUST (files != NULL)
+        builder->files = files;
+        builder->fileCapacity = capacity;
+    }
+
+    if (name[0] != '/' && directoryIndex < unit->directoryCount) {
+        directory = unit->directories[directoryIndex];
+        directoryLength = strlen(directory);
+    }
+
+    path = malloc(directoryLength + 1 + nameLength + 1);
+    MUST (path != NULL)
+    if (directoryLength > 0) {
+        memcpy(path, directory, directoryLength);
+        path[directoryLength] = '/';
+        memcpy(path + directoryLength + 1, name, nameLength + 1);
+    } else {
+        memcpy(path, name, nameLength + 1);
+    }
+
+    builder->files[builder->fileCount++] = path;
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesAddLine(
+    WasmDebugLinesBuilder* builder,
+    U32 address,
+    U32 fileIndex,
+    U32 line,
+    bool end
+) {
+    WasmDebugLine* row = NULL;
+
+    if (builder->lineCount == builder->lineCapacity) {
+        U32 capacity = builder->lineCapacity ? builder->lineCapacity * 2 : 1024;
+        WasmDebugLine* lines = realloc(builder->lines, capacity * sizeof(WasmDebugLine));
+        MUST (lines != NULL)
+        builder->lines = lines;
+        builder->lineCapacity = capacity;
+    }
+
+    row = &builder->lines[builder->lineCount++];
+    row->address = address;
+    row->fileIndex = fileIndex;
+    row->line = line;
+    row->end = end;
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesAddSequence(
+    WasmDebugLinesBuilder* builder,
+    U32 firstLine
+) {
+    WasmDebugLineSequence* sequence = NULL;
+    U32 address = builder->lines[firstLine].address;
+
+    /*
+     * Linkers point the line tables of functions they removed to address 0 or -1,
+     * and no function body starts at 0 (the code section begins with the function count)
+     */
+    if (address == 0 || address >= 0xFFFFFFFEu) {
+        builder->lineCount = firstLine;
+        return true;
+    }
+
+    if (builder->sequenceCount == builder->sequenceCapacity) {
+        U32 capacity = builder->sequenceCapacity ? builder->sequenceCapacity * 2 : 64;
+        WasmDebugLineSequence* sequences =
+            realloc(builder->sequences, capacity * sizeof(WasmDebugLineSequence));
+        MUST (sequences != NULL)
+        builder->sequences = sequences;
+        builder->sequenceCapacity = capacity;
+    }
+
+    sequence = &builder->sequences[builder->sequenceCount++];
+    sequence->address = address;
+    sequence->firstLine = firstLine;
+    sequence->lineCount = builder->lineCount - firstLine;
+    return true;
+}
+
+/* Reads a DWARF 5 directory or file name table */
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesReadEntries(
+    WasmDebugLinesBuilder* builder,
+    WasmDebugLineUnit* unit,
+    Buffer* buffer,
+    bool directories
+) {
+    U8 formatCount = 0;
+    U32 formats[2 * 16];
+    U32 entryCount = 0;
+    U32 entryIndex = 0;
+    U32 formatIndex = 0;
+
+    MUST (bufferReadByte(buffer, &formatCount))
+    MUST (formatCount <= 16)
+    for (; formatIndex < formatCount; formatIndex++) {
+        MUST (wasmDebugReadU32(buffer, &formats[2 * formatIndex]))
+        MUST (wasmDebugReadU32(buffer, &formats[2 * formatIndex + 1]))
+    }
+
+    MUST (wasmDebugReadU32(buffer, &entryCount))
+
+    if (directories) {
+        MUST (entryCount <= buffer->length)
+        unit->directories = calloc(entryCount + 1, sizeof(const char*));
+        MUST (unit->directories != NULL)
+        unit->directoryCount = entryCount;
+    }
+
+    for (; entryIndex < entryCount; entryIndex++) {
+        const char* path = "";
+        U32 directoryIndex = 0;
+
+        for (formatIndex = 0; formatIndex < formatCount; formatIndex++) {
+            U32 contentType = formats[2 * formatIndex];
+            U32 form = formats[2 * formatIndex + 1];
+            const char* string = NULL;
+            U64 value = 0;
+
+            switch (form) {
+                case DW_FORM_string:
+                    MUST (wasmDebugReadString(buffer, &string))
+                    break;
+                case DW_FORM_line_strp:
+                    MUST (wasmDebugReadFixed(buffer, unit->dwarf64 ? 8 : 4, &value))
+                    MUST (wasmDebugReadStringAt(builder->sections->lineString, value, &string))
+                    break;
+                case DW_FORM_strp:
+                    MUST (wasmDebugReadFixed(buffer, unit->dwarf64 ? 8 : 4, &value))
+                    MUST (wasmDebugReadStringAt(builder->sections->string, value, &string))
+                    break;
+                case DW_FORM_udata:
+                    MUST (leb128ReadU64(buffer, &value) > 0)
+                    break;
+                case DW_FORM_data1:
+                    MUST (wasmDebugReadFixed(buffer, 1, &value))
+                    break;
+                case DW_FORM_data2:
+                    MUST (wasmDebugReadFixed(buffer, 2, &value))
+                    break;
+                case DW_FORM_data4:
+                    MUST (wasmDebugReadFixed(buffer, 4, &value))
+                    break;
+                case DW_FORM_data8:
+                    MUST (wasmDebugReadFixed(buffer, 8, &value))
+                    break;
+                case DW_FORM_data16:
+                    MUST (buffer->length >= 16)
+                    bufferSkipUnchecked(buffer, 16);
+                    break;
+                case DW_FORM_block:
+                case DW_FORM_block1:
+                case DW_FORM_block2:
+                case DW_FORM_block4:
+                    if (form == DW_FORM_block) {
+                        MUST (leb128ReadU64(buffer, &value) > 0)
+                    } else {
+                        MUST (wasmDebugReadFixed(
+                            buffer,
+                            form == DW_FORM_block1 ? 1 : form == DW_FORM_block2 ? 2 : 4,
+                            &value
+                        ))
+                    }
+                    MUST (value <= buffer->length)
+                    bufferSkipUnchecked(buffer, (size_t) value);
+                    break;
+                default:
+                    return false;
+            }
+
+            if (contentType == DW_LNCT_path && string != NULL) {
+                path = string;
+            } else if (contentType == DW_LNCT_directory_index) {
+                directoryIndex = (U32) value;
+            }
+        }
+
+        if (directories) {
+            unit->directories[entryIndex] = path;
+        } else {
+            MUST (wasmDebugLinesAddFile(builder, unit, path, directoryIndex))
+        }
+    }
+
+    return true;
+}
+
+/* Reads the directory and file name tables of DWARF 2 to 4 */
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesReadLegacyEntries(
+    WasmDebugLinesBuilder* builder,
+    WasmDebugLineUnit* unit,
+    Buffer* buffer
+) {
+    U32 directoryCapacity = 16;
+
+    /* Directory 0 is the compilation directory, which is not part of the table */
+    unit->directories = calloc(directoryCapacity, sizeof(const char*));
+    MUST (unit->directories != NULL)
+    unit->directories[0] = "";
+    unit->directoryCount = 1;
+
+    while (true) {
+        const char* directory = NULL;
+        MUST (wasmDebugReadString(buffer, &directory))
+        if (directory[0] == '\0') {
+            break;
+        }
+        if (unit->directoryCount == directoryCapacity) {
+            const char** directories = NULL;
+            directoryCapacity *= 2;
+            directories = realloc((void*) unit->directories, directoryCapacity * sizeof(const char*));
+            MUST (directories != NULL)
+            unit->directories = directories;
+        }
+        unit->directories[unit->directoryCount++] = directory;
+    }
+
+    /* File 0 is the primary source file, which is not part of the table either */
+    MUST (wasmDebugLinesAddFile(builder, unit, "", 0))
+
+    while (true) {
+        const char* name = NULL;
+        U32 directoryIndex = 0;
+        U64 ignored = 0;
+
+        MUST (wasmDebugReadString(buffer, &name))
+        if (name[0] == '\0') {
+            break;
+        }
+        MUST (wasmDebugReadU32(buffer, &directoryIndex))
+        /* Modification time and length */
+        MUST (leb128ReadU64(buffer, &ignored) > 0)
+        MUST (leb128ReadU64(buffer, &ignored) > 0)
+
+        MUST (wasmDebugLinesAddFile(builder, unit, name, directoryIndex))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesRunProgram(
+    WasmDebugLinesBuilder* builder,
+    const WasmDebugLineUnit* unit,
+    Buffer* program
+) {
+    U32 unitFileCount = builder->fileCount - unit->firstFile;
+
+    U64 address = 0;
+    U32 file = 1;
+    I64 line = 1;
+    U32 sequenceStart = builder->lineCount;
+
+    while (!bufferAtEnd(program)) {
+        U8 opcode = 0;
+        bool emit = false;
+
+        MUST (bufferReadByte(program, &opcode))
+
+        if (opcode >= unit->opcodeBase) {
+            /* Special opcode */
+            U32 adjusted = (U32) (opcode - unit->opcodeBase);
+            address += (adjusted / unit->lineRange) * unit->minimumInstructionLength;
+            line += unit->lineBase + (I64) (adjusted % unit->lineRange);
+            emit = true;
+        } else if (opcode == 0) {
+            /* Extended opcode */
+            U64 length = 0;
+            U8 extendedOpcode = 0;
+            Buffer instruction;
+
+            MUST (leb128ReadU64(program, &length) > 0)
+            MUST (length > 0 && length <= program->length)
+            instruction.data = program->data;
+            instruction.length = (size_t) length;
+            bufferSkipUnchecked(program, (size_t) length);
+
+            MUST (bufferReadByte(&instruction, &extendedOpcode))
+            switch (extendedOpcode) {
+                case DW_LNE_end_sequence: {
+                    MUST (wasmDebugLinesAddLine(builder, (U32) address, 0, 0, true))
+                    MUST (wasmDebugLinesAddSequence(builder, sequenceStart))
+                    sequenceStart = builder->lineCount;
+                    address = 0;
+                    file = 1;
+                    line = 1;
+                    break;
+                }
+                case DW_LNE_set_address: {
+                    MUST (wasmDebugReadFixed(&instruction, (U32) instruction.length, &address))
+                    break;
+                }
+                case DW_LNE_define_file: {
+                    const char* name = NULL;
+                    U32 directoryIndex = 0;
+                    MUST (wasmDebugReadString(&instruction, &name))
+                    MUST (wasmDebugReadU32(&instruction, &directoryIndex))
+                    MUST (wasmDebugLinesAddFile(builder, unit, name, directoryIndex))
+                    unitFileCount++;
+                    break;
+                }
+                default:
+                    break;
+            }
+        } else {
+            /* Standard opcode */
+            switch (opcode) {
+                case DW_LNS_copy:
+                    emit = true;
+                    break;
+                case DW_LNS_advance_pc: {
+                    U64 advance = 0;
+                    MUST (leb128ReadU64(program, &advance) > 0)
+                    address += advance * unit->minimumInstructionLength;
+                    break;
+                }
+                case DW_LNS_advance_line: {
+                    I64 advance = 0;
+                    MUST (leb128ReadI64(program, &advance) > 0)
+                    line += advance;
+                    break;
+                }
+                case DW_LNS_set_file:
+                    MUST (wasmDebugReadU32(program, &file))
+                    break;
+                case DW_LNS_const_add_pc:
+                    address += ((255u - unit->opcodeBase) / unit->lineRange) * unit->minimumInstructionLength;
+                    break;
+                case DW_LNS_fixed_advance_pc: {
+                    U64 advance = 0;
+                    MUST (wasmDebugReadFixed(program, 2, &advance))
+                    address += advance;
+                    break;
+                }
+                default: {
+                    /* Skip the operands of opcodes which do not affect the address, file or line */
+                    U8 operandCount = unit->standardOpcodeLengths[opcode - 1];
+                    for (; operandCount > 0; operandCount--) {
+                        U64 ignored = 0;
+                        MUST (leb128ReadU64(program, &ignored) > 0)
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (emit) {
+            U32 fileIndex = (U32) -1;
+            if (file < unitFileCount) {
+                fileIndex = unit->firstFile + file;
+            }
+            if (line > 0 && line <= 0xFFFFFFFF && fileIndex != (U32) -1) {
+                MUST (wasmDebugLinesAddLine(builder, (U32) address, fileIndex, (U32) line, false))
+            }
+        }
+    }
+
+    /* Drop rows of an unterminated sequence */
+    builder->lineCount = sequenceStart;
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesReadUnit(
+    WasmDebugLinesBuilder* builder,
+    Buffer* buffer
+) {
+    WasmDebugLineUnit unit;
+    U64 unitLength = 0;
+    U64 headerLength = 0;
+    U8 defaultIsStatement = 0;
+    U8 lineBase = 0;
+    Buffer unitBuffer;
+    Buffer program;
+    bool result = false;
+
+    memset(&unit, 0, sizeof(unit));
+
+    MUST (wasmDebugReadFixed(buffer, 4, &unitLength))
+    if (unitLength == 0xFFFFFFFFull) {
+        unit.dwarf64 = true;
+        MUST (wasmDebugReadFixed(buffer, 8, &unitLength))
+    }
+    MUST (unitLength <= buffer->length)
+
+    unitBuffer.data = buffer->data;
+    unitBuffer.length = (size_t) unitLength;
+    bufferSkipUnchecked(buffer, (size_t) unitLength);
+
+    {
+        U64 version = 0;
+        MUST (wasmDebugReadFixed(&unitBuffer, 2, &version))
+        MUST (version >= 2 && version <= 5)
+        unit.version = (U16) version;
+    }
+
+    if (unit.version >= 5) {
+        U8 segmentSelectorSize = 0;
+        MUST (bufferReadByte(&unitBuffer, &unit.addressSize))
+        MUST (bufferReadByte(&unitBuffer, &segmentSelectorSize))
+    }
+
+    MUST (wasmDebugReadFixed(&unitBuffer, unit.dwarf64 ? 8 : 4, &headerLength))
+    MUST (headerLength <= unitBuffer.length)
+
+    program.data = unitBuffer.data + headerLength;
+    program.length = unitBuffer.length - (size_t) headerLength;
+    unitBuffer.length = (size_t) headerLength;
+
+    MUST (bufferReadByte(&unitBuffer, &unit.minimumInstructionLength))
+    if (unit.version >= 4) {
+        U8 maximumOperationsPerInstruction = 0;
+        MUST (bufferReadByte(&unitBuffer, &maximumOperationsPerInstruction))
+    }
+    MUST (bufferReadByte(&unitBuffer, &defaultIsStatement))
+    MUST (bufferReadByte(&unitBuffer, &lineBase))
+    unit.lineBase = (I8) lineBase;
+    MUST (bufferReadByte(&unitBuffer, &unit.lineRange))
+    MUST (unit.lineRange > 0)
+    MUST (bufferReadByte(&unitBuffer, &unit.opcodeBase))
+    MUST (unit.opcodeBase > 0 && unitBuffer.length >= (size_t) (unit.opcodeBase - 1))
+    unit.standardOpcodeLengths = unitBuffer.data;
+    bufferSkipUnchecked(&unitBuffer, unit.opcodeBase - 1);
+
+    unit.firstFile = builder->fileCount;
+
+    if (unit.version >= 5) {
+        result = wasmDebugLinesReadEntries(builder, &unit, &unitBuffer, true)
+            && wasmDebugLinesReadEntries(builder, &unit, &unitBuffer, false);
+    } else {
+        result = wasmDebugLinesReadLegacyEntries(builder, &unit, &unitBuffer);
+    }
+
+    if (result) {
+        result = wasmDebugLinesRunProgram(builder, &unit, &program);
+    }
+
+    free((void*) unit.directories);
+
+    return result;
+}
+
+static
+int
+wasmDebugLineSequenceCompare(
+    const void* a,
+    const void* b
+) {
+    const WasmDebugLineSequence* sequenceA = a;
+    const WasmDebugLineSequence* sequenceB = b;
+    if (sequenceA->address < sequenceB->address) {
+        return -1;
+    }
+    if (sequenceA->address > sequenceB->address) {
+        return 1;
+    }
+    return 0;
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesRead(
+    const WasmDebugSections* sections,
+    WasmDebugLines* result
+) {
+    WasmDebugLinesBuilder builder;
+    Buffer buffer = sections->line;
+    bool success = true;
+
+    memset(&builder, 0, sizeof(builder));
+    builder.sections = sections;
+
+    while (!bufferAtEnd(&buffer)) {
+        /* Keep the units read so far if a later one is malformed */
+        if (!wasmDebugLinesReadUnit(&builder, &buffer)) {
+            success = false;
+            break;
+        }
+    }
+
+    /* Order the sequences by address, so rows can be found by binary search */
+    qsort(
+        builder.sequences,
+        builder.sequenceCount,
+        sizeof(WasmDebugLineSequence),
+        wasmDebugLineSequenceCompare
+    );
+
+    result->lines = NULL;
+    result->lineCount = 0;
+    if (builder.sequenceCount > 0) {
+        U32 sequenceIndex = 0;
+        U32 lineCount = 0;
+
+        result->lines = malloc(builder.lineCount * sizeof(WasmDebugLine));
+        MUST (result->lines != NULL)
+
+        for (; sequenceIndex < builder.sequenceCount; sequenceIndex++) {
+            const WasmDebugLineSequence sequence = builder.sequences[sequenceIndex];
+            memcpy(
+                &result->lines[lineCount],
+                &builder.lines[sequence.firstLine],
+                sequence.lineCount * sizeof(WasmDebugLine)
+            );
+            lineCount += sequence.lineCount;
+        }
+        result->lineCount = lineCount;
+    }
+
+    result->files = builder.files;
+    result->fileCount = builder.fileCount;
+
+    free(builder.lines);
+    free(builder.sequences);
+
+    return success;
+}
+
+const WasmDebugLine*
+wasmDebugLinesFind(
+    const WasmDebugLines* debugLines,
+    U32 address
+) {
+    const WasmDebugLine* row = NULL;
+    U32 low = 0;
+    U32 high = debugLines->lineCount;
+
+    /* Find the last row at or before the address */
+    while (low < high) {
+        U32 middle = low + (high - low) / 2;
+        if (debugLines->lines[middle].address <= address) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low == 0) {
+        return NULL;
+    }
+
+    row = &debugLines->lines[low - 1];
+    if (row->end) {
+        return NULL;
+    }
+    return row;
+}
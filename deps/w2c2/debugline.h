@@ -0,0 +1,59 @@
+#ifndef W2C2_DEBUGLINE_H
+#define W2C2_DEBUGLINE_H
+
+#include "w2c2_base.h"
+#include "buffer.h"
+
+/*
+ * WasmDebugSections are the DWARF custom sections of a module
+ * needed to map code addresses to source lines
+ */
+typedef struct WasmDebugSections {
+    Buffer line;
+    Buffer lineString;
+    Buffer string;
+} WasmDebugSections;
+
+/*
+ * WasmDebugLine is a row of the DWARF line table. Addresses are offsets
+ * into the code section, see https://github.com/WebAssembly/tool-conventions/blob/main/Debugging.md
+ */
+typedef struct WasmDebugLine {
+    U32 address;
+    U32 fileIndex;
+    U32 line;
+    /* The row ends a sequence, its address is the first one past it */
+    bool end;
+} WasmDebugLine;
+
+typedef struct WasmDebugLines {
+    WasmDebugLine* lines;
+    U32 lineCount;
+    char** files;
+    U32 fileCount;
+} WasmDebugLines;
+
+static const WasmDebugLines wasmEmptyDebugLines = {NULL, 0, NULL, 0};
+
+/*
+ * wasmDebugLinesRead reads the line tables of all compilation units in the .debug_line section.
+ * Supports DWARF versions 2 to 5
+ */
+bool
+WARN_UNUSED_RESULT
+wasmDebugLinesRead(
+    const WasmDebugSections* sections,
+    WasmDebugLines* result
+);
+
+/*
+ * wasmDebugLinesFind returns the row covering the given code address,
+ * or NULL if the address has no line information
+ */
+const WasmDebugLine*
+wasmDebugLinesFind(
+    const WasmDebugLines* debugLines,
+    U32 address
+);
+
+#endif /* W2C2_DEBUGLINE_H */
@@ -0,0 +1,126 @@
+#if defined(__linux__)
+#define _DEFAULT_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "w2c2_base.h"
+#include "file.h"
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define W2C2_MAPPED_FILES 1
+#endif
+
+#if W2C2_MAPPED_FILES
+/*
+ * The module is mapped read-only instead of read into the heap:
+ * its pages are file-backed, so the kernel can reclaim them,
+ * and translated functions can give theirs back early (see releaseFileRange)
+ */
+static U8* mappedData = NULL;
+static size_t mappedLength = 0;
+
+static
+Buffer
+mapFile(
+    const char* path
+) {
+    Buffer buffer = {NULL, 0};
+    struct stat st;
+    void* data = NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return buffer;
+    }
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        close(fd);
+        return buffer;
+    }
+
+    data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return buffer;
+    }
+
+    mappedData = data;
+    mappedLength = (size_t) st.st_size;
+
+    buffer.data = data;
+    buffer.length = (size_t) st.st_size;
+    return buffer;
+}
+#endif
+
+Buffer
+readFile(
+    const char* path
+) {
+    FILE* file = NULL;
+    Buffer buffer = {NULL, 0};
+    U8* data = NULL;
+    long size = 0;
+    size_t read = 0;
+
+#if W2C2_MAPPED_FILES
+    buffer = mapFile(path);
+    if (buffer.data != NULL) {
+        return buffer;
+    }
+#endif
+
+    file = fopen(path, "rb");
+    if (file == NULL) {
+        return buffer;
+    }
+    fseek(file, 0, SEEK_END);
+
+    size = ftell(file);
+    rewind(file);
+
+    data = malloc(size);
+    if (data == NULL) {
+        return buffer;
+    }
+    read = fread(data, 1, size, file);
+    if (read == size) {
+        buffer.data = data;
+        buffer.length = size;
+    } else {
+        free(data);
+    }
+    fclose(file);
+
+    return buffer;
+}
+
+void
+releaseFileRange(
+    const U8* data,
+    size_t length
+) {
+#if W2C2_MAPPED_FILES && defined(MADV_DONTNEED)
+    size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+    size_t start = 0;
+    size_t end = 0;
+
+    if (mappedData == NULL || data < mappedData || data + length > mappedData + mappedLength) {
+        return;
+    }
+
+    /* Only drop whole pages, neighbouring ranges may still be in use */
+    start = ((size_t) (data - mappedData) + pageSize - 1) / pageSize * pageSize;
+    end = (size_t) (data + length - mappedData) / pageSize * pageSize;
+    if (start < end) {
+        /* The mapping is read-only, so dropped pages are read back from the file if needed */
+        madvise(mappedData + start, end - start, MADV_DONTNEED);
+    }
+#else
+    (void) data;
+    (void) length;
+#endif
+}
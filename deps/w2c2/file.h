@@ -0,0 +1,20 @@
+#ifndef W2C2_FILE_H
+#define W2C2_FILE_H
+
+#include "buffer.h"
+
+/* Granularity in which processed parts of the input are released */
+#define FILE_RELEASE_SIZE (1024 * 1024)
+
+Buffer
+readFile(
+    const char* path
+);
+
+void
+releaseFileRange(
+    const U8* data,
+    size_t length
+);
+
+#endif /* W2C2_FILE_H */
@@ -0,0 +1,41 @@
+#ifndef W2C2_FUNCTIONTYPE_H
+#define W2C2_FUNCTIONTYPE_H
+
+#include "w2c2_base.h"
+#include "valuetype.h"
+
+typedef struct WasmFunctionType {
+    U32 parameterCount;
+    WasmValueType* parameterTypes;
+    U32 resultCount;
+    WasmValueType* resultTypes;
+} WasmFunctionType;
+
+static const WasmFunctionType wasmEmptyFunctionType = {0, NULL, 0, NULL};
+
+static
+__inline__
+bool
+wasmFunctionTypesEqual(
+    const WasmFunctionType a,
+    const WasmFunctionType b
+) {
+    U32 index = 0;
+
+    if (a.parameterCount != b.parameterCount || a.resultCount != b.resultCount) {
+        return false;
+    }
+    for (index = 0; index < a.parameterCount; index++) {
+        if (a.parameterTypes[index] != b.parameterTypes[index]) {
+            return false;
+        }
+    }
+    for (index = 0; index < a.resultCount; index++) {
+        if (a.resultTypes[index] != b.resultTypes[index]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif /* W2C2_FUNCTIONTYPE_H */
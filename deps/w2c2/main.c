@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <ctype.h>
+#include <getopt.h>
+#include "buffer.h"
+#include "file.h"
+#include "reader.h"
+#include "c.h"
+
+static
+bool
+readWasmBinary(
+    const char* path,
+    WasmModuleReader* wasmModuleReaderResult
+) {
+    WasmModuleReaderError* error = NULL;
+
+    wasmModuleReaderResult->buffer = readFile(path);
+    if (wasmModuleReaderResult->buffer.data == NULL) {
+        fprintf(stderr, "w2c2: failed to read file %s\n", path);
+        return false;
+    }
+
+    wasmModuleRead(wasmModuleReaderResult, &error);
+    if (error != NULL) {
+        fprintf(stderr, "w2c2: failed to read module: %s\n", wasmModuleReaderErrorMessage(error));
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Reads a list of hot functions, e.g. the output of perf report. Any word which is the name
+ * of a translated function of the module (f<index>, with its suffix and symbol prefix) counts
+ */
+static
+bool*
+readHotFunctions(
+    const char* path,
+    const WasmModule* module,
+    const char* prefix
+) {
+    U32 importCount = module->functionImports.length;
+    U32 hotCount = 0;
+    char word[1024];
+    bool* hotFunctions = NULL;
+
+    FILE* file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "w2c2: failed to read hot function list %s\n", path);
+        return NULL;
+    }
+
+    hotFunctions = calloc(module->functions.count + 1, sizeof(bool));
+    if (hotFunctions == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate hot functions\n");
+        fclose(file);
+        return NULL;
+    }
+
+    while (fscanf(file, "%1023s", word) == 1) {
+        const char* name = word;
+        char* end = NULL;
+        unsigned long functionIndex = 0;
+
+        if (prefix != NULL) {
+            size_t prefixLength = strlen(prefix);
+            if (strncmp(name, prefix, prefixLength) != 0 || name[prefixLength] != '_') {
+                continue;
+            }
+            name += prefixLength + 1;
+        }
+        if (name[0] != 'f' || !isdigit((unsigned char) name[1])) {
+            continue;
+        }
+        functionIndex = strtoul(name + 1, &end, 10);
+        if ((*end != '\0' && *end != '_' && *end != '.')
+            || functionIndex < importCount
+            || functionIndex - importCount >= module->functions.count) {
+            continue;
+        }
+        if (!hotFunctions[functionIndex - importCount]) {
+            hotFunctions[functionIndex - importCount] = true;
+            hotCount++;
+        }
+    }
+    fclose(file);
+
+    if (hotCount == 0) {
+        fprintf(stderr, "w2c2: no functions of the module in hot function list %s\n", path);
+    }
+
+    return hotFunctions;
+}
+
+int
+main(
+    int argc,
+    char* argv[]
+) {
+    U32 jobCount = 1;
+    char* modulePath = NULL;
+    char* outputPath = NULL;
+    U32 functionsPerFile = 10;
+    bool pretty = false;
+    bool exportWrappers = false;
+    bool debugLines = false;
+    const char* hotFunctionsPath = NULL;
+    WasmCLinkage linkage = wasmEmptyCLinkage;
+    WasmCTiering tiering = wasmEmptyCTiering;
+
+    int index;
+    int c;
+
+    opterr = 0;
+
+    while ((c = getopt(argc, argv, "j:o:f:pegn:x:l:H:Lh")) != -1) {
+        switch (c) {
+            case 'j': {
+                jobCount = strtoul(optarg, NULL, 0);
+                break;
+            }
+            case 'o': {
+                outputPath = optarg;
+                break;
+            }
+            case 'f': {
+                functionsPerFile = strtoul(optarg, NULL, 0);
+                break;
+            }
+            case 'p': {
+                pretty = true;
+                break;
+            }
+            case 'e': {
+                exportWrappers = true;
+                break;
+            }
+            case 'g': {
+                debugLines = true;
+                break;
+            }
+            case 'n': {
+                linkage.name = optarg;
+                break;
+            }
+            case 'x': {
+                linkage.prefix = optarg;
+                break;
+            }
+            case 'l': {
+                char** linkedModules = realloc(
+                    linkage.linkedModules,
+                    (linkage.linkedModuleCount + 1) * sizeof(char*)
+                );
+                if (linkedModules == NULL) {
+                    fprintf(stderr, "w2c2: failed to allocate linked modules\n");
+                    return 1;
+                }
+                linkedModules[linkage.linkedModuleCount++] = optarg;
+                linkage.linkedModules = linkedModules;
+                break;
+            }
+            case 'H': {
+                hotFunctionsPath = optarg;
+                break;
+            }
+            case 'L': {
+                tiering.hotLoops = true;
+                break;
+            }
+            case 'h': {
+                fprintf(
+                    stderr,
+                    "usage: w2c2 [options] filename\n\n"
+                    "options:\n"
+                    "  -h         Print this help message\n"
+                    "  -j         Number of jobCount (>1 enables parallel compilation and requires -o)\n"
+                    "  -f         Number of functions per file when parallel compilation is enabled\n"
+                    "  -o PATH    Path for the output file(s), by default use stdout. Required for parallel compilation\n"
+                    "  -p         Generate pretty code\n"
+                    "  -e         Generate trap-safe export wrappers (exports.h, exports.c). Requires parallel compilation\n"
+                );
+                fprintf(
+                    stderr,
+                    "  -g         Generate #line directives from the DWARF line information of the module\n"
+                );
+                fprintf(
+                    stderr,
+                    "  -n NAME    Module name, under which linked modules call the exported functions directly\n"
+                    "  -x PREFIX  Prefix for all global symbols, to link several modules into one program\n"
+                    "  -l NAME    Call the functions imported from module NAME directly. Can be repeated\n"
+                );
+                fprintf(
+                    stderr,
+                    "  -H PATH    Write the functions named in PATH (e.g. perf report output) to hot_*.c files\n"
+                    "  -L         Write the functions containing a loop or called inside one to hot_*.c files\n"
+                );
+                return 0;
+            }
+            case '?': {
+                if (optopt == 'o' || optopt == 'n' || optopt == 'x' || optopt == 'l' || optopt == 'H') {
+                    fprintf(stderr, "w2c2: option -%c requires an argument.\n", optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "w2c2: unknown option `-%c'.\n", optopt);
+                } else {
+                    fprintf(
+                        stderr,
+                        "w2c2: unknown option character `\\x%x'.\n",
+                        optopt
+                    );
+                }
+                return 1;
+            }
+            default:
+                abort();
+        }
+    }
+
+    index = optind;
+
+    if (index >= argc) {
+        fprintf(stderr, "w2c2: expected filename argument.\nTry '-h' for more information.\n");
+        return 1;
+    }
+
+    if (jobCount < 1) {
+        fprintf(stderr, "w2c2: expected jobCount >= 1, got %d\n", jobCount);
+        return 1;
+    }
+
+    if (exportWrappers && jobCount < 2) {
+        fprintf(
+            stderr,
+            "w2c2: export wrappers require parallel compilation.\n"
+            "Try '-h' for more information.\n"
+        );
+        return 1;
+    }
+
+    if ((hotFunctionsPath != NULL || tiering.hotLoops) && jobCount < 2) {
+        fprintf(
+            stderr,
+            "w2c2: hot functions require parallel compilation.\n"
+            "Try '-h' for more information.\n"
+        );
+        return 1;
+    }
+
+    if (exportWrappers && linkage.prefix != NULL) {
+        fprintf(
+            stderr,
+            "w2c2: export wrappers are only supported for the unprefixed module.\n"
+            "Try '-h' for more information.\n"
+        );
+        return 1;
+    }
+
+    if (linkage.prefix != NULL) {
+        const char* p = linkage.prefix;
+        bool valid = isalpha((unsigned char) *p) || *p == '_';
+        for (; *p != '\0'; p++) {
+            valid = valid && (isalnum((unsigned char) *p) || *p == '_');
+        }
+        if (!valid) {
+            fprintf(stderr, "w2c2: symbol prefix %s is not a C identifier\n", linkage.prefix);
+            return 1;
+        }
+    }
+
+    if (jobCount > 1 && outputPath == NULL) {
+        fprintf(
+            stderr,
+            "w2c2: expected output path argument for parallel compilation.\n"
+            "Try '-h' for more information.\n"
+        );
+        return 1;
+    }
+
+    modulePath = argv[index];
+
+    {
+        WasmModuleReader wasmModuleReader;
+        if (!readWasmBinary(modulePath, &wasmModuleReader)) {
+            return 1;
+        }
+
+        if (debugLines) {
+            WasmModule* module = wasmModuleReader.module;
+            if (module->debugSections.line.length == 0) {
+                fprintf(stderr, "w2c2: module has no DWARF line information (.debug_line)\n");
+            } else if (!wasmDebugLinesRead(&module->debugSections, &module->debugLines)) {
+                fprintf(stderr, "w2c2: failed to read DWARF line information, using what was read so far\n");
+            }
+        }
+
+        if (jobCount == 1) {
+            functionsPerFile = wasmModuleReader.module->functions.count;
+        }
+
+        if (hotFunctionsPath != NULL) {
+            tiering.hotFunctions = readHotFunctions(hotFunctionsPath, wasmModuleReader.module, linkage.prefix);
+            if (tiering.hotFunctions == NULL) {
+                return 1;
+            }
+        }
+
+        if (!wasmCWriteModule(outputPath, wasmModuleReader.module, jobCount, functionsPerFile, pretty, exportWrappers, &linkage, &tiering)) {
+            fprintf(stderr, "w2c2: failed to compile\n");
+            return 1;
+        }
+    }
+
+    return 0;
+}
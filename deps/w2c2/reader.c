@@ -0,0 +1,1826 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "reader.h"
+#include "file.h"
+#include "section.h"
+#include "opcode.h"
+#include "instruction.h"
+#include "datasegment.h"
+#include "table.h"
+#include "elementsegment.h"
+
+static const U8 wasmMagic[] = {
+    0x00, 0x61, 0x73, 0x6D,
+    0x01, 0x00, 0x00, 0x00,
+};
+
+const char*
+wasmModuleReaderErrorMessage(
+    WasmModuleReaderError* error
+) {
+    switch (error->code) {
+        case wasmModuleReaderInvalidMagic:
+            return "invalid magic";
+        case wasmModuleReaderAllocationFailed:
+            return "allocation failed";
+        case wasmModuleReaderInvalidSectionID:
+            return "invalid section ID";
+        case wasmModuleReaderInvalidSectionSize:
+            return "invalid section size";
+        case wasmModuleReaderIncorrectSectionRead:
+            return "invalid section read";
+        case wasmModuleReaderInvalidTypeSectionTypeCount:
+            return "invalid type section type count";
+        case wasmModuleReaderInvalidFunctionTypeIndicator:
+            return "invalid function type indicator";
+        case wasmModuleReaderInvalidFunctionTypeParameterCount:
+            return "invalid function type parameter count";
+        case wasmModuleReaderInvalidFunctionTypeResultCount:
+            return "invalid function type result count";
+        case wasmModuleReaderInvalidImportSectionImportCount:
+            return "invalid import section import count";
+        case wasmModuleReaderInvalidImportSectionImportModule:
+            return "invalid import section import module";
+        case wasmModuleReaderInvalidImportSectionImportName:
+            return "invalid import section import name";
+        case wasmModuleReaderInvalidImportSectionImportKind:
+            return "invalid import section import kind";
+        case wasmModuleReaderInvalidImportSectionFunctionTypeIndex:
+            return "invalid import section index";
+        case wasmModuleReaderInvalidValueType:
+            return "invalid value type";
+        case wasmModuleReaderInvalidFunctionSectionFunctionCount:
+            return "invalid function section function count";
+        case wasmModuleReaderInvalidFunctionTypeIndex:
+            return "invalid function type index";
+        case wasmModuleReaderInvalidCodeSectionFunctionCount:
+            return "invalid code section function count";
+        case wasmModuleReaderInvalidCodeSectionCodeSize:
+            return "invalid code section code size";
+        case wasmModuleReaderInvalidCodeSectionLocalsDeclarations:
+            return "invalid code section local declarations";
+        case wasmModuleReaderInvalidExportSectionExportCount:
+            return "invalid export section export count";
+        case wasmModuleReaderInvalidExportSectionExportName:
+            return "invalid export section export name";
+        case wasmModuleReaderInvalidExportSectionExportKind:
+            return "invalid export section export kind";
+        case wasmModuleReaderInvalidExportSectionIndex:
+            return "invalid export section index";
+        case wasmModuleReaderInvalidGlobalSectionGlobalCount:
+            return "invalid global section global count";
+        case wasmModuleReaderInvalidGlobalSectionMutabilityIndicator:
+            return "invalid global section mutability indicator";
+        case wasmModuleReaderInvalidGlobalSectionInitExpression:
+            return "invalid global section init expression";
+        case wasmModuleReaderInvalidMemorySectionMemoryCount:
+            return "invalid memory section memory count";
+        case wasmModuleReaderInvalidLimitKind:
+            return "invalid limit kind";
+        case wasmModuleReaderInvalidLimitMinimum:
+            return "invalid limit minimum";
+        case wasmModuleReaderInvalidLimitMaximum:
+            return "invalid limit maximum";
+        case wasmModuleReaderInvalidDataSectionDataSegmentCount:
+            return "invalid data section data segment count";
+        case wasmModuleReaderInvalidDataSectionMemoryIndex:
+            return "invalid data section memory index";
+        case wasmModuleReaderInvalidDataSectionOffsetExpression:
+            return "invalid data section offset expression";
+        case wasmModuleReaderInvalidDataSectionBytes:
+            return "invalid data section bytes";
+        case wasmModuleReaderInvalidTableSectionTableCount:
+            return "invalid table section table count";
+        case wasmModuleReaderInvalidTableSectionTableType:
+            return "invalid table section table type";
+        case wasmModuleReaderInvalidElementSectionElementSegmentCount:
+            return "invalid element section element segment count";
+        case wasmModuleReaderInvalidElementSectionTableIndex:
+            return "invalid element section table index";
+        case wasmModuleReaderInvalidElementSectionOffsetExpression:
+            return "invalid element section offset expression";
+        case wasmModuleReaderInvalidElementSectionFunctionIndexCount:
+            return "invalid element section function index count";
+        case wasmModuleReaderInvalidElementSectionFunctionIndex:
+            return "invalid element section function index";
+        case wasmModuleReaderInvalidStartSectionFunctionIndex:
+            return "invalid start section function index";
+        case wasmModuleReaderInvalidTagSectionTagCount:
+            return "invalid tag section tag count";
+        case wasmModuleReaderInvalidTagSectionAttribute:
+            return "invalid tag section attribute";
+        case wasmModuleReaderInvalidTagSectionTypeIndex:
+            return "invalid tag section type index";
+        default:
+            return "unknown";
+    }
+}
+
+static
+void
+wasmModuleReadMagic(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    if (!bufferReadEqual(
+        &reader->buffer,
+        wasmMagic,
+        sizeof wasmMagic
+    )) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidMagic
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+    *error = NULL;
+}
+
+static
+WasmValueType
+wasmModuleReadValueType(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    WasmValueType valueType = 0;
+
+    if (!wasmReadValueType(&reader->buffer, &valueType)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidValueType
+        };
+        *error = &wasmModuleReaderError;
+        return 0;
+    }
+    *error = NULL;
+    return valueType;
+}
+
+static
+WasmValueType*
+wasmReadValueTypes(
+    WasmModuleReader* reader,
+    U32 count,
+    WasmModuleReaderError** error
+) {
+    /* Allocate value type array */
+    WasmValueType* valueTypes = calloc(sizeof(WasmValueType) * count, 1);
+    if (valueTypes == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return NULL;
+    }
+
+    /* Read value types */
+    {
+        U32 valueTypeIndex = 0;
+        for (; valueTypeIndex < count; valueTypeIndex++) {
+            WasmValueType valueType = wasmModuleReadValueType(reader, error);
+            if (*error != NULL) {
+                return NULL;
+            }
+            valueTypes[valueTypeIndex] = valueType;
+        }
+    }
+
+    *error = NULL;
+    return valueTypes;
+}
+
+/* wasmFunctionTypeIndicator is the byte used to indicate a function type in the WASM binary */
+const U32 wasmFunctionTypeIndicator = 0x60;
+
+static
+void
+wasmReadFunctionType(
+    WasmModuleReader* reader,
+    WasmFunctionType* result,
+    WasmModuleReaderError** error
+) {
+    U8 typeIndicator = 0;
+    U32 parameterCount = 0;
+    WasmValueType* parameterTypes = NULL;
+    U32 resultCount = 0;
+    WasmValueType* resultTypes = NULL;
+
+    /* Read type indicator */
+    if (
+        !bufferReadByte(&reader->buffer, &typeIndicator)
+        || typeIndicator != wasmFunctionTypeIndicator) {
+
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidFunctionTypeIndicator
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read parameter count */
+    if (leb128ReadU32(&reader->buffer, &parameterCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidFunctionTypeParameterCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read parameter types */
+    parameterTypes = wasmReadValueTypes(reader, parameterCount, error);
+    if (*error != NULL) {
+        return;
+    }
+
+    /* Read result count */
+    if (leb128ReadU32(&reader->buffer, &resultCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidFunctionTypeResultCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read result types */
+    resultTypes = wasmReadValueTypes(reader, resultCount, error);
+    if (*error != NULL) {
+        return;
+    }
+
+    *error = NULL;
+
+    result->parameterCount = parameterCount;
+    result->parameterTypes = parameterTypes;
+    result->resultCount = resultCount;
+    result->resultTypes = resultTypes;
+}
+
+typedef void (* WasmSectionReader)(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+);
+
+static
+void
+wasmReadTypeSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 typeCount = 0;
+    U32 typeIndex = 0;
+    WasmFunctionType* functionTypes = NULL;
+
+    /* Read type count */
+    if (leb128ReadU32(&reader->buffer, &typeCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidTypeSectionTypeCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate function type array */
+    functionTypes = calloc(sizeof(WasmFunctionType) * typeCount, 1);
+    if (functionTypes == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read function types */
+    for (; typeIndex < typeCount; typeIndex++) {
+        WasmFunctionType functionType = wasmEmptyFunctionType;
+        wasmReadFunctionType(reader, &functionType, error);
+        if (*error != NULL) {
+            return;
+        }
+        functionTypes[typeIndex] = functionType;
+    }
+
+    *error = NULL;
+
+    reader->module->functionTypes.count = typeCount;
+    reader->module->functionTypes.functionTypes = functionTypes;
+}
+
+static
+WasmGlobalType
+wasmReadGlobalType(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    WasmGlobalType result = {0, false};
+
+    U8 mutabilityIndicator = 0;
+
+    /* Read value type */
+    WasmValueType valueType = wasmModuleReadValueType(reader, error);
+    if (*error != NULL) {
+        return result;
+    }
+
+    /* Read mutability */
+    if (!bufferReadByte(&reader->buffer, &mutabilityIndicator)
+        || mutabilityIndicator > 1) {
+
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidGlobalSectionMutabilityIndicator
+        };
+        *error = &wasmModuleReaderError;
+        return result;
+    }
+
+    *error = NULL;
+
+    result.valueType = valueType;
+    result.mutable = mutabilityIndicator == 0x1;
+
+    return result;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmReadName(
+    Buffer* buffer,
+    char** result
+) {
+    char* name = NULL;
+
+    U32 length = 0;
+    MUST (leb128ReadU32(buffer, &length) > 0)
+    MUST (length <= buffer->length)
+
+    name = calloc(length + 1, 1);
+    MUST (name != NULL)
+
+    strncpy(
+        name,
+        (char*) buffer->data,
+        length
+    );
+
+    name[length] = '\0';
+
+    bufferSkipUnchecked(buffer, length);
+
+    *result = name;
+
+    return true;
+}
+
+static
+void
+wasmReadFunctionImport(
+    WasmModuleReader* reader,
+    char* module,
+    char* name,
+    WasmModuleReaderError** error
+) {
+    WasmFunctionImport import = wasmEmptyFunctionImport;
+
+    /* Read function type index */
+    U32 functionTypeIndex = 0;
+    if (leb128ReadU32(&reader->buffer, &functionTypeIndex) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidImportSectionFunctionTypeIndex
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    import.module = module;
+    import.name = name;
+    import.functionTypeIndex = functionTypeIndex;
+
+    {
+        size_t newLength = reader->module->functionImports.length + 1;
+
+        if (!wasmFunctionImportsEnsureCapacity(&reader->module->functionImports, newLength)) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderAllocationFailed
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        *error = NULL;
+
+        reader->module->functionImports.length = newLength;
+        reader->module->functionImports.imports[newLength - 1] = import;
+    }
+}
+
+static
+void
+wasmReadGlobalImport(
+    WasmModuleReader* reader,
+    char* module,
+    char* name,
+    WasmModuleReaderError** error
+) {
+    WasmGlobalImport import = wasmEmptyGlobalImport;
+
+    /* Read global type */
+    WasmGlobalType globalType = wasmReadGlobalType(reader, error);
+    if (*error != NULL) {
+        return;
+    }
+
+    import.module = module;
+    import.name = name;
+    import.globalType = globalType;
+
+    {
+        size_t newLength = reader->module->globalImports.length + 1;
+
+        if (!wasmGlobalImportsEnsureCapacity(&reader->module->globalImports, newLength)) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderAllocationFailed
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        *error = NULL;
+
+        reader->module->globalImports.length = newLength;
+        reader->module->globalImports.imports[newLength - 1] = import;
+    }
+}
+
+/*
+ * Reads a limit, a 64-bit one for memory64. Page counts have to fit 32 bits
+ */
+static
+bool
+wasmReadLimit(
+    WasmModuleReader* reader,
+    U32* limit,
+    bool is64
+) {
+    U64 limit64 = 0;
+    if (!is64) {
+        return leb128ReadU32(&reader->buffer, limit) != 0;
+    }
+    if (leb128ReadU64(&reader->buffer, &limit64) == 0 || limit64 > UINT32_MAX) {
+        return false;
+    }
+    *limit = (U32) limit64;
+    return true;
+}
+
+static
+void
+wasmReadLimits(
+    WasmModuleReader* reader,
+    U32* min,
+    U32* max,
+    bool* memory64,
+    WasmModuleReaderError** error
+) {
+    U8 kindIndicator = 0;
+    bool is64 = false;
+
+    /* Read limit kind */
+    if (!bufferReadByte(&reader->buffer, &kindIndicator)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidLimitKind
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* memory64 proposal: flag 0x4 marks a memory with 64-bit limits */
+    if (memory64 != NULL && (kindIndicator & 0x4) != 0) {
+        kindIndicator &= ~0x4;
+        is64 = true;
+    }
+
+    /* Read min */
+    if (!wasmReadLimit(reader, min, is64)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidLimitMinimum
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    switch (kindIndicator) {
+        case 0x0: {
+            *max = 0;
+            break;
+        }
+        case 0x1: {
+            /* Read max */
+            if (!wasmReadLimit(reader, max, is64)) {
+                static WasmModuleReaderError wasmModuleReaderError = {
+                    wasmModuleReaderInvalidLimitMaximum
+                };
+                *error = &wasmModuleReaderError;
+                return;
+            }
+            break;
+        }
+        default: {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidLimitKind
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+    }
+
+    if (memory64 != NULL) {
+        *memory64 = is64;
+    }
+
+    *error = NULL;
+}
+
+static
+void
+wasmReadMemoryType(
+    WasmModuleReader* reader,
+    U32* min,
+    U32* max,
+    bool* memory64,
+    WasmModuleReaderError** error
+) {
+    wasmReadLimits(reader, min, max, memory64, error);
+    if (*max == 0) {
+        /* A 64-bit memory is only limited by the page count */
+        *max = *memory64 ? UINT32_MAX : UINT32_MAX / WASM_PAGE_SIZE;
+    }
+}
+
+static
+void
+wasmReadMemoryImport(
+    WasmModuleReader* reader,
+    char* module,
+    char* name,
+    WasmModuleReaderError** error
+) {
+    WasmMemoryImport import = wasmEmptyMemoryImport;
+
+    import.module = module;
+    import.name = name;
+
+    wasmReadMemoryType(reader, &import.min, &import.max, &import.memory64, error);
+    if (*error != NULL) {
+        return;
+    }
+
+    {
+        size_t newLength = reader->module->memoryImports.length + 1;
+
+        if (!wasmMemoryImportsEnsureCapacity(&reader->module->memoryImports, newLength)) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderAllocationFailed
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        *error = NULL;
+
+        reader->module->memoryImports.length = newLength;
+        reader->module->memoryImports.imports[newLength - 1] = import;
+    }
+}
+
+static
+void
+wasmReadTableType(
+    WasmModuleReader* reader,
+    U32* min,
+    U32* max,
+    WasmModuleReaderError** error
+) {
+    U8 tableType = 0;
+
+    /* Read table type */
+    if (
+        !bufferReadByte(&reader->buffer, &tableType)
+        || tableType != wasmTableTypeFuncRef
+        ) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidTableSectionTableType
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    wasmReadLimits(reader, min, max, NULL, error);
+    if (*error != NULL) {
+        return;
+    }
+    if (*max == 0) {
+        *max = UINT32_MAX;
+    }
+
+    *error = NULL;
+}
+
+static
+void
+wasmReadTableImport(
+    WasmModuleReader* reader,
+    char* module,
+    char* name,
+    WasmModuleReaderError** error
+) {
+    WasmTableImport import = wasmEmptyTableImport;
+
+    import.module = module;
+    import.name = name;
+
+    wasmReadTableType(reader, &import.min, &import.max, error);
+    if (*error != NULL) {
+        return;
+    }
+
+    {
+        size_t newLength = reader->module->tableImports.length + 1;
+
+        if (!wasmTableImportsEnsureCapacity(&reader->module->tableImports, newLength)) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderAllocationFailed
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        *error = NULL;
+
+        reader->module->tableImports.length = newLength;
+        reader->module->tableImports.imports[newLength - 1] = import;
+    }
+}
+
+static
+void
+wasmReadImport(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    char* module = NULL;
+    char* name = NULL;
+    U8 kindIndicator = 0;
+
+    /* Read module */
+    if (!wasmReadName(&reader->buffer, &module)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidImportSectionImportModule
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read name */
+    if (!wasmReadName(&reader->buffer, &name)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidImportSectionImportName
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read import kind */
+    if (!bufferReadByte(&reader->buffer, &kindIndicator)
+        || kindIndicator >= wasmImportKind_count) {
+
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidImportSectionImportKind
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    switch (kindIndicator) {
+        case wasmImportKindFunction: {
+            wasmReadFunctionImport(reader, module, name, error);
+            if (*error != NULL) {
+                return;
+            }
+            break;
+        }
+        case wasmImportKindGlobal: {
+            wasmReadGlobalImport(reader, module, name, error);
+            if (*error != NULL) {
+                return;
+            }
+            break;
+        }
+        case wasmImportKindMemory: {
+            wasmReadMemoryImport(reader, module, name, error);
+            if (*error != NULL) {
+                return;
+            }
+            break;
+        }
+        case wasmImportKindTable: {
+            wasmReadTableImport(reader, module, name, error);
+            if (*error != NULL) {
+                return;
+            }
+            break;
+        }
+        default: {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidImportSectionImportKind
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+    }
+
+    *error = NULL;
+}
+
+static
+void
+wasmReadImportSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 importCount = 0;
+
+    /* Read import count */
+    if (leb128ReadU32(&reader->buffer, &importCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidTypeSectionTypeCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read imports */
+    {
+        U32 importIndex = 0;
+        for (; importIndex < importCount; importIndex++) {
+            wasmReadImport(reader, error);
+            if (*error != NULL) {
+                return;
+            }
+        }
+    }
+
+    *error = NULL;
+}
+
+static
+void
+wasmReadFunctionSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 functionCount = 0;
+    U32 functionIndex = 0;
+    WasmFunction* functions = NULL;
+
+    /* Read function count */
+    if (leb128ReadU32(&reader->buffer, &functionCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidFunctionSectionFunctionCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate function array */
+    functions = calloc(sizeof(WasmFunction) * functionCount, 1);
+    if (functions == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read function type indices */
+    for (; functionIndex < functionCount; functionIndex++) {
+        WasmFunction function = wasmEmptyFunction;
+
+        /* Read function type index */
+        U32 functionTypeIndex = 0;
+        if (leb128ReadU32(&reader->buffer, &functionTypeIndex) == 0) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidFunctionTypeIndex
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        /* Check function type index does not exceed function type count */
+        if (functionTypeIndex >= reader->module->functionTypes.count) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidFunctionTypeIndex
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        function.functionTypeIndex = functionTypeIndex;
+        functions[functionIndex] = function;
+    }
+
+    *error = NULL;
+
+    reader->module->functions.count = functionCount;
+    reader->module->functions.functions = functions;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmReadConstantExpr(
+    Buffer* buffer
+) {
+    WasmOpcode opcode;
+    MUST (wasmOpcodeRead(buffer, &opcode))
+    switch (opcode) {
+        case wasmOpcodeI32Const:
+        case wasmOpcodeI64Const:
+        case wasmOpcodeF32Const:
+        case wasmOpcodeF64Const: {
+            WasmConstInstruction instruction;
+            MUST (wasmConstInstructionRead(buffer, opcode, &instruction))
+            break;
+        }
+        case wasmOpcodeGlobalGet: {
+            WasmGlobalInstruction instruction;
+            MUST (wasmGlobalInstructionRead(buffer, opcode, &instruction))
+            break;
+        }
+        case wasmOpcodeEnd:
+            return true;
+        default:
+            return false;
+    }
+
+    /* Read end opcode */
+    MUST (wasmOpcodeRead(buffer, &opcode))
+    MUST (opcode == wasmOpcodeEnd)
+
+    return true;
+}
+
+static
+void
+wasmReadMemorySection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 memoryCount = 0;
+    U32 memoryIndex = 0;
+    WasmMemory* memories = NULL;
+
+    /* Read memory count */
+    if (leb128ReadU32(&reader->buffer, &memoryCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidMemorySectionMemoryCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate memories array */
+    memories = calloc(sizeof(WasmMemory) * memoryCount, 1);
+    if (memories == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read memories */
+    for (; memoryIndex < memoryCount; memoryIndex++) {
+        WasmMemory memory = wasmEmptyMemory;
+        wasmReadMemoryType(reader, &memory.min, &memory.max, &memory.memory64, error);
+        if (*error != NULL) {
+            return;
+        }
+        memories[memoryIndex] = memory;
+    }
+
+    *error = NULL;
+
+    reader->module->memories.count = memoryCount;
+    reader->module->memories.memories = memories;
+}
+
+static
+void
+wasmReadGlobal(
+    WasmModuleReader* reader,
+    WasmGlobal* result,
+    WasmModuleReaderError** error
+) {
+    Buffer init;
+
+    /* Read global type */
+    WasmGlobalType type = wasmReadGlobalType(reader, error);
+    if (*error != NULL) {
+        return;
+    }
+
+    /* Read init expression */
+    init = reader->buffer;
+    if (!wasmReadConstantExpr(&reader->buffer)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidGlobalSectionInitExpression
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+    init.length -= reader->buffer.length;
+
+    *error = NULL;
+
+    result->type = type;
+    result->init = init;
+}
+
+static
+void
+wasmReadGlobalSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 globalCount = 0;
+    U32 globalIndex = 0;
+    WasmGlobal* globals = NULL;
+
+    /* Read global count */
+    if (leb128ReadU32(&reader->buffer, &globalCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidGlobalSectionGlobalCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate globals array */
+    globals = calloc(sizeof(WasmGlobal) * globalCount, 1);
+    if (globals == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read globals */
+    for (; globalIndex < globalCount; globalIndex++) {
+        WasmGlobal global = wasmEmptyGlobal;
+        wasmReadGlobal(reader, &global, error);
+        if (*error != NULL) {
+            return;
+        }
+        globals[globalIndex] = global;
+    }
+
+    *error = NULL;
+
+    reader->module->globals.count = globalCount;
+    reader->module->globals.globals = globals;
+}
+
+static
+void
+wasmReadExport(
+    WasmModuleReader* reader,
+    WasmExport* result,
+    WasmModuleReaderError** error
+) {
+    char* name = NULL;
+    U8 kindIndicator = 0;
+    U32 index = 0;
+
+    /* Read name */
+    if (!wasmReadName(&reader->buffer, &name)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidExportSectionExportName
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read export kind */
+    if (!bufferReadByte(&reader->buffer, &kindIndicator)
+        || kindIndicator >= wasmExportKind_count) {
+
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidExportSectionExportKind
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read export index */
+    if (leb128ReadU32(&reader->buffer, &index) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidExportSectionIndex
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    *error = NULL;
+
+    result->name = name;
+    result->kind = kindIndicator;
+    result->index = index;
+}
+
+static
+void
+wasmReadExportSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 exportCount = 0;
+    WasmExport* exports = NULL;
+
+    /* Read export count */
+    if (leb128ReadU32(&reader->buffer, &exportCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidTypeSectionTypeCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate export array */
+    exports = calloc(sizeof(WasmExport) * exportCount, 1);
+    if (exports == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read exports */
+    {
+        U32 exportIndex = 0;
+        for (; exportIndex < exportCount; exportIndex++) {
+            WasmExport export = wasmEmptyExport;
+            wasmReadExport(reader, &export, error);
+            if (*error != NULL) {
+                return;
+            }
+            exports[exportIndex] = export;
+        }
+    }
+
+    *error = NULL;
+
+    reader->module->exports.count = exportCount;
+    reader->module->exports.exports = exports;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmReadCodeLocalsDeclarations(
+    WasmModuleReader* reader,
+    WasmLocalsDeclarations* result
+) {
+    WasmLocalsDeclaration* declarations = NULL;
+    U32 declarationCount = 0;
+
+    MUST (leb128ReadU32(&reader->buffer, &declarationCount) > 0)
+
+    if (declarationCount > 0) {
+        declarations = calloc(sizeof(struct WasmLocalsDeclaration) * declarationCount, 1);
+        MUST (declarations != NULL)
+
+        {
+            U32 declarationIndex = 0;
+            for (; declarationIndex < declarationCount; declarationIndex++) {
+                WasmLocalsDeclaration declaration = {0, 0};
+
+                MUST (leb128ReadU32(&reader->buffer, &declaration.count) > 0)
+                MUST (wasmReadValueType(&reader->buffer, &declaration.type))
+
+                declarations[declarationIndex] = declaration;
+            }
+        }
+    }
+
+    result->declarations = declarations;
+    result->declarationCount = declarationCount;
+
+    return true;
+}
+
+static
+void
+wasmReadCodeSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 functionCount = 0;
+    U32 functionIndex = 0;
+    const U8* releaseStart = NULL;
+
+    reader->module->codeSectionStart = reader->buffer.data;
+
+    /* Read function count */
+    if (leb128ReadU32(&reader->buffer, &functionCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidCodeSectionFunctionCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Check function count matches */
+    if (functionCount != reader->module->functions.count) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidCodeSectionFunctionCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /*
+     * Only the function boundaries are needed for now, the bodies are read again
+     * when they are translated. Give the pages read so far back as the section
+     * is scanned, so a large module is never resident as a whole.
+     */
+    releaseStart = reader->buffer.data;
+
+    /* Read function codes */
+    for (; functionIndex < functionCount; functionIndex++) {
+        WasmFunction* function = &reader->module->functions.functions[functionIndex];
+
+        /* Read code size */
+        U32 codeSize = 0;
+        if (leb128ReadU32(&reader->buffer, &codeSize) == 0) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidCodeSectionCodeSize
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        /* Check code size */
+        if (codeSize > reader->buffer.length) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidCodeSectionCodeSize
+            };
+            *error = &wasmModuleReaderError;
+            return;
+        }
+
+        /* Read local declarations */
+        {
+            const U8* localsDeclarationsOffset = reader->buffer.data;
+
+            if (!wasmReadCodeLocalsDeclarations(reader, &function->localsDeclarations)) {
+                static WasmModuleReaderError wasmModuleReaderError = {
+                    wasmModuleReaderInvalidCodeSectionLocalsDeclarations
+                };
+                *error = &wasmModuleReaderError;
+                return;
+            }
+
+            function->code.data = reader->buffer.data;
+            codeSize -= reader->buffer.data - localsDeclarationsOffset;
+            function->code.length = codeSize;
+
+            /* Skip unchecked, as buffer length was already checked above */
+            bufferSkipUnchecked(&reader->buffer, codeSize);
+        }
+
+        if ((size_t) (reader->buffer.data - releaseStart) >= FILE_RELEASE_SIZE) {
+            releaseFileRange(releaseStart, (size_t) (reader->buffer.data - releaseStart));
+            releaseStart = reader->buffer.data;
+        }
+    }
+
+    releaseFileRange(releaseStart, (size_t) (reader->buffer.data - releaseStart));
+
+    *error = NULL;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmReadBytes(
+    Buffer* buffer,
+    Buffer* result
+) {
+    U8* bytes = NULL;
+
+    U32 length = 0;
+    MUST (leb128ReadU32(buffer, &length) > 0)
+    MUST (length <= buffer->length)
+
+    bytes = calloc(length, 1);
+    MUST (bytes != NULL)
+
+    memcpy(
+        bytes,
+        (U8*) buffer->data,
+        length
+    );
+
+    bufferSkipUnchecked(buffer, length);
+
+    result->data = bytes;
+    result->length = length;
+
+    return true;
+}
+
+static
+void
+wasmReadDataSegment(
+    WasmModuleReader* reader,
+    WasmDataSegment* result,
+    WasmModuleReaderError** error
+) {
+    U32 memoryIndex = 0;
+    Buffer offset;
+    Buffer bytes = {NULL, 0};
+
+    /* Read memory index */
+    if (leb128ReadU32(&reader->buffer, &memoryIndex) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidDataSectionMemoryIndex
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read offset expression */
+    offset = reader->buffer;
+    if (!wasmReadConstantExpr(&reader->buffer)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidDataSectionOffsetExpression
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+    offset.length -= reader->buffer.length;
+
+    /* Read bytes */
+    if (!wasmReadBytes(&reader->buffer, &bytes)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidDataSectionBytes
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    *error = NULL;
+
+    result->memoryIndex = memoryIndex;
+    result->offset = offset;
+    result->bytes = bytes;
+}
+
+static
+void
+wasmReadDataSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 dataSegmentCount = 0;
+    WasmDataSegment* dataSegments = NULL;
+
+    /* Read data count */
+    if (leb128ReadU32(&reader->buffer, &dataSegmentCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidDataSectionDataSegmentCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate data segment array */
+    dataSegments = calloc(sizeof(WasmDataSegment) * dataSegmentCount, 1);
+    if (dataSegments == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read data segments */
+    {
+        U32 dataSegmentIndex = 0;
+        for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+            WasmDataSegment dataSegment = wasmEmptyDataSegment;
+            wasmReadDataSegment(reader, &dataSegment, error);
+            if (*error != NULL) {
+                return;
+            }
+            dataSegments[dataSegmentIndex] = dataSegment;
+        }
+    }
+
+    *error = NULL;
+
+    reader->module->dataSegments.count = dataSegmentCount;
+    reader->module->dataSegments.dataSegments = dataSegments;
+}
+
+static
+void
+wasmReadTableSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 tableCount = 0;
+    WasmTable* tables = NULL;
+
+    /* Read table count */
+    if (leb128ReadU32(&reader->buffer, &tableCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidTableSectionTableCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate table segment array */
+    tables = calloc(sizeof(WasmTable) * tableCount, 1);
+    if (tables == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read tables */
+    {
+        U32 tableIndex = 0;
+        for (; tableIndex < tableCount; tableIndex++) {
+            WasmTable table = wasmEmptyTable;
+            wasmReadTableType(reader, &table.min, &table.max, error);
+            if (*error != NULL) {
+                return;
+            }
+            tables[tableIndex] = table;
+        }
+    }
+
+    *error = NULL;
+
+    reader->module->tables.count = tableCount;
+    reader->module->tables.tables = tables;
+}
+
+static
+void
+wasmReadElementSegment(
+    WasmModuleReader* reader,
+    WasmElementSegment* result,
+    WasmModuleReaderError** error
+) {
+    U32 tableIndex;
+    Buffer offset;
+    U32 functionIndexCount;
+    U32* functionIndices;
+
+    /* Read element count */
+    if (leb128ReadU32(&reader->buffer, &tableIndex) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidElementSectionTableIndex
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read offset expression */
+    offset = reader->buffer;
+    if (!wasmReadConstantExpr(&reader->buffer)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidElementSectionOffsetExpression
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+    offset.length -= reader->buffer.length;
+
+    /* Read function index count */
+    if (leb128ReadU32(&reader->buffer, &functionIndexCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidElementSectionFunctionIndexCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate element segment array */
+    functionIndices = calloc(sizeof(U32) * functionIndexCount, 1);
+    if (functionIndices == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read element segments */
+    {
+        U32 functionIndexIndex = 0;
+        for (; functionIndexIndex < functionIndexCount; functionIndexIndex++) {
+            U32 functionIndex;
+            if (leb128ReadU32(&reader->buffer, &functionIndex) == 0) {
+                static WasmModuleReaderError wasmModuleReaderError = {
+                    wasmModuleReaderInvalidElementSectionFunctionIndex
+                };
+                *error = &wasmModuleReaderError;
+                return;
+            }
+            functionIndices[functionIndexIndex] = functionIndex;
+        }
+    }
+
+    *error = NULL;
+
+    result->tableIndex = tableIndex;
+    result->offset = offset;
+    result->functionIndexCount = functionIndexCount;
+    result->functionIndices = functionIndices;
+}
+
+static
+void
+wasmReadElementSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 elementSegmentCount = 0;
+    WasmElementSegment* elementSegments = NULL;
+
+    /* Read element count */
+    if (leb128ReadU32(&reader->buffer, &elementSegmentCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidElementSectionElementSegmentCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate element segment array */
+    elementSegments = calloc(sizeof(WasmElementSegment) * elementSegmentCount, 1);
+    if (elementSegments == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Read element segments */
+    {
+        U32 elementSegmentIndex = 0;
+        for (; elementSegmentIndex < elementSegmentCount; elementSegmentIndex++) {
+            WasmElementSegment elementSegment = wasmEmptyElementSegment;
+            wasmReadElementSegment(reader, &elementSegment, error);
+            if (*error != NULL) {
+                return;
+            }
+            elementSegments[elementSegmentIndex] = elementSegment;
+        }
+    }
+
+    *error = NULL;
+
+    reader->module->elementSegments.count = elementSegmentCount;
+    reader->module->elementSegments.elementSegments = elementSegments;
+}
+
+static
+void
+wasmReadStartSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 functionIndex = 0;
+
+    /* Read export count */
+    if (leb128ReadU32(&reader->buffer, &functionIndex) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidStartSectionFunctionIndex
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    *error = NULL;
+
+    reader->module->startFunctionIndex = functionIndex;
+    reader->module->hasStartFunction = true;
+}
+
+static
+void
+wasmReadTagSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U32 tagCount = 0;
+    U32 tagIndex = 0;
+    U32* functionTypeIndices = NULL;
+
+    /* Read tag count */
+    if (leb128ReadU32(&reader->buffer, &tagCount) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidTagSectionTagCount
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    /* Allocate tag array */
+    functionTypeIndices = calloc(sizeof(U32) * tagCount, 1);
+    if (functionTypeIndices == NULL && tagCount > 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    for (; tagIndex < tagCount; tagIndex++) {
+        U8 attribute = 0;
+        U32 functionTypeIndex = 0;
+
+        /* Read attribute, only exceptions (0) are defined */
+        if (!bufferReadByte(&reader->buffer, &attribute) || attribute != 0) {
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidTagSectionAttribute
+            };
+            *error = &wasmModuleReaderError;
+            free(functionTypeIndices);
+            return;
+        }
+
+        /* Read function type index, the parameters are the values of the exception */
+        if (leb128ReadU32(&reader->buffer, &functionTypeIndex) == 0
+            || functionTypeIndex >= reader->module->functionTypes.count) {
+
+            static WasmModuleReaderError wasmModuleReaderError = {
+                wasmModuleReaderInvalidTagSectionTypeIndex
+            };
+            *error = &wasmModuleReaderError;
+            free(functionTypeIndices);
+            return;
+        }
+
+        functionTypeIndices[tagIndex] = functionTypeIndex;
+    }
+
+    *error = NULL;
+
+    reader->module->tags.count = tagCount;
+    reader->module->tags.functionTypeIndices = functionTypeIndices;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmReadFunctionNames(
+    WasmModule* module,
+    Buffer* buffer
+) {
+    U32 functionCount = module->functionImports.length + module->functions.count;
+    U32 nameCount = 0;
+    U32 nameIndex = 0;
+
+    MUST (leb128ReadU32(buffer, &nameCount) > 0)
+
+    module->functionNames.names = calloc(functionCount, sizeof(char*));
+    MUST (functionCount == 0 || module->functionNames.names != NULL)
+    module->functionNames.count = functionCount;
+
+    for (; nameIndex < nameCount; nameIndex++) {
+        U32 functionIndex = 0;
+        char* name = NULL;
+        MUST (leb128ReadU32(buffer, &functionIndex) > 0)
+        MUST (wasmReadName(buffer, &name))
+        if (functionIndex < functionCount && module->functionNames.names[functionIndex] == NULL) {
+            module->functionNames.names[functionIndex] = name;
+        } else {
+            free(name);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * wasmReadNameSection reads the function names subsection of the name section.
+ * See https://webassembly.github.io/spec/core/appendix/custom.html#name-section
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmReadNameSection(
+    WasmModule* module,
+    Buffer* buffer
+) {
+    while (!bufferAtEnd(buffer)) {
+        U8 subsectionID = 0;
+        U32 subsectionSize = 0;
+        Buffer subsection;
+
+        MUST (bufferReadByte(buffer, &subsectionID))
+        MUST (leb128ReadU32(buffer, &subsectionSize) > 0)
+        MUST (subsectionSize <= buffer->length)
+
+        subsection.data = buffer->data;
+        subsection.length = subsectionSize;
+        bufferSkipUnchecked(buffer, subsectionSize);
+
+        /* Function names */
+        if (subsectionID == 1) {
+            return wasmReadFunctionNames(module, &subsection);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * wasmReadCustomSection reads the name section and keeps the DWARF sections
+ * needed for line information. Malformed custom sections are ignored
+ */
+static
+void
+wasmReadCustomSection(
+    WasmModuleReader* reader,
+    Buffer section
+) {
+    WasmModule* module = reader->module;
+    char* name = NULL;
+
+    if (!wasmReadName(&section, &name)) {
+        return;
+    }
+
+    if (strcmp(name, "name") == 0) {
+        if (!wasmReadNameSection(module, &section)) {
+            fprintf(stderr, "w2c2: ignoring malformed name section\n");
+        }
+    } else if (strcmp(name, ".debug_line") == 0) {
+        module->debugSections.line = section;
+    } else if (strcmp(name, ".debug_line_str") == 0) {
+        module->debugSections.lineString = section;
+    } else if (strcmp(name, ".debug_str") == 0) {
+        module->debugSections.string = section;
+    } else if (strncmp(name, ".debug_", 7) != 0) {
+        fprintf(stderr, "w2c2: skipping unsupported custom section %s\n", name);
+    }
+
+    free(name);
+}
+
+static WasmSectionReader wasmSectionReaders[] = {
+    /* wasmSectionIDCustom   */ NULL,
+    /* wasmSectionIDType     */ wasmReadTypeSection,
+    /* wasmSectionIDImport   */ wasmReadImportSection,
+    /* wasmSectionIDFunction */ wasmReadFunctionSection,
+    /* wasmSectionIDTable    */ wasmReadTableSection,
+    /* wasmSectionIDMemory   */ wasmReadMemorySection,
+    /* wasmSectionIDGlobal   */ wasmReadGlobalSection,
+    /* wasmSectionIDExport   */ wasmReadExportSection,
+    /* wasmSectionIDStart    */ wasmReadStartSection,
+    /* wasmSectionIDElement  */ wasmReadElementSection,
+    /* wasmSectionIDCode     */ wasmReadCodeSection,
+    /* wasmSectionIDData     */ wasmReadDataSection,
+    /* wasmSectionIDDataCount */ NULL,
+    /* wasmSectionIDTag      */ wasmReadTagSection,
+};
+
+static
+void
+wasmModuleReadSection(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    U8 rawSectionID = 0;
+    WasmSectionID sectionID = 0;
+    U32 sectionSize = 0;
+    U32 sectionParsersCount = sizeof(wasmSectionReaders) / sizeof(wasmSectionReaders[0]);
+
+    /* Read section ID */
+    if (!bufferReadByte(&reader->buffer, &rawSectionID)) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidSectionID
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    sectionID = (WasmSectionID) (rawSectionID);
+
+    /* Read section size */
+    if (leb128ReadU32(&reader->buffer, &sectionSize) == 0) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderInvalidSectionSize
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+
+    if (sectionID == wasmSectionIDCustom && sectionSize <= reader->buffer.length) {
+        Buffer section;
+        section.data = reader->buffer.data;
+        section.length = sectionSize;
+
+        wasmReadCustomSection(reader, section);
+
+        bufferSkipUnchecked(&reader->buffer, sectionSize);
+
+        *error = NULL;
+
+        return;
+    }
+
+    if (sectionID < sectionParsersCount) {
+        WasmSectionReader wasmSectionReader = wasmSectionReaders[sectionID];
+        if (wasmSectionReader != NULL) {
+            U8* start = reader->buffer.data;
+            U8* end = NULL;
+            U8* expectedEnd = NULL;
+
+            wasmSectionReader(reader, error);
+            if (*error != NULL) {
+                return;
+            }
+
+            /* Check section was read completely */
+            end = reader->buffer.data;
+            expectedEnd = start + sectionSize;
+
+            if (end != expectedEnd) {
+                static WasmModuleReaderError wasmModuleReaderError = {
+                    wasmModuleReaderIncorrectSectionRead
+                };
+                *error = &wasmModuleReaderError;
+                return;
+            }
+
+            *error = NULL;
+
+            return;
+        }
+    }
+
+    fprintf(stderr, "w2c2: skipping unsupported %s\n", wasmSectionIDDescription(sectionID));
+
+    bufferSkip(&reader->buffer, sectionSize);
+
+    *error = NULL;
+}
+
+void
+wasmModuleRead(
+    WasmModuleReader* reader,
+    WasmModuleReaderError** error
+) {
+    WasmModule* module = NULL;
+
+    wasmModuleReadMagic(reader, error);
+    if (*error != NULL) {
+        return;
+    }
+
+    module = calloc(sizeof(struct WasmModule), 1);
+    if (module == NULL) {
+        static WasmModuleReaderError wasmModuleReaderError = {
+            wasmModuleReaderAllocationFailed
+        };
+        *error = &wasmModuleReaderError;
+        return;
+    }
+    reader->module = module;
+
+    while (true) {
+        if (bufferAtEnd(&reader->buffer)) {
+            return;
+        }
+
+        wasmModuleReadSection(reader, error);
+        if (*error != NULL) {
+            return;
+        }
+
+        *error = NULL;
+    }
+}
@@ -0,0 +1,19 @@
+#include "valuetype.h"
+
+const char*
+wasmValueTypeDescription(
+    WasmValueType valueType
+) {
+    switch (valueType) {
+        case wasmValueTypeI32:
+            return "i32";
+        case wasmValueTypeI64:
+            return "i64";
+        case wasmValueTypeF32:
+            return "f32";
+        case wasmValueTypeF64:
+            return "f64";
+        default:
+            return "unknown";
+    }
+}
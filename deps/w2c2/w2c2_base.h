@@ -0,0 +1,1138 @@
+#ifndef W2C2_BASE_H
+#define W2C2_BASE_H
+
+#include <stddef.h>
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+
+#ifndef __bool_true_false_are_defined
+typedef enum bool {
+    false, true
+} bool;
+#endif
+
+typedef unsigned char U8;
+typedef char I8;
+
+typedef unsigned short U16;
+typedef short I16;
+
+typedef unsigned int U32;
+typedef int I32;
+
+typedef unsigned long long int U64;
+typedef long long int I64;
+
+typedef float F32;
+typedef double F64;
+
+#define MUST(_) { if (!(_)) { return false; }; }
+
+#define WASM_LITTLE_ENDIAN  0
+#define WASM_BIG_ENDIAN     1
+
+/*
+ * Endianness detection courtesy of RapidJSON,
+ * extended for more architectures and operating systems
+ */
+#ifndef WASM_ENDIAN
+/* Detect with GCC 4.6's macro */
+#ifdef __BYTE_ORDER__
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define WASM_ENDIAN WASM_LITTLE_ENDIAN
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define WASM_ENDIAN WASM_BIG_ENDIAN
+#else
+#error Unknown endianness. Please define WASM_ENDIAN.
+#endif /* __BYTE_ORDER__ */
+/* Detect with GLIBC's endian.h */
+#elif defined(__GLIBC__)
+#include <endian.h>
+#if (__BYTE_ORDER == __LITTLE_ENDIAN)
+#define WASM_ENDIAN WASM_LITTLE_ENDIAN
+#elif (__BYTE_ORDER == __BIG_ENDIAN)
+#define WASM_ENDIAN WASM_BIG_ENDIAN
+#else
+#error Unknown endianness. Please define WASM_ENDIAN.
+#endif /* __GLIBC__ */
+/* Detect with _LITTLE_ENDIAN and _BIG_ENDIAN macro */
+#elif defined(_LITTLE_ENDIAN) && !defined(_BIG_ENDIAN)
+#define WASM_ENDIAN WASM_LITTLE_ENDIAN
+#elif defined(_BIG_ENDIAN) && !defined(_LITTLE_ENDIAN)
+#define WASM_ENDIAN WASM_BIG_ENDIAN
+/* Detect with __LITTLE_ENDIAN__ and __BIG_ENDIAN__ macro */
+#elif defined(__LITTLE_ENDIAN__) && !defined(__BIG_ENDIAN__)
+#define WASM_ENDIAN WASM_LITTLE_ENDIAN
+#elif defined(__BIG_ENDIAN__) && !defined(__LITTLE_ENDIAN__)
+#define WASM_ENDIAN WASM_BIG_ENDIAN
+/* Detect with architecture and operating system macros */
+#elif defined(__sparc) || defined(__sparc__) \
+    || defined(_POWER) || defined(__powerpc__) || defined(__ppc__) || defined(_POWER) \
+    || defined(__hpux) || defined(__hppa) || defined(__hppa__) \
+    || defined(_MIPSEB) || defined(__MIPSEB) || defined(__MIPSEB__) \
+    || defined(__AARCH64EB__) || defined(__THUMBEB__) || defined(__ARMEB__) || defined(__ARM_BIG_ENDIAN) \
+    || defined(__s390__)
+#define WASM_ENDIAN WASM_BIG_ENDIAN
+#elif defined(__i386__) || defined(_M_IX86) \
+    || defined(__alpha__) || defined(__alpha) || defined(_M_ALPHA) \
+    || defined(__ia64) || defined(__ia64__) || defined(_M_IA64) \
+    || defined(__amd64) || defined(__amd64__) || defined(_M_AMD64) \
+    || defined(__x86_64) || defined(__x86_64__) || defined(_M_X64) \
+    || defined(_M_ARM) || defined(_M_ARM64) \
+    || defined(__AARCH64EL__) || defined(__THUMBEL__) || defined(__ARMEL__) \
+    || defined(_MIPSEL) || defined(__MIPSEL) || defined(__MIPSEL__) \
+    || defined(__bfin__)
+#define WASM_ENDIAN WASM_LITTLE_ENDIAN
+#else
+#error Unknown machine endianness detected. User needs to define WASM_ENDIAN.
+#endif
+#endif /* WASM_ENDIAN */
+
+#if WASM_ENDIAN == WASM_BIG_ENDIAN
+/*
+ * Mask, and then shift.
+ * Mask, and then shift.
+ * Mask, and then shift.
+ * Mask, and then shift.
+ */
+#define swap32(x) ((((x) & 0xFF000000) >> 24) \
+                 | (((x) & 0x00FF0000) >> 8 ) \
+                 | (((x) & 0x0000FF00) << 8 ) \
+                 | (((x) & 0x000000FF) << 24))
+#define swap64(x) ((((x) & 0xff00000000000000ull) >> 56) \
+                 | (((x) & 0x00ff000000000000ull) >> 40) \
+                 | (((x) & 0x0000ff0000000000ull) >> 24) \
+                 | (((x) & 0x000000ff00000000ull) >> 8 ) \
+                 | (((x) & 0x00000000ff000000ull) << 8 ) \
+                 | (((x) & 0x0000000000ff0000ull) << 24) \
+                 | (((x) & 0x000000000000ff00ull) << 40) \
+                 | (((x) & 0x00000000000000ffull) << 56))
+#elif WASM_ENDIAN == WASM_LITTLE_ENDIAN
+#define swap32(x) (x)
+#define swap64(x) (x)
+#endif
+
+#ifdef __GNUC__
+#define WARN_UNUSED_RESULT __attribute__((warn_unused_result))
+#else
+#define WARN_UNUSED_RESULT
+#endif
+
+#ifdef __GNUC__
+#define NORETURN __attribute__((noreturn))
+#else
+#define NORETURN
+#endif
+
+#ifndef __has_attribute
+#define __has_attribute(x) 0
+#endif
+
+#ifdef __GNUC__
+#define COLD __attribute__((cold))
+#define LIKELY(x) __builtin_expect(!!(x), 1)
+#define UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define COLD
+#define LIKELY(x) (x)
+#define UNLIKELY(x) (x)
+#endif
+
+/* Tail calls (return_call, return_call_indirect).
+ * A tail call of a function with the same signature as the caller is
+ * guaranteed by the compiler (musttail) where it is supported.
+ * All other tail calls, and all of them without compiler support,
+ * go through a trampoline: the caller stores the arguments of the call,
+ * leaves the call pending in wasmTailCall and returns, and the
+ * next caller up makes the pending calls in a loop (WASM_TAIL_CALLS).
+ * Define WASM_MUSTTAIL as 0 to use the trampoline for all tail calls. */
+#ifndef WASM_MUSTTAIL
+#if __has_attribute(musttail)
+#define WASM_MUSTTAIL 1
+#else
+#define WASM_MUSTTAIL 0
+#endif
+#endif
+
+#if WASM_MUSTTAIL
+#define MUSTTAIL __attribute__((musttail))
+#else
+#define MUSTTAIL
+#endif
+
+extern void (*wasmTailCall)(void);
+extern void (*wasmTailCallee)(void);
+
+#define WASM_TAIL_CALLS(type, result)                   \
+    while (UNLIKELY(wasmTailCall != NULL)) {            \
+        type (*tailCall)(void) =                        \
+            (type (*)(void)) wasmTailCall;              \
+        wasmTailCall = NULL;                            \
+        (result) = tailCall();                          \
+    }
+
+#define WASM_TAIL_CALLS_VOID()                          \
+    while (UNLIKELY(wasmTailCall != NULL)) {            \
+        void (*tailCall)(void) = wasmTailCall;          \
+        wasmTailCall = NULL;                            \
+        tailCall();                                     \
+    }
+
+#ifndef LLONG_MIN
+#define LLONG_MIN (-0x7fffffffffffffffLL-1)
+#endif
+
+#ifndef LLONG_MAX
+#define LLONG_MAX 0x7fffffffffffffffLL
+#endif
+
+#ifndef INT32_MIN
+#define INT32_MIN (-0x7fffffff - 1)
+#endif
+
+#ifndef INT32_MAX
+#define INT32_MAX 2147483647
+#endif
+
+#ifndef INT64_MIN
+#define INT64_MIN (-0x7fffffffffffffff - 1)
+#endif
+
+#ifndef INT64_MAX
+#define INT64_MAX 9223372036854775807LL
+#endif
+
+#ifndef UINT32_MAX
+#define UINT32_MAX 4294967295U
+#endif
+
+#ifndef UINT64_MAX
+#define UINT64_MAX 18446744073709551615ULL
+#endif
+
+typedef enum {
+    trapUnreachable,
+    trapDivByZero,
+    trapIntOverflow,
+    trapInvalidConversion,
+    trapMemoryOutOfBounds,
+    trapInterrupted,
+    trapUncaughtException,
+    trapCallStackExhausted
+} Trap;
+
+static
+__inline
+const char*
+trapDescription(
+    Trap trap
+) {
+    switch (trap) {
+        case trapUnreachable:
+            return "unreachable";
+        case trapDivByZero:
+            return "div by zero";
+        case trapIntOverflow:
+            return "int overflow";
+        case trapInvalidConversion:
+            return "invalid conversion";
+        case trapMemoryOutOfBounds:
+            return "out of bounds memory access";
+        case trapInterrupted:
+            return "interrupted";
+        case trapUncaughtException:
+            return "uncaught exception";
+        case trapCallStackExhausted:
+            return "call stack exhausted";
+        default:
+            return "unknown";
+    }
+}
+
+extern NORETURN void trap(Trap);
+
+/*
+ * While a trap-safe export wrapper runs, wasmTrapTarget points to its jump buffer,
+ * and trap() may return to the wrapper with longjmp(*wasmTrapTarget, trap + 1)
+ */
+extern jmp_buf* wasmTrapTarget;
+
+#define TRAP(x) (trap(x), 0)
+
+/*
+ * Epoch interruption: with WASM_INTERRUPTS, every function entry and loop
+ * header compares wasmEpoch, which the host bumps (e.g. from a timer thread),
+ * with wasmEpochDeadline. Once the deadline is reached, wasmInterrupt() is
+ * called: it either traps with trapInterrupted or returns to continue,
+ * after moving the deadline
+ */
+#ifndef WASM_INTERRUPTS
+#define WASM_INTERRUPTS 0
+#endif
+
+#if WASM_INTERRUPTS
+extern volatile U64 wasmEpoch;
+extern U64 wasmEpochDeadline;
+extern COLD void wasmInterrupt(void);
+
+#define WASM_INTERRUPT_CHECK()                          \
+    if (UNLIKELY(wasmEpoch >= wasmEpochDeadline)) {     \
+        wasmInterrupt();                                \
+    }
+#else
+#define WASM_INTERRUPT_CHECK()
+#endif
+
+#define UNREACHABLE TRAP(trapUnreachable)
+
+/*
+ * Exception handling: throw stores the tag and the values of the exception
+ * in wasmPendingException and returns, and every call that may throw is
+ * followed by a check of the tag, which branches to the enclosing catch
+ * or returns to the caller. No state is saved on entry to a try block.
+ * Tags are only compared by address. An exception escaping the entry
+ * point is reported by the host as trapUncaughtException
+ */
+#define WASM_EXCEPTION_VALUES 8
+
+typedef struct wasmTag {
+    U8 unused;
+} wasmTag;
+
+typedef struct wasmException {
+    const wasmTag* tag;
+    U64 values[WASM_EXCEPTION_VALUES];
+} wasmException;
+
+extern wasmException wasmPendingException;
+
+#define DIV_S(ut, min, x, y)                            \
+   (((y) == 0)                  ? TRAP(trapDivByZero)   \
+  : ((x) == (min) && (y) == -1) ? TRAP(trapIntOverflow) \
+  : (ut)((x) / (y)))
+
+#define REM_S(ut, min, x, y)                          \
+   (((y) == 0)                  ? TRAP(trapDivByZero) \
+  : ((x) == (min) && (y) == -1) ? 0                   \
+  : (ut)((x) % (y)))
+
+#define I32_DIV_S(x, y) DIV_S(U32, INT32_MIN, (I32)(x), (I32)(y))
+#define I64_DIV_S(x, y) DIV_S(U64, INT64_MIN, (I64)(x), (I64)(y))
+#define I32_REM_S(x, y) REM_S(U32, INT32_MIN, (I32)(x), (I32)(y))
+#define I64_REM_S(x, y) REM_S(U64, INT64_MIN, (I64)(x), (I64)(y))
+
+#define DIVREM_U(op, x, y)               \
+   (((y) == 0)    ? TRAP(trapDivByZero)   \
+  : ((x) op (y)))
+
+#define DIV_U(x, y) DIVREM_U(/, x, y)
+#define REM_U(x, y) DIVREM_U(%, x, y)
+
+#define ROTL(x, y, mask) \
+  (((x) << ((y) & (mask))) | ((x) >> (((mask) - (y) + 1) & (mask))))
+#define ROTR(x, y, mask) \
+  (((x) >> ((y) & (mask))) | ((x) << (((mask) - (y) + 1) & (mask))))
+
+#define I32_ROTL(x, y) ROTL(x, y, 31)
+#define I64_ROTL(x, y) ROTL(x, y, 63)
+#define I32_ROTR(x, y) ROTR(x, y, 31)
+#define I64_ROTR(x, y) ROTR(x, y, 63)
+
+#ifndef __has_builtin
+#define __has_builtin(x) 0
+#endif
+
+#if __has_builtin(__builtin_popcount)
+#define I32_POPCNT(x) __builtin_popcount(x)
+#else
+static
+__inline__
+U32
+I32_POPCNT(
+    U32 x
+) {
+    x -= ((x >> 1) & 0x55555555u);
+    x = ((x >> 2) & 0x33333333u) + (x & 0x33333333u);
+    x = ((x >> 4) + x) & 0x0F0F0F0Fu;
+    x *= 0x01010101u;
+    return (x >> 24);
+}
+#endif
+
+#if __has_builtin(__builtin_popcountll)
+#define I64_POPCNT(x) __builtin_popcountll(x)
+#else
+static
+__inline__
+U64 I64_POPCNT(U64 x) {
+    x -= ((x >> 1) & 0x5555555555555555ull);
+    x = ((x >> 2) & 0x3333333333333333ull) + (x & 0x3333333333333333ull);
+    x = ((x >> 4) + x) & 0xf0f0f0f0f0f0f0full;
+    x *= 0x101010101010101ull;
+    return (x >> 56);
+}
+#endif
+
+#if __has_builtin(__builtin_clz)
+/* __builtin_clz(0) is undefined */
+#define I32_CLZ(x) ((x) ? __builtin_clz(x) : 32)
+#else
+/* From Hacker's Delight 2nd Edition */
+static
+__inline__
+U32
+I32_CLZ(
+    U32 x
+) {
+    I32 n = 32;
+    U32 y = x >> 16;
+    if (y != 0) {
+        n -= 16;
+        x = y;
+    }
+    y = x >> 8;
+    if (y != 0) {
+        n -= 8;
+        x = y;
+    }
+    y = x >> 4;
+    if (y != 0) {
+        n -= 4;
+        x = y;
+    }
+    y = x >> 2;
+    if (y != 0) {
+        n -= 2;
+        x = y;
+    }
+    y = x >> 1;
+    if (y != 0) {
+        return n - 2;
+    }
+    return n - x;
+}
+#endif
+
+#if __has_builtin(__builtin_clzll)
+/* __builtin_clzll(0) is undefined */
+#define I64_CLZ(x) ((x) ? __builtin_clzll(x) : 64)
+#else
+/* From Hacker's Delight 2nd Edition */
+static
+__inline__
+U64
+I64_CLZ(
+    U64 x
+) {
+    I64 n = 64;
+    U64 y = x >> 32;
+    if (y != 0) {
+        n -= 32;
+        x = y;
+    }
+    y = x >> 16;
+    if (y != 0) {
+        n -= 16;
+        x = y;
+    }
+    y = x >> 8;
+    if (y != 0) {
+        n -= 8;
+        x = y;
+    }
+    y = x >> 4;
+    if (y != 0) {
+        n -= 4;
+        x = y;
+    }
+    y = x >> 2;
+    if (y != 0) {
+        n -= 2;
+        x = y;
+    }
+    y = x >> 1;
+    if (y != 0) {
+        return n - 2;
+    }
+    return n - x;
+}
+#endif
+
+#if __has_builtin(__builtin_ctz)
+/* __builtin_ctz(0) is undefined */
+#define I32_CTZ(x) ((x) ? __builtin_ctz(x) : 32)
+#else
+/* From Hacker's Delight 2nd Edition */
+static
+__inline__
+U32
+I32_CTZ(
+    U32 x
+) {
+    return 32 - I32_CLZ(~x & (x - 1));
+}
+#endif
+
+#if __has_builtin(__builtin_ctzll)
+/* __builtin_ctzll(0) is undefined */
+#define I64_CTZ(x) ((x) ? __builtin_ctzll(x) : 64)
+#else
+/* From Hacker's Delight 2nd Edition */
+static
+__inline__
+U64
+I64_CTZ(
+    U64 x
+) {
+    return 64 - I64_CLZ(~x & (x - 1));
+}
+#endif
+
+#define FMIN(x, y)                                    \
+   (((x) != (x)) ? NAN                                \
+  : ((y) != (y)) ? NAN                                \
+  : ((x) == 0 && (y) == 0) ? (signbit(x) ? (x) : (y)) \
+  : ((x) < (y)) ? (x) : (y))
+
+#define FMAX(x, y)                                    \
+   (((x) != (x)) ? NAN                                \
+  : ((y) != (y)) ? NAN                                \
+  : ((x) == 0 && (y) == 0) ? (signbit(x) ? (y) : (x)) \
+  : ((x) > (y)) ? (x) : (y))
+
+/*
+ * Trapping float-to-int conversions.
+ *
+ * The range and NaN checks only guard the cold trap path. On x86-64 the
+ * hardware conversion runs first: NaN and out-of-range inputs produce the
+ * "integer indefinite" value (the minimum signed integer), and only then
+ * the input is checked.
+ */
+
+static
+__inline__
+COLD
+NORETURN
+void
+wasmTruncTrap(
+    F64 x
+) {
+    trap(x != x ? trapInvalidConversion : trapIntOverflow);
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+/*
+ * The conversion instructions are used through inline assembly, as compilers
+ * treat the intrinsics like C casts and may fold them for out-of-range inputs
+ */
+#define DEFINE_CVTT(name, it, ft, insn)                           \
+    static __inline__ it name(ft x) {                             \
+        it result;                                                \
+        __asm__(insn " %1, %0" : "=r" (result) : "xm" (x));       \
+        return result;                                            \
+    }
+
+DEFINE_CVTT(wasmCvttF32I32, I32, F32, "cvttss2si")
+DEFINE_CVTT(wasmCvttF32I64, I64, F32, "cvttss2si")
+DEFINE_CVTT(wasmCvttF64I32, I32, F64, "cvttsd2si")
+DEFINE_CVTT(wasmCvttF64I64, I64, F64, "cvttsd2si")
+
+#define DEFINE_TRUNC_S(name, ut, st, ft, convert, min, minop, max) \
+    static __inline__ ut name(ft x) {                              \
+        st result = convert(x);                                    \
+        if (UNLIKELY((ut)result == (ut)1 << (sizeof(ut) * 8 - 1))  \
+            && !(x minop (min) && x < (max))) {                    \
+            wasmTruncTrap(x);                                      \
+        }                                                          \
+        return (ut)result;                                         \
+    }
+
+DEFINE_TRUNC_S(I32_TRUNC_S_F32, U32, I32, F32, wasmCvttF32I32, -2147483648.f, >=, 2147483648.f)
+DEFINE_TRUNC_S(I64_TRUNC_S_F32, U64, I64, F32, wasmCvttF32I64, -9223372036854775808.f, >=, 9223372036854775808.f)
+DEFINE_TRUNC_S(I32_TRUNC_S_F64, U32, I32, F64, wasmCvttF64I32, -2147483649., >, 2147483648.)
+DEFINE_TRUNC_S(I64_TRUNC_S_F64, U64, I64, F64, wasmCvttF64I64, -9223372036854775808., >=, 9223372036854775808.)
+
+/* Any valid input converts to a 64-bit integer within [0, UINT32_MAX] */
+#define DEFINE_TRUNC_U32(name, ft, convert)          \
+    static __inline__ U32 name(ft x) {               \
+        I64 result = convert(x);                     \
+        if (UNLIKELY((U64)result > UINT32_MAX)) {    \
+            wasmTruncTrap(x);                        \
+        }                                            \
+        return (U32)result;                          \
+    }
+
+DEFINE_TRUNC_U32(I32_TRUNC_U_F32, F32, wasmCvttF32I64)
+DEFINE_TRUNC_U32(I32_TRUNC_U_F64, F64, wasmCvttF64I64)
+
+/* Inputs in [2^63, 2^64) are converted with the top bit flipped */
+#define DEFINE_TRUNC_U64(name, ft, convert)                          \
+    static __inline__ U64 name(ft x) {                               \
+        if (LIKELY(x < (ft)9223372036854775808.)) {                  \
+            I64 result = convert(x);                                 \
+            if (UNLIKELY(result < 0)) {                              \
+                wasmTruncTrap(x);                                    \
+            }                                                        \
+            return (U64)result;                                      \
+        }                                                            \
+        if (UNLIKELY(!(x < (ft)18446744073709551616.))) {            \
+            wasmTruncTrap(x);                                        \
+        }                                                            \
+        return (U64)convert(x - (ft)9223372036854775808.)            \
+            ^ 0x8000000000000000ull;                                 \
+    }
+
+DEFINE_TRUNC_U64(I64_TRUNC_U_F32, F32, wasmCvttF32I64)
+DEFINE_TRUNC_U64(I64_TRUNC_U_F64, F64, wasmCvttF64I64)
+
+#else
+
+#define TRUNC_S(ut, st, ft, min, minop, max, x)                  \
+   (UNLIKELY(!((x)minop(min) && (x) < (max))) ? wasmTruncTrap(x), 0 \
+  : (ut)(st)(x))
+
+#define I32_TRUNC_S_F32(x) TRUNC_S(U32, I32, F32, (F32)INT32_MIN, >=, 2147483648.f, x)
+#define I64_TRUNC_S_F32(x) TRUNC_S(U64, I64, F32, (F32)INT64_MIN, >=, (F32)INT64_MAX, x)
+#define I32_TRUNC_S_F64(x) TRUNC_S(U32, I32, F64, -2147483649., >, 2147483648., x)
+#define I64_TRUNC_S_F64(x) TRUNC_S(U64, I64, F64, (F64)INT64_MIN, >=, (F64)INT64_MAX, x)
+
+#define TRUNC_U(ut, ft, max, x)                                 \
+   (UNLIKELY(!((x) > (ft)-1 && (x) < (max))) ? wasmTruncTrap(x), 0 \
+  : (ut)(x))
+
+#define I32_TRUNC_U_F32(x) TRUNC_U(U32, F32, 4294967296.f, x)
+#define I64_TRUNC_U_F32(x) TRUNC_U(U64, F32, (F32)UINT64_MAX, x)
+#define I32_TRUNC_U_F64(x) TRUNC_U(U32, F64, 4294967296., x)
+#define I64_TRUNC_U_F64(x) TRUNC_U(U64, F64, (F64)UINT64_MAX, x)
+
+#endif
+
+/*
+ * Saturating float-to-int conversions (trunc_sat).
+ *
+ * These are built from selects and masks only, so no branches are needed.
+ */
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+/* Out-of-range inputs convert to the minimum, which is flipped for positive inputs */
+#define DEFINE_TRUNC_SAT_S(name, ut, ft, convert)                          \
+    static __inline__ ut name(ft x) {                                      \
+        ut result = (ut)convert(x);                                        \
+        ut overflow = (ut)((result == (ut)1 << (sizeof(ut) * 8 - 1)) & (x > 0)); \
+        result ^= (ut)0 - overflow;                                        \
+        return result & ((ut)0 - (ut)(x == x));                            \
+    }
+
+DEFINE_TRUNC_SAT_S(I32_TRUNC_SAT_S_F32, U32, F32, wasmCvttF32I32)
+DEFINE_TRUNC_SAT_S(I64_TRUNC_SAT_S_F32, U64, F32, wasmCvttF32I64)
+DEFINE_TRUNC_SAT_S(I32_TRUNC_SAT_S_F64, U32, F64, wasmCvttF64I32)
+DEFINE_TRUNC_SAT_S(I64_TRUNC_SAT_S_F64, U64, F64, wasmCvttF64I64)
+
+#include <emmintrin.h>
+
+/* maxss/maxsd return the second operand if the first is NaN, so NaN becomes zero */
+static __inline__ F32 wasmClampPositiveF32(F32 x) {
+    return _mm_cvtss_f32(_mm_max_ss(_mm_set_ss(x), _mm_setzero_ps()));
+}
+
+static __inline__ F64 wasmClampPositiveF64(F64 x) {
+    return _mm_cvtsd_f64(_mm_max_sd(_mm_set_sd(x), _mm_setzero_pd()));
+}
+
+/* Too large inputs convert to the minimum, which is above UINT32_MAX as unsigned */
+#define DEFINE_TRUNC_SAT_U32(name, ft, convert, clamp)          \
+    static __inline__ U32 name(ft x) {                          \
+        U64 result = (U64)convert(clamp(x));                    \
+        return result > UINT32_MAX ? UINT32_MAX : (U32)result;  \
+    }
+
+DEFINE_TRUNC_SAT_U32(I32_TRUNC_SAT_U_F32, F32, wasmCvttF32I64, wasmClampPositiveF32)
+DEFINE_TRUNC_SAT_U32(I32_TRUNC_SAT_U_F64, F64, wasmCvttF64I64, wasmClampPositiveF64)
+
+/* Inputs in [2^63, 2^64) are converted with the top bit flipped */
+#define DEFINE_TRUNC_SAT_U64(name, ft, convert, clamp)                       \
+    static __inline__ U64 name(ft x) {                                       \
+        ft clamped = clamp(x);                                               \
+        U64 high = (U64)(clamped >= (ft)9223372036854775808.);               \
+        U64 result = (U64)convert(clamped - (ft)high * (ft)9223372036854775808.) \
+            ^ (high << 63);                                                  \
+        return result | ((U64)0 - (U64)(clamped >= (ft)18446744073709551616.)); \
+    }
+
+DEFINE_TRUNC_SAT_U64(I64_TRUNC_SAT_U_F32, F32, wasmCvttF32I64, wasmClampPositiveF32)
+DEFINE_TRUNC_SAT_U64(I64_TRUNC_SAT_U_F64, F64, wasmCvttF64I64, wasmClampPositiveF64)
+
+#else
+
+/* NaN is replaced by zero, inputs at or above the limit select the maximum */
+#define DEFINE_TRUNC_SAT(name, ut, st, ft, min, limit, max)      \
+    static __inline__ ut name(ft x) {                            \
+        ft clamped = x < (min) ? (min) : x;                      \
+        clamped = x == x ? clamped : 0;                          \
+        return clamped >= (limit) ? (ut)(max) : (ut)(st)clamped; \
+    }
+
+DEFINE_TRUNC_SAT(I32_TRUNC_SAT_S_F32, U32, I32, F32, -2147483648.f, 2147483648.f, INT32_MAX)
+DEFINE_TRUNC_SAT(I64_TRUNC_SAT_S_F32, U64, I64, F32, -9223372036854775808.f, 9223372036854775808.f, INT64_MAX)
+DEFINE_TRUNC_SAT(I32_TRUNC_SAT_S_F64, U32, I32, F64, -2147483648., 2147483648., INT32_MAX)
+DEFINE_TRUNC_SAT(I64_TRUNC_SAT_S_F64, U64, I64, F64, -9223372036854775808., 9223372036854775808., INT64_MAX)
+DEFINE_TRUNC_SAT(I32_TRUNC_SAT_U_F32, U32, U32, F32, 0.f, 4294967296.f, UINT32_MAX)
+DEFINE_TRUNC_SAT(I64_TRUNC_SAT_U_F32, U64, U64, F32, 0.f, 18446744073709551616.f, UINT64_MAX)
+DEFINE_TRUNC_SAT(I32_TRUNC_SAT_U_F64, U32, U32, F64, 0., 4294967296., UINT32_MAX)
+DEFINE_TRUNC_SAT(I64_TRUNC_SAT_U_F64, U64, U64, F64, 0., 18446744073709551616., UINT64_MAX)
+
+#endif
+
+#define DEFINE_REINTERPRET(name, t1, t2)  \
+  static __inline__ t2 name(t1 x) {       \
+    t2 result;                            \
+    memcpy(&result, &x, sizeof(result));  \
+    return result;                        \
+  }
+
+DEFINE_REINTERPRET(f32_reinterpret_i32, U32, F32)
+DEFINE_REINTERPRET(i32_reinterpret_f32, F32, U32)
+DEFINE_REINTERPRET(f64_reinterpret_i64, U64, F64)
+DEFINE_REINTERPRET(i64_reinterpret_f64, F64, U64)
+
+typedef struct {
+    U8* data;
+    U32 pages, maxPages;
+    /* In bytes, 64-bit for memories larger than 4 GiB (memory64) */
+    U64 size;
+    /* Pages allocated for the backing store, at least pages */
+    U32 reservedPages;
+    /* Pages of address space the backing store can grow into without moving */
+    U32 mappedPages;
+    /* Telemetry: successful memory.grow calls and backing store reallocations */
+    U32 growCount;
+    U32 reallocCount;
+} wasmMemory;
+
+/*
+ * The memory host functions access. Modules linked into one program (w2c2 -x)
+ * set it to their own memory while they call an import
+ */
+extern wasmMemory* wasmImportMemory;
+
+#define WASM_PAGE_SIZE 65536
+
+/*
+ * Linear memory checks:
+ * 0 - none, accesses are not checked
+ * 1 - bounds checks, out of bounds accesses trap
+ * 2 - address masking, out of bounds accesses wrap around.
+ *     Requires a fixed memory with a power of two number of pages
+ *     on a little-endian target, otherwise bounds checks are used
+ */
+#ifndef WASM_MEMORY_CHECKS
+#define WASM_MEMORY_CHECKS 0
+#endif
+
+/*
+ * Translated modules define WASM_FIXED_MEMORY_PAGES before including this header
+ * if their memory can not grow, so its size and all checks are constant
+ */
+#ifdef WASM_FIXED_MEMORY_PAGES
+#define WASM_MEMORY_SIZE(mem) ((U64)WASM_FIXED_MEMORY_PAGES * WASM_PAGE_SIZE)
+#else
+#define WASM_MEMORY_SIZE(mem) ((U64)(mem)->size)
+#endif
+
+#if WASM_MEMORY_CHECKS == 2 && defined(WASM_FIXED_MEMORY_PAGES) \
+    && WASM_FIXED_MEMORY_PAGES > 0 && (WASM_FIXED_MEMORY_PAGES & (WASM_FIXED_MEMORY_PAGES - 1)) == 0
+/* Masked addresses may access up to 7 bytes past the end of the memory */
+#define WASM_MEMORY_SLACK 8
+#define WASM_CHECK_ADDRESS(mem, addr, n) \
+    addr &= WASM_MEMORY_SIZE(mem) - 1;
+#elif WASM_MEMORY_CHECKS != 0 && defined(WASM_MEMORY64)
+/* 64-bit addresses may be close enough to 2^64 for addr + n to overflow */
+#define WASM_MEMORY_SLACK 0
+#define WASM_CHECK_ADDRESS(mem, addr, n)                                           \
+    if (UNLIKELY((addr) > WASM_MEMORY_SIZE(mem) || WASM_MEMORY_SIZE(mem) - (addr) < (n))) { \
+        trap(trapMemoryOutOfBounds);                                               \
+    }
+#elif WASM_MEMORY_CHECKS != 0
+#define WASM_MEMORY_SLACK 0
+#define WASM_CHECK_ADDRESS(mem, addr, n)                \
+    if (UNLIKELY((addr) + (n) > WASM_MEMORY_SIZE(mem))) { \
+        trap(trapMemoryOutOfBounds);                    \
+    }
+#else
+#define WASM_MEMORY_SLACK 0
+#define WASM_CHECK_ADDRESS(mem, addr, n)
+#endif
+
+/*
+ * Backing store growth policy:
+ * 0 - exact, the backing store is resized to the requested number of pages
+ * 1 - geometric, the backing store at least doubles on each reallocation,
+ *     so guests that grow one page at a time cause few reallocations
+ */
+#ifndef WASM_MEMORY_GROWTH
+#define WASM_MEMORY_GROWTH 0
+#endif
+
+/*
+ * Number of pages to reserve for the backing store up front,
+ * e.g. the peak number of pages recorded by a previous run
+ */
+#ifndef WASM_MEMORY_RESERVE_PAGES
+#define WASM_MEMORY_RESERVE_PAGES 0
+#endif
+
+/*
+ * On Linux the backing store is mapped directly, so it is page aligned,
+ * which allows hosts to map files into linear memory. The address space for
+ * the maximum number of pages is reserved inaccessible up front and pages are
+ * made accessible as the memory grows, so the backing store never moves
+ */
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#include <sys/mman.h>
+#define WASM_MEMORY_MMAP 1
+#else
+#define WASM_MEMORY_MMAP 0
+#endif
+
+/*
+ * Called by wasmAllocateMemory and wasmGrowMemory with the range of the backing
+ * store whenever pages are mapped or made accessible, so the host can apply a
+ * placement policy to them
+ */
+#if WASM_MEMORY_MMAP
+void wasmMemoryMapped(wasmMemory* memory, U8* start, size_t length);
+#endif
+
+#if WASM_MEMORY_MMAP
+
+/*
+ * Reserves inaccessible address space for maxPages, or as much of it as
+ * can be reserved but at least reservedPages, and makes reservedPages accessible
+ */
+static
+__inline__
+void
+wasmMemoryReserve(
+    wasmMemory* memory,
+    U32 reservedPages,
+    U32 maxPages
+) {
+    void* data = MAP_FAILED;
+    U32 mappedPages = maxPages;
+    while (1) {
+        data = mmap(NULL, (size_t) mappedPages * WASM_PAGE_SIZE + WASM_MEMORY_SLACK, PROT_NONE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (data != MAP_FAILED || mappedPages <= reservedPages) {
+            break;
+        }
+        mappedPages = mappedPages / 2 > reservedPages ? mappedPages / 2 : reservedPages;
+    }
+    if (data != MAP_FAILED
+        && mprotect(data, (size_t) reservedPages * WASM_PAGE_SIZE + WASM_MEMORY_SLACK,
+                    PROT_READ | PROT_WRITE) != 0) {
+        munmap(data, (size_t) mappedPages * WASM_PAGE_SIZE + WASM_MEMORY_SLACK);
+        data = MAP_FAILED;
+    }
+    memory->data = data == MAP_FAILED ? NULL : data;
+    memory->mappedPages = data == MAP_FAILED ? 0 : mappedPages;
+}
+
+#endif
+
+static
+__inline__
+void
+wasmAllocateMemory(
+    wasmMemory* memory,
+    U32 initialPages,
+    U32 maxPages
+) {
+    U64 size = (U64) initialPages * WASM_PAGE_SIZE;
+    U32 reservedPages = initialPages;
+#if WASM_MEMORY_RESERVE_PAGES > 0
+    if (WASM_MEMORY_RESERVE_PAGES > reservedPages) {
+        reservedPages = WASM_MEMORY_RESERVE_PAGES < maxPages ? WASM_MEMORY_RESERVE_PAGES : maxPages;
+    }
+#endif
+#if WASM_MEMORY_MMAP
+    wasmMemoryReserve(memory, reservedPages, maxPages);
+#else
+    memory->data = calloc((size_t) reservedPages * WASM_PAGE_SIZE + WASM_MEMORY_SLACK, 1);
+    memory->mappedPages = reservedPages;
+#endif
+    memory->size = size;
+    memory->pages = initialPages;
+    memory->maxPages = maxPages;
+    memory->reservedPages = reservedPages;
+    memory->growCount = 0;
+    memory->reallocCount = 0;
+#if WASM_MEMORY_MMAP
+    if (memory->data != NULL) {
+        wasmMemoryMapped(memory, memory->data, (size_t) reservedPages * WASM_PAGE_SIZE);
+    }
+#endif
+}
+
+static
+__inline__
+U32
+wasmGrowMemory(
+    wasmMemory* memory,
+    U32 delta
+) {
+    U32 oldPages = memory->pages;
+    U32 newPages = memory->pages + delta;
+
+    if (newPages == 0) {
+        return 0;
+    }
+
+    if (newPages < oldPages || newPages > memory->maxPages) {
+        return (U32) -1;
+    }
+
+    {
+        U64 oldSize = (U64) oldPages * WASM_PAGE_SIZE;
+        U64 newSize = (U64) newPages * WASM_PAGE_SIZE;
+        U64 deltaSize = (U64) delta * WASM_PAGE_SIZE;
+        U8* newData = memory->data;
+
+        U64 clearSize = deltaSize;
+
+        if (newPages > memory->reservedPages) {
+            U32 reservedPages = newPages;
+#if WASM_MEMORY_GROWTH == 1
+            if (memory->reservedPages > memory->maxPages / 2) {
+                reservedPages = memory->maxPages;
+            } else if (memory->reservedPages * 2 > reservedPages) {
+                reservedPages = memory->reservedPages * 2;
+            }
+#endif
+#if WASM_MEMORY_MMAP
+            /* Growing past the reservation would move the memory and the files mapped into it */
+            if (newPages > memory->mappedPages) {
+                return (U32) -1;
+            }
+            if (reservedPages > memory->mappedPages) {
+                reservedPages = memory->mappedPages;
+            }
+            if (mprotect(
+                    newData + (size_t) memory->reservedPages * WASM_PAGE_SIZE,
+                    (size_t) (reservedPages - memory->reservedPages) * WASM_PAGE_SIZE,
+                    PROT_READ | PROT_WRITE
+                ) != 0) {
+                return (U32) -1;
+            }
+            /* Pages which were inaccessible until now are still zero */
+            clearSize = (U64) memory->reservedPages * WASM_PAGE_SIZE - oldSize;
+            wasmMemoryMapped(
+                memory,
+                newData + (size_t) memory->reservedPages * WASM_PAGE_SIZE,
+                (size_t) (reservedPages - memory->reservedPages) * WASM_PAGE_SIZE
+            );
+#else
+            newData = realloc(
+                memory->data,
+                (size_t) reservedPages * WASM_PAGE_SIZE + WASM_MEMORY_SLACK
+            );
+            if (newData == NULL) {
+                return (U32) -1;
+            }
+#endif
+            memory->data = newData;
+            memory->reservedPages = reservedPages;
+            memory->reallocCount++;
+        }
+
+        memset(newData + oldSize, 0, clearSize);
+        memory->pages = newPages;
+        memory->size = newSize;
+        memory->data = newData;
+        memory->growCount++;
+    }
+
+    return oldPages;
+}
+
+/*
+ * memory.grow of a 64-bit memory (memory64): deltas and results are i64
+ */
+static
+__inline__
+U64
+wasmGrowMemory64(
+    wasmMemory* memory,
+    U64 delta
+) {
+    U32 oldPages = 0;
+    if (delta > memory->maxPages) {
+        return (U64) -1;
+    }
+    oldPages = wasmGrowMemory(memory, (U32) delta);
+    return oldPages == (U32) -1 ? (U64) -1 : oldPages;
+}
+
+/*
+ * Effective address of a load or store in a 64-bit memory:
+ * an address which overflows is out of bounds
+ */
+static
+__inline__
+U64
+wasmAddress64(
+    U64 address,
+    U64 offset
+) {
+#if WASM_MEMORY_CHECKS != 0
+    if (UNLIKELY(address + offset < address)) {
+        trap(trapMemoryOutOfBounds);
+    }
+#endif
+    return address + offset;
+}
+
+static __inline__ void load_data(void *dest, const void *src, size_t n) {
+    memcpy(dest, src, n);
+}
+
+#define LOAD_DATA(m, o, i, s) \
+    load_data(&((m).data[o]), i, s)
+
+#if WASM_ENDIAN == WASM_BIG_ENDIAN
+
+/*
+ * Linear memory is kept in WebAssembly (little-endian) byte order on big-endian hosts too,
+ * so it grows in place and WASI calls can hand guest buffers to the OS as they are.
+ * Loads and stores swap the value instead; compilers fuse the swap into byte-reversed
+ * loads and stores where the ISA has them (lrv/strv on s390x, lwbrx/stwbrx on POWER).
+ */
+#if __has_builtin(__builtin_bswap64) \
+    || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8)))
+#define wasmSwap16(x) __builtin_bswap16(x)
+#define wasmSwap32(x) __builtin_bswap32(x)
+#define wasmSwap64(x) __builtin_bswap64(x)
+#else
+#define wasmSwap16(x) ((U16) (((x) >> 8) | ((x) << 8)))
+#define wasmSwap32(x) swap32(x)
+#define wasmSwap64(x) swap64(x)
+#endif
+
+static __inline__ void wasmSwapBytes(void* value, size_t n) {
+    switch (n) {
+        case 2: {
+            U16 x;
+            memcpy(&x, value, 2);
+            x = wasmSwap16(x);
+            memcpy(value, &x, 2);
+            break;
+        }
+        case 4: {
+            U32 x;
+            memcpy(&x, value, 4);
+            x = wasmSwap32(x);
+            memcpy(value, &x, 4);
+            break;
+        }
+        case 8: {
+            U64 x;
+            memcpy(&x, value, 8);
+            x = wasmSwap64(x);
+            memcpy(value, &x, 8);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+#define DEFINE_LOAD(name, t1, t2, t3)                       \
+    static __inline__ t3 name(wasmMemory* mem, U64 addr) {  \
+        t1 result;                                          \
+        WASM_CHECK_ADDRESS(mem, addr, sizeof(t1))           \
+        memcpy(&result, &mem->data[addr], sizeof(t1));      \
+        wasmSwapBytes(&result, sizeof(t1));                 \
+        return (t3)(t2)result;                              \
+    }
+
+#define DEFINE_STORE(name, t1, t2)                                       \
+    static __inline__ void name(wasmMemory* mem, U64 addr, t2 value) {   \
+        t1 wrapped = (t1)value;                                          \
+        WASM_CHECK_ADDRESS(mem, addr, sizeof(t1))                        \
+        wasmSwapBytes(&wrapped, sizeof(t1));                             \
+        memcpy(&mem->data[addr], &wrapped, sizeof(t1));                  \
+    }
+
+#elif WASM_ENDIAN == WASM_LITTLE_ENDIAN
+
+#define DEFINE_LOAD(name, t1, t2, t3)                       \
+    static __inline__ t3 name(wasmMemory* mem, U64 addr) {  \
+        t1 result;                                          \
+        WASM_CHECK_ADDRESS(mem, addr, sizeof(t1))           \
+        memcpy(&result, &mem->data[addr], sizeof(t1));      \
+        return (t3)(t2)result;                              \
+    }
+
+#define DEFINE_STORE(name, t1, t2)                                       \
+    static __inline__ void name(wasmMemory* mem, U64 addr, t2 value) {   \
+        t1 wrapped = (t1)value;                                          \
+        WASM_CHECK_ADDRESS(mem, addr, sizeof(t1))                        \
+        memcpy(&mem->data[addr], &wrapped, sizeof(t1));                  \
+    }
+
+#endif
+
+DEFINE_LOAD(i32_load, U32, U32, U32)
+DEFINE_LOAD(i64_load, U64, U64, U64)
+DEFINE_LOAD(f32_load, F32, F32, F32)
+DEFINE_LOAD(f64_load, F64, F64, F64)
+DEFINE_LOAD(i32_load8_s, I8, I32, U32)
+DEFINE_LOAD(i64_load8_s, I8, I64, U64)
+DEFINE_LOAD(i32_load8_u, U8, U32, U32)
+DEFINE_LOAD(i64_load8_u, U8, U64, U64)
+DEFINE_LOAD(i32_load16_s, I16, I32, U32)
+DEFINE_LOAD(i64_load16_s, I16, I64, U64)
+DEFINE_LOAD(i32_load16_u, U16, U32, U32)
+DEFINE_LOAD(i64_load16_u, U16, U64, U64)
+DEFINE_LOAD(i64_load32_s, I32, I64, U64)
+DEFINE_LOAD(i64_load32_u, U32, U64, U64)
+DEFINE_STORE(i32_store, U32, U32)
+DEFINE_STORE(i64_store, U64, U64)
+DEFINE_STORE(f32_store, F32, F32)
+DEFINE_STORE(f64_store, F64, F64)
+DEFINE_STORE(i32_store8, U8, U32)
+DEFINE_STORE(i32_store16, U16, U32)
+DEFINE_STORE(i64_store8, U8, U64)
+DEFINE_STORE(i64_store16, U16, U64)
+DEFINE_STORE(i64_store32, U32, U64)
+
+typedef void (*wasmFunc)(void);
+
+typedef struct {
+    wasmFunc* data;
+    U32 size, maxSize;
+} wasmTable;
+
+static
+__inline__
+void
+wasmAllocateTable(
+    wasmTable* table,
+    U32 size,
+    U32 maxSize
+) {
+    table->size = size;
+    table->maxSize = maxSize;
+    table->data = calloc(size, sizeof(wasmFunc));
+}
+
+#define TF(table, index, t) ((t)((table).data[index]))
+
+#define WASM_IMPORT(returnType, name, parameters, body) \
+  static returnType _##name parameters body             \
+  returnType (*f_##name) parameters = _##name;
+
+#endif /* W2C2_BASE_H */
@@ -0,0 +1,142 @@
+/*
+ * Guest layouts of the WASI structs
+ *
+ * Transcribed from the witx definitions of wasi_unstable and
+ * wasi_snapshot_preview1 (typenames.witx). A struct is a list of
+ * (field, type, offset) entries, the field being the member of the
+ * corresponding uvwasi struct. All offsets and sizes are compile-time
+ * constants: the shims assemble a struct in a local buffer and copy it
+ * to the guest with one store after one range check, or read it the
+ * same way, and the compiler merges the field accesses.
+ *
+ * Pointers and sizes are 64-bit in modules with a 64-bit memory
+ * (memory64), which moves the fields that follow them.
+ *
+ * Guest memory is little-endian, on big-endian hosts values are swapped.
+ */
+
+#ifndef WASI_LAYOUT_H
+#define WASI_LAYOUT_H
+
+#include <string.h>
+
+#if WABT_BIG_ENDIAN
+    #define WASI_LE16(x) __builtin_bswap16(x)
+    #define WASI_LE32(x) __builtin_bswap32(x)
+    #define WASI_LE64(x) __builtin_bswap64(x)
+#else
+    #define WASI_LE16(x) (x)
+    #define WASI_LE32(x) (x)
+    #define WASI_LE64(x) (x)
+#endif
+
+static inline void wasi_put_u8(u8* p, u8 v)   { *p = v; }
+static inline void wasi_put_u16(u8* p, u16 v) { v = WASI_LE16(v); memcpy(p, &v, sizeof(v)); }
+static inline void wasi_put_u32(u8* p, u32 v) { v = WASI_LE32(v); memcpy(p, &v, sizeof(v)); }
+static inline void wasi_put_u64(u8* p, u64 v) { v = WASI_LE64(v); memcpy(p, &v, sizeof(v)); }
+
+static inline u8  wasi_get_u8(const u8* p)  { return *p; }
+static inline u16 wasi_get_u16(const u8* p) { u16 v; memcpy(&v, p, sizeof(v)); return WASI_LE16(v); }
+static inline u32 wasi_get_u32(const u8* p) { u32 v; memcpy(&v, p, sizeof(v)); return WASI_LE32(v); }
+static inline u64 wasi_get_u64(const u8* p) { u64 v; memcpy(&v, p, sizeof(v)); return WASI_LE64(v); }
+
+#ifdef WASM_MEMORY64
+    #define wasi_put_size wasi_put_u64
+    #define wasi_get_size wasi_get_u64
+    #define wasi_get_ptr  wasi_get_u64
+#else
+    #define wasi_put_size wasi_put_u32
+    #define wasi_get_size wasi_get_u32
+    #define wasi_get_ptr  wasi_get_u32
+#endif
+
+#define WASI_SIZE_BYTES ((u64)sizeof(wasm_size))
+
+// Fills the guest image of a struct from a uvwasi value, padding is zeroed
+#define WASI_PUT_FIELD(value, field, type, offset) wasi_put_##type(wasi_image + (offset), (value).field);
+#define WASI_ENCODE(LAYOUT, image, value)       \
+    do {                                        \
+        u8* wasi_image = (image);               \
+        memset(wasi_image, 0, LAYOUT##_SIZE);   \
+        LAYOUT(WASI_PUT_FIELD, value)           \
+    } while (0)
+
+// Fills a uvwasi value from the guest image of a struct
+#define WASI_GET_FIELD(value, field, type, offset) (value).field = wasi_get_##type(wasi_image + (offset));
+#define WASI_DECODE(LAYOUT, image, value)       \
+    do {                                        \
+        const u8* wasi_image = (image);         \
+        LAYOUT(WASI_GET_FIELD, value)           \
+    } while (0)
+
+// prestat: the tag, then the name length of a preopened directory
+#define WASI_PRESTAT(F, v)                          \
+    F(v, pr_type,            u8,   0)               \
+    F(v, u.dir.pr_name_len,  size, WASI_SIZE_BYTES)
+#define WASI_PRESTAT_SIZE (2 * WASI_SIZE_BYTES)
+
+#define WASI_FDSTAT(F, v)                           \
+    F(v, fs_filetype,           u8,   0)            \
+    F(v, fs_flags,              u16,  2)            \
+    F(v, fs_rights_base,        u64,  8)            \
+    F(v, fs_rights_inheriting,  u64, 16)
+#define WASI_FDSTAT_SIZE 24
+
+// filestat: wasi_unstable has a 32-bit link count
+#define WASI_UNSTABLE_FILESTAT(F, v)                \
+    F(v, st_dev,       u64,  0)                     \
+    F(v, st_ino,       u64,  8)                     \
+    F(v, st_filetype,  u8,  16)                     \
+    F(v, st_nlink,     u32, 20)                     \
+    F(v, st_size,      u64, 24)                     \
+    F(v, st_atim,      u64, 32)                     \
+    F(v, st_mtim,      u64, 40)                     \
+    F(v, st_ctim,      u64, 48)
+#define WASI_UNSTABLE_FILESTAT_SIZE 56
+
+#define WASI_PREVIEW1_FILESTAT(F, v)                \
+    F(v, st_dev,       u64,  0)                     \
+    F(v, st_ino,       u64,  8)                     \
+    F(v, st_filetype,  u8,  16)                     \
+    F(v, st_nlink,     u64, 24)                     \
+    F(v, st_size,      u64, 32)                     \
+    F(v, st_atim,      u64, 40)                     \
+    F(v, st_mtim,      u64, 48)                     \
+    F(v, st_ctim,      u64, 56)
+#define WASI_PREVIEW1_FILESTAT_SIZE 64
+
+// subscription: the userdata and the event type, followed by the variant
+// of the type. The clock variant of wasi_unstable starts with an identifier
+#define WASI_SUBSCRIPTION(F, v)                     \
+    F(v, userdata,  u64, 0)                         \
+    F(v, type,      u8,  8)
+
+#define WASI_UNSTABLE_SUBSCRIPTION_CLOCK(F, v)      \
+    F(v, u.clock.clock_id,   u32, 24)               \
+    F(v, u.clock.timeout,    u64, 32)               \
+    F(v, u.clock.precision,  u64, 40)               \
+    F(v, u.clock.flags,      u16, 48)
+#define WASI_UNSTABLE_SUBSCRIPTION_SIZE 56
+
+#define WASI_PREVIEW1_SUBSCRIPTION_CLOCK(F, v)      \
+    F(v, u.clock.clock_id,   u32, 16)               \
+    F(v, u.clock.timeout,    u64, 24)               \
+    F(v, u.clock.precision,  u64, 32)               \
+    F(v, u.clock.flags,      u16, 40)
+#define WASI_PREVIEW1_SUBSCRIPTION_SIZE 48
+
+#define WASI_SUBSCRIPTION_FD_READWRITE(F, v)        \
+    F(v, u.fd_readwrite.fd,  u32, 16)
+
+#define WASI_EVENT(F, v)                            \
+    F(v, userdata,                u64,  0)          \
+    F(v, error,                   u16,  8)          \
+    F(v, type,                    u8,  10)          \
+    F(v, u.fd_readwrite.nbytes,   u64, 16)          \
+    F(v, u.fd_readwrite.flags,    u16, 24)
+#define WASI_EVENT_SIZE 32
+
+// iovec and ciovec: a buffer pointer and its length
+#define WASI_IOVEC_SIZE (2 * WASI_SIZE_BYTES)
+
+#endif // WASI_LAYOUT_H
@@ -14,11 +14,15 @@
 
     #define IMPORT_IMPL_WASI_UNSTABLE(ret, name, params, body)  IMPORT_IMPL(ret, Z_wasi_unstable##name, params, body)
     #define IMPORT_IMPL_WASI_PREVIEW1(ret, name, params, body)  IMPORT_IMPL(ret, Z_wasi_snapshot_preview1##name, params, body)
-    #define IMPORT_IMPL_WASI_ALL(ret, name, params, body) \
-      IMPORT_IMPL_WASI_UNSTABLE(ret, name, params, body)  \
-      IMPORT_IMPL_WASI_PREVIEW1(ret, name, params, body)
+    #define IMPORT_IMPL_WASI_ALL(ret, name, params, body)                          \
+      static ret _wasi##name params body                                          \
+      ret (*WASM_RT_ADD_PREFIX(Z_wasi_unstable##name)) params = _wasi##name;      \
+      ret (*WASM_RT_ADD_PREFIX(Z_wasi_snapshot_preview1##name)) params = _wasi##name;
+
+    #define IMPORT_IMPL_WASM2NATIVE(ret, name, params, body)    IMPORT_IMPL(ret, Z_wasm2native##name, params, body)
 
     #define MEMACCESS(addr) ((void*)&WASM_RT_ADD_PREFIX(Z_memory)->data[(addr)])
+    #define MEMSIZE()       (WASM_RT_ADD_PREFIX(Z_memory)->size)
 
 #else
 
@@ -32,7 +36,48 @@
 
     extern void init();
 
+    // Further modules linked into the program by build.sh, with prefixed symbols and their own memory
+    #if defined(__has_include)
+        #if __has_include("wasm/modules.h")
+            #include "wasm/modules.h"
+        #endif
+    #endif
+
+    // The memory WASI functions access. Linked modules switch to their own while they call an import
+    wasmMemory* wasmImportMemory = NULL;
+
+    // The linked module being instantiated, NULL for the main one
+    static const char* init_module = NULL;
+
+    #ifdef WASM_LINKED_MODULES
+        #define WASM_DECLARE_MODULE_INIT(name) extern void name##_init(void);
+        WASM_LINKED_MODULES(WASM_DECLARE_MODULE_INIT)
+
+        static void init_linked_modules(void) {
+            #define WASM_CALL_MODULE_INIT(name) init_module = #name; name##_init();
+            WASM_LINKED_MODULES(WASM_CALL_MODULE_INIT)
+            init_module = NULL;
+        }
+
+        #define IMPORT_MEMORY() (wasmImportMemory ? wasmImportMemory : e_memory)
+    #else
+        static void init_linked_modules(void) {}
+
+        #define IMPORT_MEMORY() (e_memory)
+    #endif
+
+    // The exception being thrown by the guest, see w2c2_base.h
+    wasmException wasmPendingException;
+
+    // The tail call the guest left pending and the function it calls, see w2c2_base.h
+    void (*wasmTailCall)(void);
+    void (*wasmTailCallee)(void);
+
+    // Traps inside a trap-safe export wrapper return to it, otherwise they end the process
     void trap(Trap trap) {
+        if (wasmTrapTarget) {
+            longjmp(*wasmTrapTarget, trap + 1);
+        }
         exit(1);
     }
 
@@ -54,11 +99,24 @@
     #define IMPORT_IMPL_WASI_PREVIEW1(ret, name, params, body) \
       IMPORT_IMPL_WASI_PREVIEW1_(ret, name, params, body)
 
+    // Functions with the same layouts in both versions are defined once
+    #define IMPORT_IMPL_WASI_ALL_(ret, name, parameters, body)              \
+      static ret _wasi_##name parameters body                              \
+      ret (*f_wasiX5Funstable_##name) parameters = _wasi_##name;           \
+      ret (*f_wasiX5FsnapshotX5Fpreview1_##name) parameters = _wasi_##name;
+
     #define IMPORT_IMPL_WASI_ALL(ret, name, params, body)   \
-      IMPORT_IMPL_WASI_UNSTABLE_(ret, name, params, body)   \
-      IMPORT_IMPL_WASI_PREVIEW1_(ret, name, params, body)
+      IMPORT_IMPL_WASI_ALL_(ret, name, params, body)
+
+    #define IMPORT_IMPL_WASM2NATIVE_(ret, name, parameters, body)           \
+      static ret _wasm2native_##name parameters body                       \
+      ret (*f_wasm2native_##name) parameters = _wasm2native_##name;
+
+    #define IMPORT_IMPL_WASM2NATIVE(ret, name, params, body) \
+      IMPORT_IMPL_WASM2NATIVE_(ret, name, params, body)
 
-    #define MEMACCESS(addr) ((void*)&e_memory->data[(addr)])
+    #define MEMACCESS(addr) ((void*)&IMPORT_MEMORY()->data[(addr)])
+    #define MEMSIZE()       (IMPORT_MEMORY()->size)
 
     #define Z_fd_prestat_getZ_iii               fdX5FprestatX5Fget
     #define Z_fd_prestat_dir_nameZ_iiii         fdX5FprestatX5FdirX5Fname
@@ -102,253 +160,305 @@
     #define Z_sched_yieldZ_iv                   schedX5Fyield
     #define Z_proc_raiseZ_iv                    procX5Fraise
     #define Z_proc_exitZ_vi                     procX5Fexit
+    #define Z_sock_recvZ_iiiiiii                sockX5Frecv
+    #define Z_sock_sendZ_iiiiii                 sockX5Fsend
+    #define Z_sock_shutdownZ_iii                sockX5Fshutdown
+    #define Z_sock_acceptZ_iiii                 sockX5Faccept
+
+    #define Z_memory_discardZ_vii               memoryX5Fdiscard
+    #define Z_file_mapZ_iijiii                  fileX5Fmap
+    #define Z_file_unmapZ_iii                   fileX5Funmap
 
 #endif
 
+#include "uv.h"
 #include "uvwasi.h"
 
 static uvwasi_t uvwasi;
 
+// uvwasi (the preopens and the fd table) is set up by the first WASI call that needs it,
+// not before _start. Arguments and the environment are served from the host's arrays,
+// and the stateless calls (clocks, random_get, sched_yield, proc_raise) take &uvwasi as is
+static int uvwasi_ready;
+static int wasi_argc;
+static const char** wasi_argv;
+static const char** wasi_envp;
 
-#if WABT_BIG_ENDIAN
-    #define MEM_SET(addr, value, len) memset(MEMACCESS(addr), (value), (len))
-    #define MEM_WRITE8(addr, value)  (*(u8*) MEMACCESS(addr)) = (value)
-    #define MEM_WRITE16(addr, value) (*(u16*)MEMACCESS(addr)) = WASM_RT_BSWAP16(value)
-    #define MEM_WRITE32(addr, value) (*(u32*)MEMACCESS(addr)) = WASM_RT_BSWAP32(value)
-    #define MEM_WRITE64(addr, value) (*(u64*)MEMACCESS(addr)) = WASM_RT_BSWAP64(value)
-
-    #define READ32(x)           WASM_RT_BSWAP32(*(u32*)(x))
-#else
-    #define MEM_SET(addr, value, len) memset(MEMACCESS(addr), (value), (len))
-    #define MEM_WRITE8(addr, value)  (*(u8*) MEMACCESS(addr)) = (value)
-    #define MEM_WRITE16(addr, value) (*(u16*)MEMACCESS(addr)) = (value)
-    #define MEM_WRITE32(addr, value) (*(u32*)MEMACCESS(addr)) = (value)
-    #define MEM_WRITE64(addr, value) (*(u64*)MEMACCESS(addr)) = (value)
-
-    #define READ32(x)           (*(u32*)(x))
-#endif
+// Time spent in uvwasi_init, for WASM2NATIVE_STARTUP_TRACE
+static u64 startup_wasi_time;
 
-// TODO: Add linear memory boundary checks
+static uvwasi_t* wasi_setup(void)
+{
+    u64 begin = uv_hrtime();
 
-typedef u32 wasm_ptr;
+    #define PREOPENS_COUNT  2
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_prestat_getZ_iii, (u32 fd, wasm_ptr buf),
-{
-    uvwasi_prestat_t prestat;
-    uvwasi_errno_t ret = uvwasi_fd_prestat_get(&uvwasi, fd, &prestat);
-    if (ret == UVWASI_ESUCCESS) {
-        MEM_WRITE32(buf+0, prestat.pr_type);
-        MEM_WRITE32(buf+4, prestat.u.dir.pr_name_len);
-    }
-    return ret;
-});
+    uvwasi_preopen_t preopens[PREOPENS_COUNT];
+    preopens[0].mapped_path = "/";
+    preopens[0].real_path = ".";
+    preopens[1].mapped_path = "./";
+    preopens[1].real_path = ".";
 
+    uvwasi_options_t init_options;
+    uvwasi_options_init(&init_options);
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_prestat_dir_nameZ_iiii, (u32 fd, wasm_ptr path, u32 path_len),
-{
-    uvwasi_errno_t ret = uvwasi_fd_prestat_dir_name(&uvwasi, fd, (char*)MEMACCESS(path), path_len);
-    return ret;
-});
+    init_options.preopenc = PREOPENS_COUNT;
+    init_options.preopens = preopens;
 
-IMPORT_IMPL_WASI_ALL(u32, Z_environ_sizes_getZ_iii, (wasm_ptr env_count, wasm_ptr env_buf_size),
-{
-    uvwasi_size_t uvcount;
-    uvwasi_size_t uvbufsize;
-    uvwasi_errno_t ret = uvwasi_environ_sizes_get(&uvwasi, &uvcount, &uvbufsize);
-    if (ret == UVWASI_ESUCCESS) {
-        MEM_WRITE32(env_count,      uvcount);
-        MEM_WRITE32(env_buf_size,   uvbufsize);
-    }
-    return ret;
-});
+    uvwasi_errno_t ret = uvwasi_init(&uvwasi, &init_options);
 
-IMPORT_IMPL_WASI_ALL(u32, Z_environ_getZ_iii, (wasm_ptr env, wasm_ptr buf),
-{
-    uvwasi_size_t uvcount;
-    uvwasi_size_t uvbufsize;
-    uvwasi_errno_t ret;
-    ret = uvwasi_environ_sizes_get(&uvwasi, &uvcount, &uvbufsize);
     if (ret != UVWASI_ESUCCESS) {
-        return ret;
+        printf("uvwasi_init failed");
+        exit(1);
     }
+    uvwasi_ready = 1;
+    startup_wasi_time = uv_hrtime() - begin;
+    return &uvwasi;
+}
 
-    // TODO: check mem
+#define UVWASI (uvwasi_ready ? &uvwasi : wasi_setup())
 
-    char** uvenv = calloc(uvcount, sizeof(char*));
-    if (uvenv == NULL) {
-        return UVWASI_ENOMEM;
+static void wasi_destroy(void)
+{
+    if (uvwasi_ready) {
+        uvwasi_destroy(&uvwasi);
+        uvwasi_ready = 0;
     }
+}
 
-    ret = uvwasi_environ_get(&uvwasi, uvenv, (char*)MEMACCESS(buf));
-    if (ret != UVWASI_ESUCCESS) {
-        free(uvenv);
-        return ret;
-    }
+// Hot calls go to the native Linux backend if it is enabled, see wasi-native.h
+#ifdef WASI_NATIVE
+    #include "wasi-native.h"
+    #define WASI_FAST(name) wasi_native_##name
+#else
+    #define WASI_FAST(name) uvwasi_##name
+#endif
 
-    for (u32 i = 0; i < uvcount; ++i)
-    {
-        uint32_t offset = buf + (uvenv[i] - uvenv[0]);
-        MEM_WRITE32(env+(i*sizeof(wasm_ptr)), offset);
-    }
 
-    free(uvenv);
+// Guest pointers and sizes are 64-bit in modules with a 64-bit memory (memory64).
+// uvwasi takes 32-bit sizes: longer paths are invalid, larger buffers are used up to 4 GiB
+#ifdef WASM_MEMORY64
+    typedef u64 wasm_ptr;
+    typedef u64 wasm_size;
 
-    return ret;
-});
+    #define CHECK_SIZE(len)  if ((len) > UINT32_MAX) return UVWASI_EINVAL
+    #define BUF_SIZE(len)    ((len) > UINT32_MAX ? UINT32_MAX : (uvwasi_size_t)(len))
+#else
+    typedef u32 wasm_ptr;
+    typedef u32 wasm_size;
 
-IMPORT_IMPL_WASI_ALL(u32, Z_args_sizes_getZ_iii, (wasm_ptr argc, wasm_ptr argv_buf_size),
-{
-    uvwasi_size_t uvcount;
-    uvwasi_size_t uvbufsize;
-    uvwasi_errno_t ret = uvwasi_args_sizes_get(&uvwasi, &uvcount, &uvbufsize);
-    if (ret == UVWASI_ESUCCESS) {
-        MEM_WRITE32(argc,            uvcount);
-        MEM_WRITE32(argv_buf_size,   uvbufsize);
-    }
-    return ret;
-});
+    #define CHECK_SIZE(len)
+    #define BUF_SIZE(len)    (len)
+#endif
 
-IMPORT_IMPL_WASI_ALL(u32, Z_args_getZ_iii, (wasm_ptr argv, wasm_ptr buf),
+#include "wasi-layout.h"
+
+// Whether a guest range lies within the linear memory, without overflowing for 64-bit addresses
+static int mem_range_ok(u64 addr, u64 len)
 {
-    uvwasi_size_t uvcount;
-    uvwasi_size_t uvbufsize;
-    uvwasi_errno_t ret;
-    ret = uvwasi_args_sizes_get(&uvwasi, &uvcount, &uvbufsize);
-    if (ret != UVWASI_ESUCCESS) {
-        return ret;
-    }
+    return addr <= MEMSIZE() && len <= MEMSIZE() - addr;
+}
 
-    // TODO: check mem
+// Every guest pointer is checked once, for the whole range it is used for, before the call
+#define CHECK_RANGE(addr, len) if (!mem_range_ok((addr), (len))) return UVWASI_EFAULT
 
-    char** uvarg = calloc(uvcount, sizeof(char*));
-    if (uvarg == NULL) {
-        return UVWASI_ENOMEM;
-    }
+// Stores a value of a WASI type at a checked guest address
+#define MEM_STORE(type, addr, value) wasi_put_##type((u8*)MEMACCESS(addr), (value))
 
-    ret = uvwasi_args_get(&uvwasi, uvarg, (char*)MEMACCESS(buf));
-    if (ret != UVWASI_ESUCCESS) {
-        free(uvarg);
-        return ret;
-    }
+// IOV_MAX on Linux and macOS: readv and writev fail with EINVAL for more buffers anyway
+#define MAX_IOVS 1024
 
-    for (u32 i = 0; i < uvcount; ++i)
-    {
-        uint32_t offset = buf + (uvarg[i] - uvarg[0]);
-        MEM_WRITE32(argv+(i*sizeof(wasm_ptr)), offset);
+// Converts a guest iovec array, checking the array and every buffer
+static uvwasi_errno_t read_iovs(wasm_ptr iovs_offset, wasm_size iovs_len, uvwasi_ciovec_t* iovs)
+{
+    CHECK_RANGE(iovs_offset, iovs_len * WASI_IOVEC_SIZE);
+    const u8* image = (const u8*)MEMACCESS(iovs_offset);
+    for (wasm_size i = 0; i < iovs_len; ++i, image += WASI_IOVEC_SIZE) {
+        wasm_ptr buf = wasi_get_ptr(image);
+        wasm_size buf_len = wasi_get_size(image + WASI_SIZE_BYTES);
+        CHECK_RANGE(buf, buf_len);
+        iovs[i].buf = MEMACCESS(buf);
+        iovs[i].buf_len = BUF_SIZE(buf_len);
     }
+    return UVWASI_ESUCCESS;
+}
 
-    free(uvarg);
-
-    return ret;
-});
+#if defined(_MSC_VER)
+    #define DECLARE_IOVS(iovs, iovs_len) \
+      if (iovs_len > MAX_IOVS) return UVWASI_EINVAL; \
+      uvwasi_ciovec_t iovs[MAX_IOVS]
+#else
+    #define DECLARE_IOVS(iovs, iovs_len) \
+      if (iovs_len > MAX_IOVS) return UVWASI_EINVAL; \
+      uvwasi_ciovec_t iovs[iovs_len ? iovs_len : 1]
+#endif
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_fdstat_getZ_iii, (u32 fd, wasm_ptr stat),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_prestat_getZ_iii, (u32 fd, wasm_ptr buf),
 {
-    uvwasi_fdstat_t uvstat;
-    uvwasi_errno_t ret = uvwasi_fd_fdstat_get(&uvwasi, fd, &uvstat);
+    CHECK_RANGE(buf, WASI_PRESTAT_SIZE);
+    uvwasi_prestat_t prestat;
+    uvwasi_errno_t ret = uvwasi_fd_prestat_get(UVWASI, fd, &prestat);
     if (ret == UVWASI_ESUCCESS) {
-        MEM_SET(stat, 0, 24);
-        MEM_WRITE8 (stat+0,  uvstat.fs_filetype);
-        MEM_WRITE16(stat+2,  uvstat.fs_flags);
-        MEM_WRITE64(stat+8,  uvstat.fs_rights_base);
-        MEM_WRITE64(stat+16, uvstat.fs_rights_inheriting);
+        u8 image[WASI_PRESTAT_SIZE];
+        WASI_ENCODE(WASI_PRESTAT, image, prestat);
+        memcpy(MEMACCESS(buf), image, sizeof(image));
     }
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_fdstat_set_flagsZ_iii, (u32 fd, u32 flags),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_prestat_dir_nameZ_iiii, (u32 fd, wasm_ptr path, wasm_size path_len),
 {
-    uvwasi_errno_t ret = uvwasi_fd_fdstat_set_flags(&uvwasi, fd, flags);
+    CHECK_RANGE(path, path_len);
+    uvwasi_errno_t ret = uvwasi_fd_prestat_dir_name(UVWASI, fd, (char*)MEMACCESS(path), BUF_SIZE(path_len));
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_fdstat_set_rightsZ_iijj, (u32 fd, u64 fs_rights_base, u64 fs_rights_inheriting),
+// Counts the strings of a host vector and their total size with the terminating NULs
+static void strings_sizes(int count, const char** strings, wasm_size* out_count, wasm_size* out_size)
 {
-    uvwasi_errno_t ret = uvwasi_fd_fdstat_set_rights(&uvwasi, fd, fs_rights_base, fs_rights_inheriting);
-    return ret;
+    wasm_size size = 0;
+    int i = 0;
+    for (; strings && (count < 0 ? strings[i] != NULL : i < count); ++i) {
+        size += strlen(strings[i]) + 1;
+    }
+    *out_count = i;
+    *out_size = size;
+}
+
+// Copies the strings of a host vector to the guest buffer at buf and their guest pointers to ptrs
+static uvwasi_errno_t strings_get(int count, const char** strings, wasm_ptr ptrs, wasm_ptr buf)
+{
+    wasm_size n;
+    wasm_size size;
+    strings_sizes(count, strings, &n, &size);
+    CHECK_RANGE(ptrs, n * WASI_SIZE_BYTES);
+    CHECK_RANGE(buf, size);
+
+    u8* image = (u8*)MEMACCESS(ptrs);
+    char* dst = (char*)MEMACCESS(buf);
+    for (wasm_size i = 0; i < n; ++i, image += WASI_SIZE_BYTES) {
+        size_t len = strlen(strings[i]) + 1;
+        memcpy(dst, strings[i], len);
+        wasi_put_size(image, buf);
+        dst += len;
+        buf += len;
+    }
+    return UVWASI_ESUCCESS;
+}
+
+IMPORT_IMPL_WASI_ALL(u32, Z_environ_sizes_getZ_iii, (wasm_ptr env_count, wasm_ptr env_buf_size),
+{
+    CHECK_RANGE(env_count, WASI_SIZE_BYTES);
+    CHECK_RANGE(env_buf_size, WASI_SIZE_BYTES);
+    wasm_size count;
+    wasm_size size;
+    strings_sizes(-1, wasi_envp, &count, &size);
+    MEM_STORE(size, env_count,    count);
+    MEM_STORE(size, env_buf_size, size);
+    return UVWASI_ESUCCESS;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_filestat_set_timesZ_iijj, (u32 fd, u32 flags, wasm_ptr path, u32 path_len, u64 atim, u64 mtim, u32 fst_flags),
+IMPORT_IMPL_WASI_ALL(u32, Z_environ_getZ_iii, (wasm_ptr env, wasm_ptr buf),
 {
-    uvwasi_errno_t ret = uvwasi_path_filestat_set_times(&uvwasi, fd, flags, (char*)MEMACCESS(path), path_len, atim, mtim, fst_flags);
-    return ret;
+    return strings_get(-1, wasi_envp, env, buf);
 });
 
+IMPORT_IMPL_WASI_ALL(u32, Z_args_sizes_getZ_iii, (wasm_ptr argc, wasm_ptr argv_buf_size),
+{
+    CHECK_RANGE(argc, WASI_SIZE_BYTES);
+    CHECK_RANGE(argv_buf_size, WASI_SIZE_BYTES);
+    wasm_size count;
+    wasm_size size;
+    strings_sizes(wasi_argc, wasi_argv, &count, &size);
+    MEM_STORE(size, argc,          count);
+    MEM_STORE(size, argv_buf_size, size);
+    return UVWASI_ESUCCESS;
+});
 
+IMPORT_IMPL_WASI_ALL(u32, Z_args_getZ_iii, (wasm_ptr argv, wasm_ptr buf),
+{
+    return strings_get(wasi_argc, wasi_argv, argv, buf);
+});
 
-IMPORT_IMPL_WASI_UNSTABLE(u32, Z_path_filestat_getZ_iiiiii, (u32 fd, u32 flags, wasm_ptr path, u32 path_len, wasm_ptr stat),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_fdstat_getZ_iii, (u32 fd, wasm_ptr stat),
 {
-    uvwasi_filestat_t uvstat;
-    uvwasi_errno_t ret = uvwasi_path_filestat_get(&uvwasi, fd, flags, (char*)MEMACCESS(path), path_len, &uvstat);
+    CHECK_RANGE(stat, WASI_FDSTAT_SIZE);
+    uvwasi_fdstat_t uvstat;
+    uvwasi_errno_t ret = uvwasi_fd_fdstat_get(UVWASI, fd, &uvstat);
     if (ret == UVWASI_ESUCCESS) {
-        MEM_SET(stat, 0, 56);
-        MEM_WRITE64(stat+0,  uvstat.st_dev);
-        MEM_WRITE64(stat+8,  uvstat.st_ino);
-        MEM_WRITE8 (stat+16, uvstat.st_filetype);
-        MEM_WRITE32(stat+20, uvstat.st_nlink);
-        MEM_WRITE64(stat+24, uvstat.st_size);
-        MEM_WRITE64(stat+32, uvstat.st_atim);
-        MEM_WRITE64(stat+40, uvstat.st_mtim);
-        MEM_WRITE64(stat+48, uvstat.st_ctim);
+        u8 image[WASI_FDSTAT_SIZE];
+        WASI_ENCODE(WASI_FDSTAT, image, uvstat);
+        memcpy(MEMACCESS(stat), image, sizeof(image));
     }
     return ret;
 });
 
-IMPORT_IMPL_WASI_PREVIEW1(u32, Z_path_filestat_getZ_iiiiii, (u32 fd, u32 flags, wasm_ptr path, u32 path_len, wasm_ptr stat),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_fdstat_set_flagsZ_iii, (u32 fd, u32 flags),
 {
-    uvwasi_filestat_t uvstat;
-    uvwasi_errno_t ret = uvwasi_path_filestat_get(&uvwasi, fd, flags, (char*)MEMACCESS(path), path_len, &uvstat);
-    if (ret == UVWASI_ESUCCESS) {
-        MEM_SET(stat, 0, 64);
-        MEM_WRITE64(stat+0,  uvstat.st_dev);
-        MEM_WRITE64(stat+8,  uvstat.st_ino);
-        MEM_WRITE8 (stat+16, uvstat.st_filetype);
-        MEM_WRITE64(stat+24, uvstat.st_nlink);
-        MEM_WRITE64(stat+32, uvstat.st_size);
-        MEM_WRITE64(stat+40, uvstat.st_atim);
-        MEM_WRITE64(stat+48, uvstat.st_mtim);
-        MEM_WRITE64(stat+56, uvstat.st_ctim);
-    }
+    uvwasi_errno_t ret = uvwasi_fd_fdstat_set_flags(UVWASI, fd, flags);
     return ret;
 });
 
-IMPORT_IMPL_WASI_UNSTABLE(u32, Z_fd_filestat_getZ_iii, (u32 fd, wasm_ptr stat),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_fdstat_set_rightsZ_iijj, (u32 fd, u64 fs_rights_base, u64 fs_rights_inheriting),
 {
-    uvwasi_filestat_t uvstat;
-    uvwasi_errno_t ret = uvwasi_fd_filestat_get(&uvwasi, fd, &uvstat);
-    if (ret == UVWASI_ESUCCESS) {
-        MEM_SET(stat, 0, 56);
-        MEM_WRITE64(stat+0,  uvstat.st_dev);
-        MEM_WRITE64(stat+8,  uvstat.st_ino);
-        MEM_WRITE8 (stat+16, uvstat.st_filetype);
-        MEM_WRITE32(stat+20, uvstat.st_nlink);
-        MEM_WRITE64(stat+24, uvstat.st_size);
-        MEM_WRITE64(stat+32, uvstat.st_atim);
-        MEM_WRITE64(stat+40, uvstat.st_mtim);
-        MEM_WRITE64(stat+48, uvstat.st_ctim);
-    }
+    uvwasi_errno_t ret = WASI_FAST(fd_fdstat_set_rights)(UVWASI, fd, fs_rights_base, fs_rights_inheriting);
     return ret;
 });
 
-IMPORT_IMPL_WASI_PREVIEW1(u32, Z_fd_filestat_getZ_iii, (u32 fd, wasm_ptr stat),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_filestat_set_timesZ_iijj, (u32 fd, u32 flags, wasm_ptr path, wasm_size path_len, u64 atim, u64 mtim, u32 fst_flags),
 {
-    uvwasi_filestat_t uvstat;
-    uvwasi_errno_t ret = uvwasi_fd_filestat_get(&uvwasi, fd, &uvstat);
-    if (ret == UVWASI_ESUCCESS) {
-        MEM_SET(stat, 0, 64);
-        MEM_WRITE64(stat+0,  uvstat.st_dev);
-        MEM_WRITE64(stat+8,  uvstat.st_ino);
-        MEM_WRITE8 (stat+16, uvstat.st_filetype);
-        MEM_WRITE64(stat+24, uvstat.st_nlink);
-        MEM_WRITE64(stat+32, uvstat.st_size);
-        MEM_WRITE64(stat+40, uvstat.st_atim);
-        MEM_WRITE64(stat+48, uvstat.st_mtim);
-        MEM_WRITE64(stat+56, uvstat.st_ctim);
-    }
+    CHECK_SIZE(path_len);
+    CHECK_RANGE(path, path_len);
+    uvwasi_errno_t ret = uvwasi_path_filestat_set_times(UVWASI, fd, flags, (char*)MEMACCESS(path), path_len, atim, mtim, fst_flags);
     return ret;
 });
 
+// filestat differs between wasi_unstable and wasi_snapshot_preview1 in the link count
+#define FILESTAT_SHIMS(IMPORT_IMPL_ABI, LAYOUT)                                                     \
+                                                                                                    \
+IMPORT_IMPL_ABI(u32, Z_path_filestat_getZ_iiiiii, (u32 fd, u32 flags, wasm_ptr path, wasm_size path_len, wasm_ptr stat), \
+{                                                                                                   \
+    CHECK_SIZE(path_len);                                                                           \
+    CHECK_RANGE(path, path_len);                                                                    \
+    CHECK_RANGE(stat, LAYOUT##_SIZE);                                                               \
+    uvwasi_filestat_t uvstat;                                                                       \
+    uvwasi_errno_t ret = WASI_FAST(path_filestat_get)(UVWASI, fd, flags, (char*)MEMACCESS(path), path_len, &uvstat); \
+    if (ret == UVWASI_ESUCCESS) {                                                                   \
+        u8 image[LAYOUT##_SIZE];                                                                    \
+        WASI_ENCODE(LAYOUT, image, uvstat);                                                         \
+        memcpy(MEMACCESS(stat), image, sizeof(image));                                              \
+    }                                                                                               \
+    return ret;                                                                                     \
+})                                                                                                  \
+                                                                                                    \
+IMPORT_IMPL_ABI(u32, Z_fd_filestat_getZ_iii, (u32 fd, wasm_ptr stat),                               \
+{                                                                                                   \
+    CHECK_RANGE(stat, LAYOUT##_SIZE);                                                               \
+    uvwasi_filestat_t uvstat;                                                                       \
+    uvwasi_errno_t ret = WASI_FAST(fd_filestat_get)(UVWASI, fd, &uvstat);                          \
+    if (ret == UVWASI_ESUCCESS) {                                                                   \
+        u8 image[LAYOUT##_SIZE];                                                                    \
+        WASI_ENCODE(LAYOUT, image, uvstat);                                                         \
+        memcpy(MEMACCESS(stat), image, sizeof(image));                                              \
+    }                                                                                               \
+    return ret;                                                                                     \
+})
+
+FILESTAT_SHIMS(IMPORT_IMPL_WASI_UNSTABLE, WASI_UNSTABLE_FILESTAT)
+FILESTAT_SHIMS(IMPORT_IMPL_WASI_PREVIEW1, WASI_PREVIEW1_FILESTAT)
+
+static uvwasi_errno_t fd_seek(u32 fd, u64 offset, uvwasi_whence_t whence, wasm_ptr pos)
+{
+    CHECK_RANGE(pos, sizeof(u64));
+    uvwasi_filesize_t uvpos;
+    uvwasi_errno_t ret = WASI_FAST(fd_seek)(UVWASI, fd, offset, whence, &uvpos);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(u64, pos, uvpos);
+    }
+    return ret;
+}
 
+// wasi_unstable numbers the whence values CUR, END, SET
 IMPORT_IMPL_WASI_UNSTABLE(u32, Z_fd_seekZ_iijii, (u32 fd, u64 offset, u32 wasi_whence, wasm_ptr pos),
 {
     uvwasi_whence_t whence = -1;
@@ -357,11 +467,7 @@ IMPORT_IMPL_WASI_UNSTABLE(u32, Z_fd_seekZ_iijii, (u32 fd, u64 offset, u32 wasi_w
     case 1: whence = UVWASI_WHENCE_END; break;
     case 2: whence = UVWASI_WHENCE_SET; break;
     }
-
-    uvwasi_filesize_t uvpos;
-    uvwasi_errno_t ret = uvwasi_fd_seek(&uvwasi, fd, offset, whence, &uvpos);
-    MEM_WRITE64(pos, uvpos);
-    return ret;
+    return fd_seek(fd, offset, whence, pos);
 });
 
 IMPORT_IMPL_WASI_PREVIEW1(u32, Z_fd_seekZ_iijii, (u32 fd, u64 offset, u32 wasi_whence, wasm_ptr pos),
@@ -372,76 +478,74 @@ IMPORT_IMPL_WASI_PREVIEW1(u32, Z_fd_seekZ_iijii, (u32 fd, u64 offset, u32 wasi_w
     case 1: whence = UVWASI_WHENCE_CUR; break;
     case 2: whence = UVWASI_WHENCE_END; break;
     }
-
-    uvwasi_filesize_t uvpos;
-    uvwasi_errno_t ret = uvwasi_fd_seek(&uvwasi, fd, offset, whence, &uvpos);
-    MEM_WRITE64(pos, uvpos);
-    return ret;
+    return fd_seek(fd, offset, whence, pos);
 });
 
-
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_tellZ_iii, (u32 fd, wasm_ptr pos),
 {
+    CHECK_RANGE(pos, sizeof(u64));
     uvwasi_filesize_t uvpos;
-    uvwasi_errno_t ret = uvwasi_fd_tell(&uvwasi, fd, &uvpos);
-    MEM_WRITE64(pos, uvpos);
+    uvwasi_errno_t ret = WASI_FAST(fd_tell)(UVWASI, fd, &uvpos);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(u64, pos, uvpos);
+    }
     return ret;
 });
 
-
-
-
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_filestat_set_sizeZ_iij, (u32 fd, u64 filesize),
 {
-    uvwasi_errno_t ret = uvwasi_fd_filestat_set_size(&uvwasi, fd, filesize);
+    uvwasi_errno_t ret = uvwasi_fd_filestat_set_size(UVWASI, fd, filesize);
     return ret;
 });
 
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_filestat_set_timesZ_iijj, (u32 fd, u64 atim, u64 mtim, u32 fst_flags),
 {
-    uvwasi_errno_t ret = uvwasi_fd_filestat_set_times(&uvwasi, fd, atim, mtim, fst_flags);
+    uvwasi_errno_t ret = uvwasi_fd_filestat_set_times(UVWASI, fd, atim, mtim, fst_flags);
     return ret;
 });
 
 
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_syncZ_ii, (u32 fd),
 {
-    uvwasi_errno_t ret = uvwasi_fd_sync(&uvwasi, fd);
+    uvwasi_errno_t ret = uvwasi_fd_sync(UVWASI, fd);
     return ret;
 });
 
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_datasyncZ_ii, (u32 fd),
 {
-    uvwasi_errno_t ret = uvwasi_fd_datasync(&uvwasi, fd);
+    uvwasi_errno_t ret = uvwasi_fd_datasync(UVWASI, fd);
     return ret;
 });
 
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_renumberZ_ii, (u32 fd_from, u32 fd_to),
 {
-    uvwasi_errno_t ret = uvwasi_fd_renumber(&uvwasi, fd_from, fd_to);
+    uvwasi_errno_t ret = WASI_FAST(fd_renumber)(UVWASI, fd_from, fd_to);
     return ret;
 });
 
 
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_allocateZ_iijj, (u32 fd, u64 offset, u64 len),
 {
-    uvwasi_errno_t ret = uvwasi_fd_allocate(&uvwasi, fd, offset, len);
+    uvwasi_errno_t ret = uvwasi_fd_allocate(UVWASI, fd, offset, len);
     return ret;
 });
 
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_adviseZ_iijji, (u32 fd, u64 offset, u64 len, u32 advice),
 {
-    uvwasi_errno_t ret = uvwasi_fd_advise(&uvwasi, fd, offset, len, advice);
+    uvwasi_errno_t ret = uvwasi_fd_advise(UVWASI, fd, offset, len, advice);
     return ret;
 });
 
 IMPORT_IMPL_WASI_ALL(u32, Z_path_openZ_iiiiiijjii, (u32 dirfd, u32 dirflags,
-                                                    wasm_ptr path, u32 path_len,
+                                                    wasm_ptr path, wasm_size path_len,
                                                     u32 oflags, u64 fs_rights_base, u64 fs_rights_inheriting,
                                                     u32 fs_flags, wasm_ptr fd),
 {
+    CHECK_SIZE(path_len);
+    CHECK_RANGE(path, path_len);
+    CHECK_RANGE(fd, sizeof(u32));
     uvwasi_fd_t uvfd;
-    uvwasi_errno_t ret = uvwasi_path_open(&uvwasi,
+    uvwasi_errno_t ret = WASI_FAST(path_open)(UVWASI,
                                  dirfd,
                                  dirflags,
                                  (char*)MEMACCESS(path),
@@ -451,201 +555,252 @@ IMPORT_IMPL_WASI_ALL(u32, Z_path_openZ_iiiiiijjii, (u32 dirfd, u32 dirflags,
                                  fs_rights_inheriting,
                                  fs_flags,
                                  &uvfd);
-    MEM_WRITE32(fd, uvfd);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(u32, fd, uvfd);
+    }
     return ret;
 });
 
 IMPORT_IMPL_WASI_ALL(u32, Z_fd_closeZ_ii, (u32 fd), {
-    uvwasi_errno_t ret = uvwasi_fd_close(&uvwasi, fd);
+    uvwasi_errno_t ret = WASI_FAST(fd_close)(UVWASI, fd);
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_symlinkZ_iiiiii, (wasm_ptr old_path, u32 old_path_len, u32 fd,
-                                                   wasm_ptr new_path, u32 new_path_len),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_symlinkZ_iiiiii, (wasm_ptr old_path, wasm_size old_path_len, u32 fd,
+                                                   wasm_ptr new_path, wasm_size new_path_len),
 {
-    uvwasi_errno_t ret = uvwasi_path_symlink(&uvwasi, (char*)MEMACCESS(old_path), old_path_len,
+    CHECK_SIZE(old_path_len);
+    CHECK_SIZE(new_path_len);
+    CHECK_RANGE(old_path, old_path_len);
+    CHECK_RANGE(new_path, new_path_len);
+    uvwasi_errno_t ret = WASI_FAST(path_symlink)(UVWASI, (char*)MEMACCESS(old_path), old_path_len,
                                                   fd, (char*)MEMACCESS(new_path), new_path_len);
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_renameZ_iiiiiii, (u32 old_fd, wasm_ptr old_path, u32 old_path_len,
-                                                   u32 new_fd, wasm_ptr new_path, u32 new_path_len),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_renameZ_iiiiiii, (u32 old_fd, wasm_ptr old_path, wasm_size old_path_len,
+                                                   u32 new_fd, wasm_ptr new_path, wasm_size new_path_len),
 {
-    uvwasi_errno_t ret = uvwasi_path_rename(&uvwasi, old_fd, (char*)MEMACCESS(old_path), old_path_len,
+    CHECK_SIZE(old_path_len);
+    CHECK_SIZE(new_path_len);
+    CHECK_RANGE(old_path, old_path_len);
+    CHECK_RANGE(new_path, new_path_len);
+    uvwasi_errno_t ret = WASI_FAST(path_rename)(UVWASI, old_fd, (char*)MEMACCESS(old_path), old_path_len,
                                                      new_fd, (char*)MEMACCESS(new_path), new_path_len);
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_linkZ_iiiiiiii, (u32 old_fd, u32 old_flags, wasm_ptr old_path, u32 old_path_len,
-                                                  u32 new_fd,                wasm_ptr new_path, u32 new_path_len),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_linkZ_iiiiiiii, (u32 old_fd, u32 old_flags, wasm_ptr old_path, wasm_size old_path_len,
+                                                  u32 new_fd,                wasm_ptr new_path, wasm_size new_path_len),
 {
-    uvwasi_errno_t ret = uvwasi_path_link(&uvwasi, old_fd, old_flags, (char*)MEMACCESS(old_path), old_path_len,
+    CHECK_SIZE(old_path_len);
+    CHECK_SIZE(new_path_len);
+    CHECK_RANGE(old_path, old_path_len);
+    CHECK_RANGE(new_path, new_path_len);
+    uvwasi_errno_t ret = uvwasi_path_link(UVWASI, old_fd, old_flags, (char*)MEMACCESS(old_path), old_path_len,
                                                    new_fd,            (char*)MEMACCESS(new_path), new_path_len);
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_unlink_fileZ_iiii, (u32 fd, wasm_ptr path, u32 path_len),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_unlink_fileZ_iiii, (u32 fd, wasm_ptr path, wasm_size path_len),
 {
-    uvwasi_errno_t ret = uvwasi_path_unlink_file(&uvwasi, fd, (char*)MEMACCESS(path), path_len);
+    CHECK_SIZE(path_len);
+    CHECK_RANGE(path, path_len);
+    uvwasi_errno_t ret = WASI_FAST(path_unlink_file)(UVWASI, fd, (char*)MEMACCESS(path), path_len);
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_readlinkZ_iiiiiii, (u32 fd, wasm_ptr path, u32 path_len,
-                                                     wasm_ptr buf, u32 buf_len, wasm_ptr bufused),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_readlinkZ_iiiiiii, (u32 fd, wasm_ptr path, wasm_size path_len,
+                                                     wasm_ptr buf, wasm_size buf_len, wasm_ptr bufused),
 {
+    CHECK_SIZE(path_len);
+    CHECK_RANGE(path, path_len);
+    CHECK_RANGE(buf, buf_len);
+    CHECK_RANGE(bufused, WASI_SIZE_BYTES);
     uvwasi_size_t uvbufused;
-    uvwasi_errno_t ret = uvwasi_path_readlink(&uvwasi, fd, (char*)MEMACCESS(path), path_len, MEMACCESS(buf), buf_len, &uvbufused);
-
-    MEM_WRITE32(bufused, uvbufused);
+    uvwasi_errno_t ret = uvwasi_path_readlink(UVWASI, fd, (char*)MEMACCESS(path), path_len, MEMACCESS(buf), BUF_SIZE(buf_len), &uvbufused);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, bufused, uvbufused);
+    }
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_create_directoryZ_iiii, (u32 fd, wasm_ptr path, u32 path_len),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_create_directoryZ_iiii, (u32 fd, wasm_ptr path, wasm_size path_len),
 {
-    uvwasi_errno_t ret = uvwasi_path_create_directory(&uvwasi, fd, (char*)MEMACCESS(path), path_len);
+    CHECK_SIZE(path_len);
+    CHECK_RANGE(path, path_len);
+    uvwasi_errno_t ret = uvwasi_path_create_directory(UVWASI, fd, (char*)MEMACCESS(path), path_len);
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_path_remove_directoryZ_iiii, (u32 fd, wasm_ptr path, u32 path_len),
+IMPORT_IMPL_WASI_ALL(u32, Z_path_remove_directoryZ_iiii, (u32 fd, wasm_ptr path, wasm_size path_len),
 {
-    uvwasi_errno_t ret = uvwasi_path_remove_directory(&uvwasi, fd, (char*)MEMACCESS(path), path_len);
+    CHECK_SIZE(path_len);
+    CHECK_RANGE(path, path_len);
+    uvwasi_errno_t ret = WASI_FAST(path_remove_directory)(UVWASI, fd, (char*)MEMACCESS(path), path_len);
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_readdirZ_iiiiji, (u32 fd, wasm_ptr buf, u32 buf_len, u64 cookie, wasm_ptr bufused),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_readdirZ_iiiiji, (u32 fd, wasm_ptr buf, wasm_size buf_len, u64 cookie, wasm_ptr bufused),
 {
+    CHECK_RANGE(buf, buf_len);
+    CHECK_RANGE(bufused, WASI_SIZE_BYTES);
     uvwasi_size_t uvbufused;
-    uvwasi_errno_t ret = uvwasi_fd_readdir(&uvwasi, fd, MEMACCESS(buf), buf_len, cookie, &uvbufused);
-    MEM_WRITE32(bufused, uvbufused);
+    uvwasi_errno_t ret = uvwasi_fd_readdir(UVWASI, fd, MEMACCESS(buf), BUF_SIZE(buf_len), cookie, &uvbufused);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, bufused, uvbufused);
+    }
     return ret;
 });
 
-typedef struct wasi_iovec_t
-{
-    uvwasi_size_t buf;
-    uvwasi_size_t buf_len;
-} wasi_iovec_t;
-
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_writeZ_iiiii, (u32 fd, wasm_ptr iovs_offset, u32 iovs_len, wasm_ptr nwritten),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_writeZ_iiiii, (u32 fd, wasm_ptr iovs_offset, wasm_size iovs_len, wasm_ptr nwritten),
 {
-    wasi_iovec_t * wasi_iovs = (wasi_iovec_t *)MEMACCESS(iovs_offset);
-
-#if defined(_MSC_VER)
-    if (iovs_len > 32) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[32];
-#else
-    if (iovs_len > 128) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[iovs_len];
-#endif
-    for (uvwasi_size_t i = 0; i < iovs_len; ++i) {
-        iovs[i].buf = MEMACCESS(READ32(&wasi_iovs[i].buf));
-        iovs[i].buf_len = READ32(&wasi_iovs[i].buf_len);
+    DECLARE_IOVS(iovs, iovs_len);
+    CHECK_RANGE(nwritten, WASI_SIZE_BYTES);
+    uvwasi_errno_t ret = read_iovs(iovs_offset, iovs_len, iovs);
+    if (ret != UVWASI_ESUCCESS) {
+        return ret;
     }
-    
+
     uvwasi_size_t num_written;
-    uvwasi_errno_t ret = uvwasi_fd_write(&uvwasi, fd, iovs, iovs_len, &num_written);
-    MEM_WRITE32(nwritten, num_written);
+    ret = WASI_FAST(fd_write)(UVWASI, fd, iovs, iovs_len, &num_written);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, nwritten, num_written);
+    }
     return ret;
 });
 
-
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_pwriteZ_iiiii, (u32 fd, wasm_ptr iovs_offset, u32 iovs_len, u64 offset, wasm_ptr nwritten),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_pwriteZ_iiiii, (u32 fd, wasm_ptr iovs_offset, wasm_size iovs_len, u64 offset, wasm_ptr nwritten),
 {
-    wasi_iovec_t * wasi_iovs = (wasi_iovec_t *)MEMACCESS(iovs_offset);
-
-#if defined(_MSC_VER)
-    if (iovs_len > 32) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[32];
-#else
-    if (iovs_len > 128) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[iovs_len];
-#endif
-    for (uvwasi_size_t i = 0; i < iovs_len; ++i) {
-        iovs[i].buf = MEMACCESS(READ32(&wasi_iovs[i].buf));
-        iovs[i].buf_len = READ32(&wasi_iovs[i].buf_len);
+    DECLARE_IOVS(iovs, iovs_len);
+    CHECK_RANGE(nwritten, WASI_SIZE_BYTES);
+    uvwasi_errno_t ret = read_iovs(iovs_offset, iovs_len, iovs);
+    if (ret != UVWASI_ESUCCESS) {
+        return ret;
     }
 
     uvwasi_size_t num_written;
-    uvwasi_errno_t ret = uvwasi_fd_pwrite(&uvwasi, fd, iovs, iovs_len, offset, &num_written);
-    MEM_WRITE32(nwritten, num_written);
+    ret = WASI_FAST(fd_pwrite)(UVWASI, fd, iovs, iovs_len, offset, &num_written);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, nwritten, num_written);
+    }
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_readZ_iiiii, (u32 fd, wasm_ptr iovs_offset, u32 iovs_len, wasm_ptr nread),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_readZ_iiiii, (u32 fd, wasm_ptr iovs_offset, wasm_size iovs_len, wasm_ptr nread),
 {
-    wasi_iovec_t * wasi_iovs = (wasi_iovec_t *)MEMACCESS(iovs_offset);
-
-#if defined(_MSC_VER)
-    if (iovs_len > 32) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[32];
-#else
-    if (iovs_len > 128) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[iovs_len];
-#endif
-
-    for (uvwasi_size_t i = 0; i < iovs_len; ++i) {
-        iovs[i].buf = MEMACCESS(READ32(&wasi_iovs[i].buf));
-        iovs[i].buf_len = READ32(&wasi_iovs[i].buf_len);
+    DECLARE_IOVS(iovs, iovs_len);
+    CHECK_RANGE(nread, WASI_SIZE_BYTES);
+    uvwasi_errno_t ret = read_iovs(iovs_offset, iovs_len, iovs);
+    if (ret != UVWASI_ESUCCESS) {
+        return ret;
     }
 
     uvwasi_size_t num_read;
-    uvwasi_errno_t ret = uvwasi_fd_read(&uvwasi, fd, (const uvwasi_iovec_t *)iovs, iovs_len, &num_read);
-    MEM_WRITE32(nread, num_read);
+    ret = WASI_FAST(fd_read)(UVWASI, fd, (const uvwasi_iovec_t *)iovs, iovs_len, &num_read);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, nread, num_read);
+    }
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_fd_preadZ_iiiiji, (u32 fd, wasm_ptr iovs_offset, u32 iovs_len, u64 offset, wasm_ptr nread),
+IMPORT_IMPL_WASI_ALL(u32, Z_fd_preadZ_iiiiji, (u32 fd, wasm_ptr iovs_offset, wasm_size iovs_len, u64 offset, wasm_ptr nread),
 {
-    wasi_iovec_t * wasi_iovs = (wasi_iovec_t *)MEMACCESS(iovs_offset);
-
-#if defined(_MSC_VER)
-    if (iovs_len > 32) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[32];
-#else
-    if (iovs_len > 128) return UVWASI_EINVAL;
-    uvwasi_ciovec_t  iovs[iovs_len];
-#endif
-
-    for (uvwasi_size_t i = 0; i < iovs_len; ++i) {
-        iovs[i].buf = MEMACCESS(READ32(&wasi_iovs[i].buf));
-        iovs[i].buf_len = READ32(&wasi_iovs[i].buf_len);
+    DECLARE_IOVS(iovs, iovs_len);
+    CHECK_RANGE(nread, WASI_SIZE_BYTES);
+    uvwasi_errno_t ret = read_iovs(iovs_offset, iovs_len, iovs);
+    if (ret != UVWASI_ESUCCESS) {
+        return ret;
     }
 
     uvwasi_size_t num_read;
-    uvwasi_errno_t ret = uvwasi_fd_pread(&uvwasi, fd, (const uvwasi_iovec_t *)iovs, iovs_len, offset, &num_read);
-    MEM_WRITE32(nread, num_read);
-    return ret;
-});
-
-// TODO: unstable/snapshot_preview1 compatibility
-IMPORT_IMPL_WASI_ALL(u32, Z_poll_oneoffZ_iiiii, (wasm_ptr in, wasm_ptr out, u32 nsubscriptions, wasm_ptr nevents),
-{
-    uvwasi_size_t uvnevents;
-    uvwasi_errno_t ret = uvwasi_poll_oneoff(&uvwasi, MEMACCESS(in), MEMACCESS(out), nsubscriptions, &uvnevents);
-    MEM_WRITE32(nevents, uvnevents);
+    ret = WASI_FAST(fd_pread)(UVWASI, fd, (const uvwasi_iovec_t *)iovs, iovs_len, offset, &num_read);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, nread, num_read);
+    }
     return ret;
 });
 
+// Subscriptions and events are converted between the guest layouts and uvwasi's native structs,
+// which differ from the guest on 32-bit and big-endian hosts, and from wasi_unstable everywhere
+#define POLL_ONEOFF_SHIM(IMPORT_IMPL_ABI, SUBSCRIPTION_CLOCK, SUBSCRIPTION_SIZE)                    \
+                                                                                                    \
+IMPORT_IMPL_ABI(u32, Z_poll_oneoffZ_iiiii, (wasm_ptr in, wasm_ptr out, wasm_size nsubscriptions, wasm_ptr nevents), \
+{                                                                                                   \
+    CHECK_SIZE(nsubscriptions);                                                                     \
+    CHECK_RANGE(in, nsubscriptions * (u64)SUBSCRIPTION_SIZE);                                       \
+    CHECK_RANGE(out, nsubscriptions * (u64)WASI_EVENT_SIZE);                                        \
+    CHECK_RANGE(nevents, WASI_SIZE_BYTES);                                                          \
+    if (nsubscriptions == 0) {                                                                      \
+        return UVWASI_EINVAL;                                                                       \
+    }                                                                                               \
+                                                                                                    \
+    uvwasi_subscription_t* subscriptions = calloc(nsubscriptions, sizeof(uvwasi_subscription_t));   \
+    uvwasi_event_t* events = calloc(nsubscriptions, sizeof(uvwasi_event_t));                        \
+    if (subscriptions == NULL || events == NULL) {                                                  \
+        free(subscriptions);                                                                        \
+        free(events);                                                                               \
+        return UVWASI_ENOMEM;                                                                       \
+    }                                                                                               \
+                                                                                                    \
+    const u8* image = (const u8*)MEMACCESS(in);                                                     \
+    for (wasm_size i = 0; i < nsubscriptions; ++i, image += SUBSCRIPTION_SIZE) {                    \
+        WASI_DECODE(WASI_SUBSCRIPTION, image, subscriptions[i]);                                    \
+        if (subscriptions[i].type == UVWASI_EVENTTYPE_CLOCK) {                                      \
+            WASI_DECODE(SUBSCRIPTION_CLOCK, image, subscriptions[i]);                               \
+        } else {                                                                                    \
+            WASI_DECODE(WASI_SUBSCRIPTION_FD_READWRITE, image, subscriptions[i]);                   \
+        }                                                                                           \
+    }                                                                                               \
+                                                                                                    \
+    uvwasi_size_t uvnevents;                                                                        \
+    uvwasi_errno_t ret = uvwasi_poll_oneoff(UVWASI, subscriptions, events, nsubscriptions, &uvnevents); \
+    if (ret == UVWASI_ESUCCESS) {                                                                   \
+        u8* event = (u8*)MEMACCESS(out);                                                            \
+        for (uvwasi_size_t i = 0; i < uvnevents; ++i, event += WASI_EVENT_SIZE) {                   \
+            WASI_ENCODE(WASI_EVENT, event, events[i]);                                              \
+        }                                                                                           \
+        MEM_STORE(size, nevents, uvnevents);                                                        \
+    }                                                                                               \
+                                                                                                    \
+    free(subscriptions);                                                                            \
+    free(events);                                                                                   \
+    return ret;                                                                                     \
+})
+
+POLL_ONEOFF_SHIM(IMPORT_IMPL_WASI_UNSTABLE, WASI_UNSTABLE_SUBSCRIPTION_CLOCK, WASI_UNSTABLE_SUBSCRIPTION_SIZE)
+POLL_ONEOFF_SHIM(IMPORT_IMPL_WASI_PREVIEW1, WASI_PREVIEW1_SUBSCRIPTION_CLOCK, WASI_PREVIEW1_SUBSCRIPTION_SIZE)
 
 IMPORT_IMPL_WASI_ALL(u32, Z_clock_res_getZ_iii, (u32 clk_id, wasm_ptr result),
 {
+    CHECK_RANGE(result, sizeof(u64));
     uvwasi_timestamp_t t;
     uvwasi_errno_t ret = uvwasi_clock_res_get(&uvwasi, clk_id, &t);
-    MEM_WRITE64(result, t);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(u64, result, t);
+    }
     return ret;
 });
 
 IMPORT_IMPL_WASI_ALL(u32, Z_clock_time_getZ_iiji, (u32 clk_id, u64 precision, wasm_ptr result),
 {
+    CHECK_RANGE(result, sizeof(u64));
     uvwasi_timestamp_t t;
-    uvwasi_errno_t ret = uvwasi_clock_time_get(&uvwasi, clk_id, precision, &t);
-    MEM_WRITE64(result, t);
+    uvwasi_errno_t ret = WASI_FAST(clock_time_get)(&uvwasi, clk_id, precision, &t);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(u64, result, t);
+    }
     return ret;
 });
 
-IMPORT_IMPL_WASI_ALL(u32, Z_random_getZ_iii, (wasm_ptr buf, u32 buf_len),
+IMPORT_IMPL_WASI_ALL(u32, Z_random_getZ_iii, (wasm_ptr buf, wasm_size buf_len),
 {
-    uvwasi_errno_t ret = uvwasi_random_get(&uvwasi, MEMACCESS(buf), buf_len);
+    CHECK_RANGE(buf, buf_len);
+    uvwasi_errno_t ret = UVWASI_ESUCCESS;
+    // Buffers over 4 GiB are filled in parts
+    for (wasm_size done = 0; done < buf_len && ret == UVWASI_ESUCCESS; done += BUF_SIZE(buf_len - done)) {
+        ret = WASI_FAST(random_get)(&uvwasi, MEMACCESS(buf + done), BUF_SIZE(buf_len - done));
+    }
     return ret;
 });
 
@@ -663,56 +818,1081 @@ IMPORT_IMPL_WASI_ALL(u32, Z_proc_raiseZ_iv, (u32 sig),
 
 IMPORT_IMPL_WASI_ALL(void, Z_proc_exitZ_vi, (u32 code),
 {
-    uvwasi_destroy(&uvwasi);
+    wasi_destroy();
     exit(code);
 });
 
+IMPORT_IMPL_WASI_ALL(u32, Z_sock_recvZ_iiiiiii, (u32 fd, wasm_ptr ri_data, wasm_size ri_data_len, u32 ri_flags,
+                                                 wasm_ptr ro_datalen, wasm_ptr ro_flags),
+{
+    DECLARE_IOVS(iovs, ri_data_len);
+    CHECK_RANGE(ro_datalen, WASI_SIZE_BYTES);
+    CHECK_RANGE(ro_flags, sizeof(u16));
+    uvwasi_errno_t ret = read_iovs(ri_data, ri_data_len, iovs);
+    if (ret != UVWASI_ESUCCESS) {
+        return ret;
+    }
+
+    uvwasi_size_t uvdatalen;
+    uvwasi_roflags_t uvflags;
+    ret = uvwasi_sock_recv(UVWASI, fd, (const uvwasi_iovec_t *)iovs, ri_data_len, ri_flags, &uvdatalen, &uvflags);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, ro_datalen, uvdatalen);
+        MEM_STORE(u16, ro_flags, uvflags);
+    }
+    return ret;
+});
 
-int main(int argc, const char** argv)
+IMPORT_IMPL_WASI_ALL(u32, Z_sock_sendZ_iiiiii, (u32 fd, wasm_ptr si_data, wasm_size si_data_len, u32 si_flags,
+                                                wasm_ptr so_datalen),
 {
-    #define ENV_COUNT       7
-    #define PREOPENS_COUNT  2
+    DECLARE_IOVS(iovs, si_data_len);
+    CHECK_RANGE(so_datalen, WASI_SIZE_BYTES);
+    uvwasi_errno_t ret = read_iovs(si_data, si_data_len, iovs);
+    if (ret != UVWASI_ESUCCESS) {
+        return ret;
+    }
 
-    char* env[ENV_COUNT];
-    env[0] = "TERM=xterm-256color";
-    env[1] = "COLORTERM=truecolor";
-    env[2] = "LANG=en_US.UTF-8";
-    env[3] = "PWD=/";
-    env[4] = "HOME=/";
-    env[5] = "PATH=/";
-    env[6] = NULL;
+    uvwasi_size_t uvdatalen;
+    ret = uvwasi_sock_send(UVWASI, fd, iovs, si_data_len, si_flags, &uvdatalen);
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, so_datalen, uvdatalen);
+    }
+    return ret;
+});
 
-    uvwasi_preopen_t preopens[PREOPENS_COUNT];
-    preopens[0].mapped_path = "/";
-    preopens[0].real_path = ".";
-    preopens[1].mapped_path = "./";
-    preopens[1].real_path = ".";
+IMPORT_IMPL_WASI_ALL(u32, Z_sock_shutdownZ_iii, (u32 fd, u32 how),
+{
+    uvwasi_errno_t ret = uvwasi_sock_shutdown(UVWASI, fd, how);
+    return ret;
+});
 
-    uvwasi_options_t init_options;
-    uvwasi_options_init(&init_options);
+// Only preopened sockets could be accepted on, and uvwasi has none
+IMPORT_IMPL_WASI_PREVIEW1(u32, Z_sock_acceptZ_iiii, (u32 fd, u32 flags, wasm_ptr ro_fd),
+{
+    (void)fd;
+    (void)flags;
+    (void)ro_fd;
+    return UVWASI_ENOSYS;
+});
 
-    init_options.argc = argc;
-    init_options.argv = argv;
-    init_options.envp = (const char **) env;
-    init_options.preopenc = PREOPENS_COUNT;
-    init_options.preopens = preopens;
+/*
+ * wasm2native extensions, imported from the "wasm2native" module
+ */
 
-    uvwasi_errno_t ret = uvwasi_init(&uvwasi, &init_options);
+#include "fd_table.h"
+#include "uv_mapping.h"
+
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static uintptr_t host_page_size(void)
+{
+    static uintptr_t page_size = 0;
+    if (!page_size) {
+        page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    }
+    return page_size;
+}
+#endif
+
+// Zeroes a range of host memory, returning the whole pages inside it to the OS where possible.
+// Files mapped into the range are only replaced with anonymous memory if unmap_files is set
+static void discard_range(u8* start, size_t len, int unmap_files)
+{
+    u8* end = start + len;
+
+#if defined(__linux__)
+    uintptr_t page_size = host_page_size();
+    u8* page_start = (u8*)(((uintptr_t)start + page_size - 1) & ~(page_size - 1));
+    u8* page_end = (u8*)((uintptr_t)end & ~(page_size - 1));
+    if (page_start < page_end) {
+        // Private anonymous pages read back as zero after MADV_DONTNEED, file pages would be read again
+        int released = unmap_files
+            ? mmap(page_start, page_end - page_start, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != MAP_FAILED
+            : madvise(page_start, page_end - page_start, MADV_DONTNEED) == 0;
+        if (released) {
+            memset(start, 0, page_start - start);
+            memset(page_end, 0, end - page_end);
+            return;
+        }
+    }
+#endif
+
+    memset(start, 0, len);
+}
+
+// Allocators call memory_discard for large freed blocks, so a guest doesn't keep its peak RSS.
+// Ranges outside of the memory are ignored. Ranges with files mapped into them use file_unmap
+IMPORT_IMPL_WASM2NATIVE(void, Z_memory_discardZ_vii, (wasm_ptr addr, wasm_size len),
+{
+    if (mem_range_ok(addr, len)) {
+        discard_range((u8*)MEMACCESS(addr), len, 0);
+    }
+});
+
+#define FILE_MAP_ALIGNMENT 65536
+
+// Makes len bytes of a file available at addr, mapping whole host pages of it without a copy.
+// Pages are private: guest writes don't reach the file. The rest is read, as is everything
+// if the memory is not page aligned on this host
+static uvwasi_errno_t file_map(uv_file file, u64 offset, u8* start, size_t len)
+{
+    size_t mapped = 0;
+
+#if defined(__linux__)
+    if ((uintptr_t)start % host_page_size() == 0) {
+        mapped = len & ~(size_t)(host_page_size() - 1);
+        if (mapped && mmap(start, mapped, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_FIXED, file, offset) == MAP_FAILED) {
+            return uvwasi__translate_uv_error(uv_translate_sys_error(errno));
+        }
+    }
+#endif
+
+    while (mapped < len) {
+        uv_fs_t req;
+        uv_buf_t buf = uv_buf_init((char*)start + mapped, BUF_SIZE(len - mapped));
+        int r = uv_fs_read(NULL, &req, file, &buf, 1, offset + mapped, NULL);
+        uv_fs_req_cleanup(&req);
+        if (r < 0) {
+            return uvwasi__translate_uv_error(r);
+        }
+        if (r == 0) {
+            break;
+        }
+        mapped += r;
+    }
+    return UVWASI_ESUCCESS;
+}
 
+// Zero-copy alternative to fd_read for large read-only inputs. The offset and the address
+// must be multiples of the wasm page size. The number of bytes made available is written
+// to the mapped pointer, it is less than len at the end of the file
+IMPORT_IMPL_WASM2NATIVE(u32, Z_file_mapZ_iijiii, (u32 fd, u64 offset, wasm_ptr addr, wasm_size len, wasm_ptr mapped),
+{
+    if (!mem_range_ok(addr, len) || offset % FILE_MAP_ALIGNMENT || addr % FILE_MAP_ALIGNMENT) {
+        return UVWASI_EINVAL;
+    }
+    CHECK_RANGE(mapped, WASI_SIZE_BYTES);
+
+    struct uvwasi_fd_wrap_t* wrap;
+    uvwasi_errno_t ret = uvwasi_fd_table_get(UVWASI->fds, fd, &wrap, UVWASI_RIGHT_FD_READ, 0);
     if (ret != UVWASI_ESUCCESS) {
-        printf("uvwasi_init failed");
+        return ret;
+    }
+
+    uv_fs_t req;
+    int r = uv_fs_fstat(NULL, &req, wrap->fd, NULL);
+    u64 size = req.statbuf.st_size;
+    uv_fs_req_cleanup(&req);
+    if (r < 0) {
+        ret = uvwasi__translate_uv_error(r);
+    } else {
+        // Pages past the end of the file can't be mapped
+        u64 available = size > offset ? size - offset : 0;
+        if (len > available) {
+            len = (wasm_size)available;
+        }
+        ret = file_map(wrap->fd, offset, (u8*)MEMACCESS(addr), len);
+    }
+    uv_mutex_unlock(&wrap->mutex);
+
+    if (ret == UVWASI_ESUCCESS) {
+        MEM_STORE(size, mapped, len);
+    }
+    return ret;
+});
+
+// Releases a range passed to file_map, it reads back as zero
+IMPORT_IMPL_WASM2NATIVE(u32, Z_file_unmapZ_iii, (wasm_ptr addr, wasm_size len),
+{
+    if (!mem_range_ok(addr, len)) {
+        return UVWASI_EINVAL;
+    }
+    discard_range((u8*)MEMACCESS(addr), len, 1);
+#if WASM_MEMORY_MMAP
+    // The anonymous mapping that replaces the file has no placement policy yet
+    wasmMemoryMapped(IMPORT_MEMORY(), (u8*)MEMACCESS(addr), len);
+#endif
+    return UVWASI_ESUCCESS;
+});
+
+
+static const char* default_env[] = {
+    "TERM=xterm-256color",
+    "COLORTERM=truecolor",
+    "LANG=en_US.UTF-8",
+    "PWD=/",
+    "HOME=/",
+    "PATH=/",
+    NULL
+};
+
+#ifndef USE_WASM2C
+
+static const char* memory_stats_path;
+
+// Records linear memory growth at exit, so build.sh can pre-size the memory of the next build
+static void memory_stats_write(void)
+{
+    FILE* f = fopen(memory_stats_path, "w");
+    if (f == NULL) {
+        return;
+    }
+    fprintf(f, "peak_pages %u\n", e_memory->pages);
+    fprintf(f, "grows %u\n", e_memory->growCount);
+    fprintf(f, "reallocs %u\n", e_memory->reallocCount);
+    fclose(f);
+}
+
+#endif
+
+#if !defined(USE_WASM2C) && defined(__linux__)
+
+/*
+ * Native stack exhaustion (Linux)
+ *
+ * A guest that recurses too deep runs off the end of the native stack into the guard
+ * region below it. The SIGSEGV handler runs on an alternate signal stack and turns a
+ * fault just below the stack of the faulting thread into trapCallStackExhausted, so
+ * recursion is bounded by the stack size and calls need no depth counter. Other faults
+ * go to the handler that was installed before, e.g. a library host's crash reporter,
+ * or crash as before. Each thread running the guest needs its own alternate stack: wasi_init
+ * sets one up for its thread, library hosts call wasm2native_thread_init on the others.
+ */
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+
+// Faults up to this far below a thread's stack are overflows, also past a smaller guard region
+#define STACK_GUARD_SIZE (64 * 1024)
+
+static pthread_once_t stack_guard_once = PTHREAD_ONCE_INIT;
+static pthread_key_t stack_guard_key;
+static struct sigaction stack_guard_previous;
+
+// The addresses at which the calling thread's stack overflows fault
+static __thread uintptr_t stack_guard_start;
+static __thread uintptr_t stack_guard_end;
+
+static void stack_guard_handler(int sig, siginfo_t* info, void* context)
+{
+    static const char message[] = "wasm2native: call stack exhausted\n";
+    uintptr_t addr = (uintptr_t)info->si_addr;
+    sigset_t set;
+
+    if (addr < stack_guard_start || addr >= stack_guard_end) {
+        // Not a stack overflow: pass it on to the previous handler. Without one, the previous
+        // disposition is restored and the fault repeats once the handler returns, and crashes
+        if (stack_guard_previous.sa_flags & SA_SIGINFO) {
+            stack_guard_previous.sa_sigaction(sig, info, context);
+        } else if (stack_guard_previous.sa_handler != SIG_DFL &&
+                   stack_guard_previous.sa_handler != SIG_IGN) {
+            stack_guard_previous.sa_handler(sig);
+        } else {
+            sigaction(sig, &stack_guard_previous, NULL);
+        }
+        return;
+    }
+    if (!wasmTrapTarget) {
+        // Nothing to return to: report it like wasmInterrupt, with async-signal-safe calls only
+        ssize_t written = write(STDERR_FILENO, message, sizeof(message) - 1);
+        (void)written;
+        _exit(1);
+    }
+    // The jump out of the handler doesn't restore the signal mask
+    sigemptyset(&set);
+    sigaddset(&set, sig);
+    sigprocmask(SIG_UNBLOCK, &set, NULL);
+    trap(trapCallStackExhausted);
+}
+
+// Runs when a thread with an alternate stack exits
+static void stack_guard_free(void* alt_stack)
+{
+    stack_t ss;
+    memset(&ss, 0, sizeof(ss));
+    ss.ss_flags = SS_DISABLE;
+    sigaltstack(&ss, NULL);
+    free(alt_stack);
+}
+
+static void stack_guard_install(void)
+{
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_sigaction = stack_guard_handler;
+    if (pthread_key_create(&stack_guard_key, stack_guard_free) != 0 ||
+        sigaction(SIGSEGV, &sa, &stack_guard_previous) != 0) {
+        fprintf(stderr, "wasm2native: cannot install the stack overflow handler\n");
+    }
+}
+
+// Finds the range below the calling thread's stack that its overflows fault in
+static int stack_guard_bounds(uintptr_t* start, uintptr_t* end)
+{
+    pthread_attr_t attr;
+    void* stack_addr;
+    size_t stack_size;
+    size_t guard_size = 0;
+    struct rlimit limit;
+    char here;
+
+    // For the main thread glibc reads /proc/self/maps, which takes longer than the rest of
+    // the startup. Its stack grows down from just above here by at most the stack size limit
+    if (getpid() == syscall(SYS_gettid) && getrlimit(RLIMIT_STACK, &limit) == 0 &&
+        limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < (uintptr_t)&here) {
+        *start = (uintptr_t)&here - limit.rlim_cur - STACK_GUARD_SIZE;
+        *end = (uintptr_t)&here;
+        return 0;
+    }
+
+    if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+        return -1;
+    }
+    if (pthread_attr_getstack(&attr, &stack_addr, &stack_size) != 0) {
+        pthread_attr_destroy(&attr);
+        return -1;
+    }
+    pthread_attr_getguardsize(&attr, &guard_size);
+    pthread_attr_destroy(&attr);
+    if (guard_size < STACK_GUARD_SIZE) {
+        guard_size = STACK_GUARD_SIZE;
+    }
+    *start = (uintptr_t)stack_addr - guard_size;
+    *end = (uintptr_t)stack_addr;
+    return 0;
+}
+
+// Gives the calling thread an alternate signal stack and records where its stack ends
+static int stack_guard_init_thread(void)
+{
+    uintptr_t start;
+    uintptr_t end;
+    stack_t ss;
+
+    pthread_once(&stack_guard_once, stack_guard_install);
+    if (pthread_getspecific(stack_guard_key) != NULL) {
+        return 0;
+    }
+    if (stack_guard_bounds(&start, &end) != 0) {
+        return -1;
+    }
+
+    memset(&ss, 0, sizeof(ss));
+    ss.ss_size = SIGSTKSZ;
+    ss.ss_sp = malloc(ss.ss_size);
+    if (ss.ss_sp == NULL || sigaltstack(&ss, NULL) != 0 ||
+        pthread_setspecific(stack_guard_key, ss.ss_sp) != 0) {
+        free(ss.ss_sp);
+        return -1;
+    }
+
+    stack_guard_start = start;
+    stack_guard_end = end;
+    return 0;
+}
+
+#endif
+
+#if !defined(USE_WASM2C) && WASM_MEMORY_MMAP
+
+/*
+ * NUMA placement (Linux)
+ *
+ * WASM2NATIVE_NUMA_MEMORY sets the policy of the linear memory backing store, as space
+ * separated [<module>=]<mode>:<nodes> entries, e.g. "bind:0" or "interleave:0-1 codec=bind:1".
+ * <mode> is bind, interleave or preferred, <nodes> a list of nodes and ranges like "0,2-3".
+ * The entry without a module applies to the main module and to linked modules without one.
+ * WASM2NATIVE_NUMA_CPU=<node> pins the thread that instantiates and runs the guest to the
+ * CPUs of a node, library hosts can pin their threads with wasm2native_numa_pin.
+ */
+#include <sched.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+
+#define NUMA_MAX_NODES 1024
+#define NUMA_MAX_POLICIES 16
+#define NUMA_MAX_MEMORIES 16
+
+typedef struct {
+    const char* module;
+    size_t module_len;
+    int mode;
+    unsigned long nodes[NUMA_MAX_NODES / (8 * sizeof(unsigned long))];
+} numa_policy;
+
+static numa_policy numa_policies[NUMA_MAX_POLICIES];
+static int numa_policy_count;
+static int numa_ready;
+
+// The policy of each memory is chosen when it is first mapped, by the module being instantiated
+static struct {
+    wasmMemory* memory;
+    const numa_policy* policy;
+} numa_memories[NUMA_MAX_MEMORIES];
+static int numa_memory_count;
+
+// Parses a list like "0,2-3" into a bit set, returns the end of it or NULL if invalid
+static const char* numa_parse_list(const char* list, unsigned long* bits, unsigned int max)
+{
+    do {
+        char* end;
+        unsigned long first = strtoul(list, &end, 10);
+        unsigned long last = first;
+        if (end == list) {
+            return NULL;
+        }
+        if (*end == '-') {
+            list = end + 1;
+            last = strtoul(list, &end, 10);
+            if (end == list) {
+                return NULL;
+            }
+        }
+        if (first > last || last >= max) {
+            return NULL;
+        }
+        for (; first <= last; first++) {
+            bits[first / (8 * sizeof(unsigned long))] |= 1ul << (first % (8 * sizeof(unsigned long)));
+        }
+        list = end;
+    } while (*list++ == ',');
+    return list - 1;
+}
+
+static int numa_parse_policy(const char* entry, numa_policy* policy)
+{
+    const char* spec = entry + strcspn(entry, "= ");
+    if (*spec == '=') {
+        policy->module = entry;
+        policy->module_len = spec - entry;
+        spec++;
+    } else {
+        spec = entry;
+    }
+
+    static const struct { const char* name; int mode; } modes[] = {
+        { "bind:", MPOL_BIND },
+        { "interleave:", MPOL_INTERLEAVE },
+        { "preferred:", MPOL_PREFERRED },
+    };
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        size_t len = strlen(modes[i].name);
+        if (strncmp(spec, modes[i].name, len) == 0) {
+            const char* end = numa_parse_list(spec + len, policy->nodes, NUMA_MAX_NODES);
+            policy->mode = modes[i].mode;
+            return end != NULL && (*end == ' ' || *end == '\0');
+        }
+    }
+    return 0;
+}
+
+static int numa_pin(int node)
+{
+    char path[64];
+    char cpus[4096];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        return -1;
+    }
+    int found = fgets(cpus, sizeof(cpus), f) != NULL;
+    fclose(f);
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (!found || numa_parse_list(cpus, (unsigned long*)&set, CPU_SETSIZE) == NULL) {
+        return -1;
+    }
+    return sched_setaffinity(0, sizeof(set), &set);
+}
+
+static void numa_setup(void)
+{
+    if (numa_ready) {
+        return;
+    }
+    numa_ready = 1;
+
+    const char* entries = getenv("WASM2NATIVE_NUMA_MEMORY");
+    while (entries && *entries) {
+        if (*entries == ' ') {
+            entries++;
+            continue;
+        }
+        if (numa_policy_count == NUMA_MAX_POLICIES ||
+            !numa_parse_policy(entries, &numa_policies[numa_policy_count++])) {
+            fprintf(stderr, "wasm2native: invalid WASM2NATIVE_NUMA_MEMORY entry: %.*s\n",
+                    (int)strcspn(entries, " "), entries);
+            exit(1);
+        }
+        entries += strcspn(entries, " ");
+    }
+
+    const char* node = getenv("WASM2NATIVE_NUMA_CPU");
+    if (node && numa_pin(atoi(node)) != 0) {
+        fprintf(stderr, "wasm2native: cannot run on NUMA node %s\n", node);
         exit(1);
     }
+}
 
-    init();
+static const numa_policy* numa_memory_policy(wasmMemory* memory)
+{
+    const numa_policy* policy = NULL;
+    for (int i = 0; i < numa_memory_count; i++) {
+        if (numa_memories[i].memory == memory) {
+            return numa_memories[i].policy;
+        }
+    }
+    for (int i = 0; i < numa_policy_count; i++) {
+        const numa_policy* p = &numa_policies[i];
+        if (p->module == NULL) {
+            if (policy == NULL) {
+                policy = p;
+            }
+        } else if (init_module && strlen(init_module) == p->module_len &&
+                   strncmp(init_module, p->module, p->module_len) == 0) {
+            policy = p;
+            break;
+        }
+    }
+    if (numa_memory_count < NUMA_MAX_MEMORIES) {
+        numa_memories[numa_memory_count].memory = memory;
+        numa_memories[numa_memory_count].policy = policy;
+        numa_memory_count++;
+    }
+    return policy;
+}
+
+// Applies the policy to a newly mapped range of the backing store, moving pages that were
+// already touched. The memory works without it, so a failure is reported once and ignored
+void wasmMemoryMapped(wasmMemory* memory, U8* start, size_t length)
+{
+    static int reported;
+    numa_setup();
+    const numa_policy* policy = numa_memory_policy(memory);
+    if (policy == NULL || length == 0) {
+        return;
+    }
+    uintptr_t page_size = host_page_size();
+    U8* page_start = (U8*)((uintptr_t)start & ~(page_size - 1));
+    if (syscall(SYS_mbind, page_start, length + (start - page_start),
+                policy->mode, policy->nodes, NUMA_MAX_NODES + 1, MPOL_MF_MOVE) != 0 && !reported) {
+        reported = 1;
+        fprintf(stderr, "wasm2native: cannot place linear memory: %s\n", strerror(errno));
+    }
+}
+
+#endif
+
+#if !defined(USE_WASM2C) && WASM_INTERRUPTS
+
+/*
+ * Epoch interruption (WASM_INTERRUPTS)
+ *
+ * With WASM2NATIVE_CPU_LIMIT=<ms>, a timer thread publishes the CPU time used
+ * by the process, in milliseconds, as the epoch, and the guest is interrupted
+ * once it has used that much. In fork-server mode the limit applies to each run.
+ * Library hosts can instead bump wasmEpoch and move wasmEpochDeadline themselves.
+ */
+volatile U64 wasmEpoch;
+U64 wasmEpochDeadline = UINT64_MAX;
+int (*wasm2native_interrupt_handler)(void);
+
+void wasmInterrupt(void)
+{
+    if (wasm2native_interrupt_handler && wasm2native_interrupt_handler()) {
+        return;
+    }
+    if (!wasmTrapTarget) {
+        fprintf(stderr, "wasm2native: interrupted\n");
+    }
+    trap(trapInterrupted);
+}
+
+static uv_thread_t epoch_thread;
+
+static void epoch_timer(void* arg)
+{
+    unsigned int tick = *(unsigned int*)arg;
+    for (;;) {
+        uv_rusage_t usage;
+        uv_sleep(tick);
+        if (uv_getrusage(&usage) == 0) {
+            wasmEpoch = (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000ull +
+                        (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000;
+        }
+    }
+}
+
+static void epoch_init(void)
+{
+    static unsigned int tick;
+    const char* limit = getenv("WASM2NATIVE_CPU_LIMIT");
+    if (limit == NULL) {
+        return;
+    }
+    wasmEpoch = 0;
+    wasmEpochDeadline = strtoull(limit, NULL, 10);
+    tick = wasmEpochDeadline < 100 ? 1 : 10;
+    if (uv_thread_create(&epoch_thread, epoch_timer, &tick) != 0) {
+        fprintf(stderr, "wasm2native: cannot start the epoch timer\n");
+        exit(1);
+    }
+}
+
+#endif
+
+static void wasi_init(int argc, const char** argv, const char** envp)
+{
+#ifdef WASI_NATIVE
+    wasi_native_reset();
+#endif
+#if !defined(USE_WASM2C) && defined(__linux__)
+    stack_guard_init_thread();
+#endif
+#if !defined(USE_WASM2C) && WASM_MEMORY_MMAP
+    numa_setup();
+#endif
+#ifndef USE_WASM2C
+    memory_stats_path = getenv("WASM2NATIVE_MEMORY_STATS");
+    if (memory_stats_path) {
+        atexit(memory_stats_write);
+    }
+#endif
+#if !defined(USE_WASM2C) && WASM_INTERRUPTS
+    epoch_init();
+#endif
+
+    // uvwasi itself is set up on first use, see wasi_setup
+    wasi_argc = argc;
+    wasi_argv = argv;
+    wasi_envp = envp;
+}
+
+#ifndef WASM2NATIVE_LIBRARY
+
+/*
+ * Startup trace
+ *
+ * WASM2NATIVE_STARTUP_TRACE=<launch time> reports on stderr at exit where the time
+ * between the launch and the first guest instruction went. The launch time is taken
+ * by the launcher right before fork/exec, in nanoseconds of CLOCK_MONOTONIC (the clock
+ * of uv_hrtime), see bench/startup.c. With 0 the exec phase is left out.
+ */
+enum { STARTUP_LAUNCH, STARTUP_MAIN, STARTUP_INIT, STARTUP_START, STARTUP_MARKS };
+
+static u64 startup_marks[STARTUP_MARKS];
+static int startup_tracing;
 
+#define STARTUP_MARK(mark) if (startup_tracing) startup_marks[mark] = uv_hrtime()
+
+static void startup_report(void)
+{
+    u64 end = uv_hrtime();
+    const u64* t = startup_marks;
+    fprintf(stderr, "wasm2native startup: exec %.1f host %.1f init %.1f start %.1f run %.1f wasi %.1f us\n",
+            (t[STARTUP_MAIN] - t[STARTUP_LAUNCH]) / 1e3,    // fork/exec, dynamic loading, libc
+            (t[STARTUP_INIT] - t[STARTUP_MAIN]) / 1e3,      // host setup before init()
+            (t[STARTUP_START] - t[STARTUP_INIT]) / 1e3,     // init(): memory, data segments, tables
+            (t[STARTUP_START] - t[STARTUP_LAUNCH]) / 1e3,   // launch to the first guest instruction
+            (end - t[STARTUP_START]) / 1e3,                 // the guest, up to exit
+            startup_wasi_time / 1e3);                       // uvwasi_init, wherever it ran
+}
+
+static void startup_trace_init(void)
+{
+    const char* launch = getenv("WASM2NATIVE_STARTUP_TRACE");
+    if (launch == NULL) {
+        return;
+    }
+    startup_tracing = 1;
+    startup_marks[STARTUP_MAIN] = uv_hrtime();
+    startup_marks[STARTUP_LAUNCH] = strtoull(launch, NULL, 10);
+    if (startup_marks[STARTUP_LAUNCH] == 0 || startup_marks[STARTUP_LAUNCH] > startup_marks[STARTUP_MAIN]) {
+        startup_marks[STARTUP_LAUNCH] = startup_marks[STARTUP_MAIN];
+    }
+    atexit(startup_report);
+}
+
+static void run_start(void)
+{
 #ifdef USE_WASM2C
     Z__startZ_vv();
 #else
     (*e_X5Fstart)();
+    if (wasmPendingException.tag != NULL) {
+        fprintf(stderr, "wasm2native: %s\n", trapDescription(trapUncaughtException));
+        exit(1);
+    }
 #endif
+}
+
+#endif
+
+#if !defined(_WIN32) && !defined(WASM2NATIVE_LIBRARY)
+
+/*
+ * Fork-server mode
+ *
+ * WASM2NATIVE_SERVER=<socket path> initializes the module once and serves
+ * requests on a Unix socket. Each request forks a child that inherits the
+ * initialized linear memory copy-on-write, rebinds stdio and argv/env and
+ * runs the entry point. WASM2NATIVE_CONNECT=<socket path> turns the same
+ * executable into a client that forwards its stdio and arguments and exits
+ * with the status of the run.
+ *
+ * A request is a header followed by argc argument and envc environment
+ * strings, each NUL-terminated, with stdin/stdout/stderr passed along
+ * with the header as SCM_RIGHTS. The reply is the exit status as int32.
+ */
+
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#define SERVER_MAX_REQUEST_SIZE (1 << 20)
+
+typedef struct {
+    uint32_t argc;
+    uint32_t envc;
+    uint32_t size;
+} server_request_header;
+
+static int server_socket_address(const char* path, struct sockaddr_un* addr)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr->sun_path)) {
+        fprintf(stderr, "socket path too long: %s\n", path);
+        return -1;
+    }
+    strcpy(addr->sun_path, path);
+    return 0;
+}
 
-    uvwasi_destroy(&uvwasi);
+static int write_full(int fd, const void* buf, size_t len)
+{
+    const char* p = buf;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
 
+static int read_full(int fd, void* buf, size_t len)
+{
+    char* p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        len -= n;
+    }
     return 0;
 }
+
+// Splits count NUL-terminated strings off the blob into a NULL-terminated vector
+static const char** server_split_strings(char** blob, const char* end, uint32_t count)
+{
+    const char** vec = calloc((size_t)count + 1, sizeof(char*));
+    if (vec == NULL) return NULL;
+    for (uint32_t i = 0; i < count; i++) {
+        char* nul = memchr(*blob, '\0', end - *blob);
+        if (nul == NULL) {
+            free(vec);
+            return NULL;
+        }
+        vec[i] = *blob;
+        *blob = nul + 1;
+    }
+    return vec;
+}
+
+// Runs in a child of the server: receives one request, runs it and reports the status
+static void server_handle(int conn)
+{
+    server_request_header header;
+    int fds[3];
+    char control[CMSG_SPACE(sizeof(fds))];
+
+    struct iovec iov = { &header, sizeof(header) };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    if (recvmsg(conn, &msg, MSG_WAITALL) != sizeof(header)) {
+        exit(1);
+    }
+
+    // Every string takes at least its NUL byte, so the counts can't exceed the size
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg == NULL || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+        cmsg->cmsg_len != CMSG_LEN(sizeof(fds)) || header.size > SERVER_MAX_REQUEST_SIZE ||
+        (uint64_t)header.argc + header.envc > header.size) {
+        exit(1);
+    }
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+    char* blob = malloc(header.size + 1);
+    if (blob == NULL || read_full(conn, blob, header.size) != 0) {
+        exit(1);
+    }
+    char* cursor = blob;
+    const char** argv = server_split_strings(&cursor, blob + header.size, header.argc);
+    const char** envp = server_split_strings(&cursor, blob + header.size, header.envc);
+    if (argv == NULL || envp == NULL) {
+        exit(1);
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        exit(1);
+    }
+    if (pid == 0) {
+        for (int i = 0; i < 3; i++) {
+            dup2(fds[i], i);
+            close(fds[i]);
+        }
+        close(conn);
+
+        wasi_init(header.argc, argv, envp);
+        run_start();
+        wasi_destroy();
+        exit(0);
+    }
+
+    for (int i = 0; i < 3; i++) {
+        close(fds[i]);
+    }
+
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) exit(1);
+    }
+
+    int32_t code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+    write_full(conn, &code, sizeof(code));
+    exit(0);
+}
+
+static int server_run(const char* path)
+{
+    struct sockaddr_un addr;
+    if (server_socket_address(path, &addr) != 0) {
+        return 1;
+    }
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    unlink(path);
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(sock, SOMAXCONN) != 0) {
+        perror(path);
+        return 1;
+    }
+
+    // Request handlers are reaped automatically
+    signal(SIGCHLD, SIG_IGN);
+
+    for (;;) {
+        int conn = accept(sock, NULL, NULL);
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            perror("accept");
+            return 1;
+        }
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            signal(SIGCHLD, SIG_DFL);
+            close(sock);
+            server_handle(conn);
+        }
+        if (pid < 0) {
+            perror("fork");
+        }
+        close(conn);
+    }
+}
+
+static int client_run(const char* path, int argc, const char** argv)
+{
+    struct sockaddr_un addr;
+    if (server_socket_address(path, &addr) != 0) {
+        return 1;
+    }
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0 || connect(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        perror(path);
+        return 1;
+    }
+
+    server_request_header header = { argc, 0, 0 };
+    for (int i = 0; i < argc; i++) {
+        header.size += strlen(argv[i]) + 1;
+    }
+    for (; default_env[header.envc]; header.envc++) {
+        header.size += strlen(default_env[header.envc]) + 1;
+    }
+
+    char* blob = malloc(header.size);
+    if (blob == NULL) {
+        return 1;
+    }
+    char* cursor = blob;
+    for (int i = 0; i < argc; i++) {
+        size_t len = strlen(argv[i]) + 1;
+        memcpy(cursor, argv[i], len);
+        cursor += len;
+    }
+    for (uint32_t i = 0; i < header.envc; i++) {
+        size_t len = strlen(default_env[i]) + 1;
+        memcpy(cursor, default_env[i], len);
+        cursor += len;
+    }
+
+    int fds[3] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+    char control[CMSG_SPACE(sizeof(fds))];
+    memset(control, 0, sizeof(control));
+
+    struct iovec iov = { &header, sizeof(header) };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    int32_t code;
+    if (sendmsg(sock, &msg, 0) != sizeof(header) ||
+        write_full(sock, blob, header.size) != 0 ||
+        read_full(sock, &code, sizeof(code)) != 0) {
+        fprintf(stderr, "%s: request failed\n", path);
+        return 1;
+    }
+
+    free(blob);
+    close(sock);
+    return code;
+}
+
+#endif
+
+#ifdef WASM2NATIVE_LIBRARY
+
+#ifdef USE_WASM2C
+    #error "Library mode requires the w2c2 translator"
+#endif
+
+#include "wasm2native.h"
+#include "wasm/exports.h"
+
+int wasm2native_init(int argc, const char** argv)
+{
+    wasi_init(argc, argv, default_env);
+
+    init_linked_modules();
+
+    Trap trap;
+    if (!wasmInstantiate(&trap)) {
+        fprintf(stderr, "wasm2native: trap during initialization: %s\n", trapDescription(trap));
+        return 1;
+    }
+    return 0;
+}
+
+void wasm2native_destroy(void)
+{
+    wasi_destroy();
+}
+
+int wasm2native_thread_init(void)
+{
+#ifdef __linux__
+    return stack_guard_init_thread();
+#else
+    return -1;
+#endif
+}
+
+int wasm2native_numa_pin(int node)
+{
+#if WASM_MEMORY_MMAP
+    return numa_pin(node);
+#else
+    (void)node;
+    return -1;
+#endif
+}
+
+#if !WASM_INTERRUPTS
+// Never called without WASM_INTERRUPTS, but hosts that set it link against any build
+int (*wasm2native_interrupt_handler)(void);
+#endif
+
+#else
+
+int main(int argc, const char** argv)
+{
+#if !defined(_WIN32)
+    const char* server_path = getenv("WASM2NATIVE_SERVER");
+    if (server_path) {
+        init_linked_modules();
+        init();
+        return server_run(server_path);
+    }
+
+    const char* connect_path = getenv("WASM2NATIVE_CONNECT");
+    if (connect_path) {
+        return client_run(connect_path, argc, argv);
+    }
+#endif
+
+    startup_trace_init();
+
+    wasi_init(argc, argv, default_env);
+
+    STARTUP_MARK(STARTUP_INIT);
+    init_linked_modules();
+    init();
+
+    STARTUP_MARK(STARTUP_START);
+    run_start();
+
+    wasi_destroy();
+
+    return 0;
+}
+
+#endif
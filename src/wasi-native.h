@@ -0,0 +1,791 @@
+/*
+ * Native Linux backend for the hot WASI calls (WASI_NATIVE)
+ *
+ * Drop-in replacements for the uvwasi functions of the same name, which
+ * lock the fd table and the fd, allocate a uv_buf_t array and go through
+ * a uv_fs_t request on every call. Here the host fd and the rights of a
+ * WASI fd are kept in a compact table, filled from uvwasi's fd table on
+ * first use, and the syscall is made directly. Rights are checked the
+ * same way, so the sandbox is unchanged; everything else stays on uvwasi.
+ *
+ * The table is not locked: wasm modules translated by w2c2 are single
+ * threaded. Calls that close, renumber or restrict an fd go through the
+ * wrappers below, which drop its entry.
+ *
+ * path_open and path_filestat_get use a directory cache: the directory
+ * part of a relative guest path is opened once with openat2 and
+ * RESOLVE_BENEATH and kept in a bounded table keyed by the WASI dirfd
+ * and the guest directory path, so the kernel doesn't walk it again.
+ * Paths the cache doesn't handle (absolute, with "..", leaving the
+ * directory through a symlink, ...) go to uvwasi. Renames, removals and
+ * symlinks made by the guest drop the affected entries; changes made by
+ * other processes are not seen.
+ *
+ * clock_time_get reads the realtime and monotonic clocks with
+ * clock_gettime, which the vDSO serves without entering the kernel.
+ * random_get is served from a ChaCha20 keystream seeded with getrandom:
+ * every refill rekeys the generator from its own output (fast key
+ * erasure, as in arc4random), and it is reseeded from getrandom after
+ * each WASI_NATIVE_RANDOM_RESEED bytes and by wasi_native_reset, which
+ * the fork server calls in every child.
+ */
+
+#ifndef WASI_NATIVE_H
+#define WASI_NATIVE_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/openat2.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+#include <sys/random.h>
+#include <sys/uio.h>
+#include <time.h>
+
+#include "uvwasi.h"
+#include "fd_table.h"
+#include "uv_mapping.h"
+#include "wasi_rights.h"
+
+#define WASI_NATIVE_FDS     1024
+#define WASI_NATIVE_IOVS    1024
+#define WASI_NATIVE_DIRS    256
+
+#define WASI_NATIVE_RANDOM_BLOCKS   16
+#define WASI_NATIVE_RANDOM_RESEED   (1 << 20)
+
+typedef struct {
+    uv_file fd;
+    int cached;
+    uvwasi_rights_t rights_base;
+} wasi_native_fd_t;
+
+static wasi_native_fd_t wasi_native_fds[WASI_NATIVE_FDS];
+
+typedef struct {
+    // Guest directory path relative to dirfd, NULL for a free slot
+    char* path;
+    uvwasi_size_t path_len;
+    uvwasi_fd_t dirfd;
+    // O_PATH host fd of the directory
+    int fd;
+} wasi_native_dir_t;
+
+static wasi_native_dir_t wasi_native_dirs[WASI_NATIVE_DIRS];
+static int wasi_native_no_openat2;
+
+typedef struct {
+    uint32_t key[8];
+    // Unused keystream, taken from the end
+    uint8_t buf[WASI_NATIVE_RANDOM_BLOCKS * 64];
+    size_t avail;
+    // Bytes left until the next reseed, 0 before the first one
+    size_t until_reseed;
+} wasi_native_random_t;
+
+static wasi_native_random_t wasi_native_random;
+
+static inline void wasi_native_dir_drop(wasi_native_dir_t* dir)
+{
+    if (dir->path) {
+        close(dir->fd);
+        free(dir->path);
+        dir->path = NULL;
+    }
+}
+
+static inline void wasi_native_reset(void)
+{
+    memset(wasi_native_fds, 0, sizeof(wasi_native_fds));
+    for (int i = 0; i < WASI_NATIVE_DIRS; i++) {
+        wasi_native_dir_drop(&wasi_native_dirs[i]);
+    }
+    explicit_bzero(&wasi_native_random, sizeof(wasi_native_random));
+}
+
+static inline void wasi_native_forget(uvwasi_fd_t id)
+{
+    if (id < WASI_NATIVE_FDS) {
+        wasi_native_fds[id].cached = 0;
+    }
+    for (int i = 0; i < WASI_NATIVE_DIRS; i++) {
+        if (wasi_native_dirs[i].path && wasi_native_dirs[i].dirfd == id) {
+            wasi_native_dir_drop(&wasi_native_dirs[i]);
+        }
+    }
+}
+
+static inline uvwasi_errno_t wasi_native_errno(void)
+{
+    return uvwasi__translate_uv_error(uv_translate_sys_error(errno));
+}
+
+static inline uvwasi_errno_t wasi_native_get(uvwasi_t* uvwasi, uvwasi_fd_t id, uvwasi_rights_t rights, uv_file* fd)
+{
+    struct uvwasi_fd_wrap_t* wrap;
+    uvwasi_errno_t err;
+
+    if (id >= WASI_NATIVE_FDS) {
+        err = uvwasi_fd_table_get(uvwasi->fds, id, &wrap, rights, 0);
+        if (err == UVWASI_ESUCCESS) {
+            *fd = wrap->fd;
+            uv_mutex_unlock(&wrap->mutex);
+        }
+        return err;
+    }
+
+    wasi_native_fd_t* entry = &wasi_native_fds[id];
+    if (!entry->cached) {
+        err = uvwasi_fd_table_get(uvwasi->fds, id, &wrap, 0, 0);
+        if (err != UVWASI_ESUCCESS) {
+            return err;
+        }
+        entry->fd = wrap->fd;
+        entry->rights_base = wrap->rights_base;
+        entry->cached = 1;
+        uv_mutex_unlock(&wrap->mutex);
+    }
+
+    if ((~entry->rights_base & rights) != 0) {
+        return UVWASI_ENOTCAPABLE;
+    }
+    *fd = entry->fd;
+    return UVWASI_ESUCCESS;
+}
+
+static inline uvwasi_errno_t wasi_native_iovs(const uvwasi_ciovec_t* iovs, uvwasi_size_t iovs_len, struct iovec* host_iovs)
+{
+    if (iovs_len > WASI_NATIVE_IOVS) {
+        return UVWASI_EINVAL;
+    }
+    for (uvwasi_size_t i = 0; i < iovs_len; ++i) {
+        host_iovs[i].iov_base = (void*)iovs[i].buf;
+        host_iovs[i].iov_len = iovs[i].buf_len;
+    }
+    return UVWASI_ESUCCESS;
+}
+
+// Reads or writes with readv/writev, or preadv/pwritev if offset is not -1
+static inline uvwasi_errno_t wasi_native_rw(uvwasi_t* uvwasi, uvwasi_fd_t id, uvwasi_rights_t rights, int write,
+                                            const uvwasi_ciovec_t* iovs, uvwasi_size_t iovs_len, int64_t offset,
+                                            uvwasi_size_t* nbytes)
+{
+    struct iovec host_iovs[WASI_NATIVE_IOVS];
+    uv_file fd;
+    ssize_t r;
+
+    uvwasi_errno_t err = wasi_native_get(uvwasi, id, rights, &fd);
+    if (err != UVWASI_ESUCCESS) {
+        return err;
+    }
+    err = wasi_native_iovs(iovs, iovs_len, host_iovs);
+    if (err != UVWASI_ESUCCESS) {
+        return err;
+    }
+
+    do {
+        if (offset < 0) {
+            r = write ? writev(fd, host_iovs, iovs_len) : readv(fd, host_iovs, iovs_len);
+        } else {
+            r = write ? pwritev(fd, host_iovs, iovs_len, offset) : preadv(fd, host_iovs, iovs_len, offset);
+        }
+    } while (r < 0 && errno == EINTR);
+
+    if (r < 0) {
+        return wasi_native_errno();
+    }
+    *nbytes = (uvwasi_size_t) r;
+    return UVWASI_ESUCCESS;
+}
+
+static inline uvwasi_errno_t wasi_native_fd_read(uvwasi_t* uvwasi, uvwasi_fd_t fd, const uvwasi_iovec_t* iovs,
+                                                 uvwasi_size_t iovs_len, uvwasi_size_t* nread)
+{
+    return wasi_native_rw(uvwasi, fd, UVWASI_RIGHT_FD_READ, 0,
+                          (const uvwasi_ciovec_t*)iovs, iovs_len, -1, nread);
+}
+
+static inline uvwasi_errno_t wasi_native_fd_pread(uvwasi_t* uvwasi, uvwasi_fd_t fd, const uvwasi_iovec_t* iovs,
+                                                  uvwasi_size_t iovs_len, uvwasi_filesize_t offset, uvwasi_size_t* nread)
+{
+    if ((int64_t) offset < 0) {
+        return UVWASI_EINVAL;
+    }
+    return wasi_native_rw(uvwasi, fd, UVWASI_RIGHT_FD_READ | UVWASI_RIGHT_FD_SEEK, 0,
+                          (const uvwasi_ciovec_t*)iovs, iovs_len, offset, nread);
+}
+
+static inline uvwasi_errno_t wasi_native_fd_write(uvwasi_t* uvwasi, uvwasi_fd_t fd, const uvwasi_ciovec_t* iovs,
+                                                  uvwasi_size_t iovs_len, uvwasi_size_t* nwritten)
+{
+    return wasi_native_rw(uvwasi, fd, UVWASI_RIGHT_FD_WRITE, 1, iovs, iovs_len, -1, nwritten);
+}
+
+static inline uvwasi_errno_t wasi_native_fd_pwrite(uvwasi_t* uvwasi, uvwasi_fd_t fd, const uvwasi_ciovec_t* iovs,
+                                                   uvwasi_size_t iovs_len, uvwasi_filesize_t offset, uvwasi_size_t* nwritten)
+{
+    if ((int64_t) offset < 0) {
+        return UVWASI_EINVAL;
+    }
+    return wasi_native_rw(uvwasi, fd, UVWASI_RIGHT_FD_WRITE | UVWASI_RIGHT_FD_SEEK, 1,
+                          iovs, iovs_len, offset, nwritten);
+}
+
+static inline uvwasi_errno_t wasi_native_lseek(uvwasi_t* uvwasi, uvwasi_fd_t id, uvwasi_rights_t rights,
+                                               uvwasi_filedelta_t offset, uvwasi_whence_t whence,
+                                               uvwasi_filesize_t* newoffset)
+{
+    int real_whence;
+    uv_file fd;
+
+    uvwasi_errno_t err = wasi_native_get(uvwasi, id, rights, &fd);
+    if (err != UVWASI_ESUCCESS) {
+        return err;
+    }
+
+    switch (whence) {
+    case UVWASI_WHENCE_SET: real_whence = SEEK_SET; break;
+    case UVWASI_WHENCE_CUR: real_whence = SEEK_CUR; break;
+    case UVWASI_WHENCE_END: real_whence = SEEK_END; break;
+    default: return UVWASI_EINVAL;
+    }
+
+    off_t r = lseek(fd, offset, real_whence);
+    if (r == (off_t) -1) {
+        return wasi_native_errno();
+    }
+    *newoffset = r;
+    return UVWASI_ESUCCESS;
+}
+
+static inline uvwasi_errno_t wasi_native_fd_seek(uvwasi_t* uvwasi, uvwasi_fd_t fd, uvwasi_filedelta_t offset,
+                                                 uvwasi_whence_t whence, uvwasi_filesize_t* newoffset)
+{
+    return wasi_native_lseek(uvwasi, fd, UVWASI_RIGHT_FD_SEEK, offset, whence, newoffset);
+}
+
+static inline uvwasi_errno_t wasi_native_fd_tell(uvwasi_t* uvwasi, uvwasi_fd_t fd, uvwasi_filesize_t* offset)
+{
+    return wasi_native_lseek(uvwasi, fd, UVWASI_RIGHT_FD_TELL, 0, UVWASI_WHENCE_CUR, offset);
+}
+
+static inline void wasi_native_filestat(const struct statx* stx, uvwasi_filestat_t* buf);
+
+static inline uvwasi_errno_t wasi_native_fd_filestat_get(uvwasi_t* uvwasi, uvwasi_fd_t id, uvwasi_filestat_t* buf)
+{
+    struct statx stx;
+    uv_file fd;
+
+    uvwasi_errno_t err = wasi_native_get(uvwasi, id, UVWASI_RIGHT_FD_FILESTAT_GET, &fd);
+    if (err != UVWASI_ESUCCESS) {
+        return err;
+    }
+    if (statx(fd, "", AT_EMPTY_PATH, STATX_BASIC_STATS, &stx) != 0) {
+        return wasi_native_errno();
+    }
+    wasi_native_filestat(&stx, buf);
+    return UVWASI_ESUCCESS;
+}
+
+// Same conversion as uvwasi, through libuv's stat structure
+static inline void wasi_native_filestat(const struct statx* stx, uvwasi_filestat_t* buf)
+{
+    uv_stat_t st;
+    memset(&st, 0, sizeof(st));
+    st.st_dev = makedev(stx->stx_dev_major, stx->stx_dev_minor);
+    st.st_mode = stx->stx_mode;
+    st.st_nlink = stx->stx_nlink;
+    st.st_ino = stx->stx_ino;
+    st.st_size = stx->stx_size;
+    st.st_atim.tv_sec = stx->stx_atime.tv_sec;
+    st.st_atim.tv_nsec = stx->stx_atime.tv_nsec;
+    st.st_mtim.tv_sec = stx->stx_mtime.tv_sec;
+    st.st_mtim.tv_nsec = stx->stx_mtime.tv_nsec;
+    st.st_ctim.tv_sec = stx->stx_ctime.tv_sec;
+    st.st_ctim.tv_nsec = stx->stx_ctime.tv_nsec;
+    uvwasi__stat_to_filestat(&st, buf);
+}
+
+static inline uvwasi_errno_t wasi_native_clock_time_get(uvwasi_t* uvwasi, uvwasi_clockid_t clock_id,
+                                                        uvwasi_timestamp_t precision, uvwasi_timestamp_t* time)
+{
+    struct timespec ts;
+    clockid_t clock;
+
+    switch (clock_id) {
+    case UVWASI_CLOCK_REALTIME:
+        clock = CLOCK_REALTIME;
+        break;
+    case UVWASI_CLOCK_MONOTONIC:
+        clock = CLOCK_MONOTONIC;
+        break;
+    default:
+        return uvwasi_clock_time_get(uvwasi, clock_id, precision, time);
+    }
+    if (clock_gettime(clock, &ts) != 0) {
+        return wasi_native_errno();
+    }
+    *time = (uvwasi_timestamp_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+    return UVWASI_ESUCCESS;
+}
+
+#define WASI_NATIVE_ROTL(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+#define WASI_NATIVE_QR(a, b, c, d)                                      \
+    a += b; d ^= a; d = WASI_NATIVE_ROTL(d, 16);                        \
+    c += d; b ^= c; b = WASI_NATIVE_ROTL(b, 12);                        \
+    a += b; d ^= a; d = WASI_NATIVE_ROTL(d, 8);                         \
+    c += d; b ^= c; b = WASI_NATIVE_ROTL(b, 7)
+
+static inline void wasi_native_chacha20(const uint32_t key[8], uint32_t counter, uint8_t out[64])
+{
+    uint32_t in[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        counter, 0, 0, 0
+    };
+    uint32_t x[16];
+    int i;
+
+    memcpy(x, in, sizeof(x));
+    for (i = 0; i < 10; i++) {
+        WASI_NATIVE_QR(x[0], x[4], x[8],  x[12]);
+        WASI_NATIVE_QR(x[1], x[5], x[9],  x[13]);
+        WASI_NATIVE_QR(x[2], x[6], x[10], x[14]);
+        WASI_NATIVE_QR(x[3], x[7], x[11], x[15]);
+        WASI_NATIVE_QR(x[0], x[5], x[10], x[15]);
+        WASI_NATIVE_QR(x[1], x[6], x[11], x[12]);
+        WASI_NATIVE_QR(x[2], x[7], x[8],  x[13]);
+        WASI_NATIVE_QR(x[3], x[4], x[9],  x[14]);
+    }
+    for (i = 0; i < 16; i++) {
+        x[i] += in[i];
+    }
+    memcpy(out, x, 64);
+}
+
+static inline uvwasi_errno_t wasi_native_random_refill(void)
+{
+    wasi_native_random_t* rng = &wasi_native_random;
+
+    if (rng->until_reseed == 0) {
+        uint8_t* seed = (uint8_t*) rng->key;
+        size_t n = 0;
+        while (n < sizeof(rng->key)) {
+            ssize_t r = getrandom(seed + n, sizeof(rng->key) - n, 0);
+            if (r < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return wasi_native_errno();
+            }
+            n += r;
+        }
+        rng->until_reseed = WASI_NATIVE_RANDOM_RESEED;
+    }
+
+    for (uint32_t block = 0; block < WASI_NATIVE_RANDOM_BLOCKS; block++) {
+        wasi_native_chacha20(rng->key, block, rng->buf + block * 64);
+    }
+    // The first 32 bytes become the next key and are never handed out
+    memcpy(rng->key, rng->buf, sizeof(rng->key));
+    explicit_bzero(rng->buf, sizeof(rng->key));
+    rng->avail = sizeof(rng->buf) - sizeof(rng->key);
+    return UVWASI_ESUCCESS;
+}
+
+static inline uvwasi_errno_t wasi_native_random_get(uvwasi_t* uvwasi, void* buf, uvwasi_size_t buf_len)
+{
+    wasi_native_random_t* rng = &wasi_native_random;
+    uint8_t* out = buf;
+
+    (void) uvwasi;
+    while (buf_len > 0) {
+        if (rng->avail == 0 || rng->until_reseed == 0) {
+            uvwasi_errno_t err = wasi_native_random_refill();
+            if (err != UVWASI_ESUCCESS) {
+                return err;
+            }
+        }
+        size_t n = buf_len < rng->avail ? buf_len : rng->avail;
+        if (n > rng->until_reseed) {
+            n = rng->until_reseed;
+        }
+        uint8_t* src = rng->buf + sizeof(rng->buf) - rng->avail;
+        memcpy(out, src, n);
+        explicit_bzero(src, n);
+        rng->avail -= n;
+        rng->until_reseed -= n;
+        out += n;
+        buf_len -= n;
+    }
+    return UVWASI_ESUCCESS;
+}
+
+static inline uvwasi_errno_t wasi_native_fd_close(uvwasi_t* uvwasi, uvwasi_fd_t fd)
+{
+    wasi_native_forget(fd);
+    return uvwasi_fd_close(uvwasi, fd);
+}
+
+static inline uvwasi_errno_t wasi_native_fd_renumber(uvwasi_t* uvwasi, uvwasi_fd_t from, uvwasi_fd_t to)
+{
+    wasi_native_forget(from);
+    wasi_native_forget(to);
+    return uvwasi_fd_renumber(uvwasi, from, to);
+}
+
+static inline uvwasi_errno_t wasi_native_fd_fdstat_set_rights(uvwasi_t* uvwasi, uvwasi_fd_t fd,
+                                                              uvwasi_rights_t fs_rights_base,
+                                                              uvwasi_rights_t fs_rights_inheriting)
+{
+    wasi_native_forget(fd);
+    return uvwasi_fd_fdstat_set_rights(uvwasi, fd, fs_rights_base, fs_rights_inheriting);
+}
+
+typedef struct {
+    // Directory, '/', last component
+    char path[PATH_MAX];
+    uvwasi_size_t len;
+    // Length of the directory part, 0 if there is none
+    uvwasi_size_t dir_len;
+    const char* base;
+} wasi_native_path_t;
+
+// Normalizes a relative guest path, dropping "." and empty components.
+// Returns 0 for paths left to uvwasi: absolute, with "..", a trailing slash or too long
+static inline int wasi_native_path_split(const char* path, uvwasi_size_t path_len, wasi_native_path_t* out)
+{
+    uvwasi_size_t i = 0, n = 0, last = 0;
+
+    if (path_len == 0 || path[0] == '/' || path[path_len - 1] == '/') {
+        return 0;
+    }
+    while (i < path_len) {
+        uvwasi_size_t start = i;
+        while (i < path_len && path[i] != '/') {
+            if (path[i] == '\0') {
+                return 0;
+            }
+            i++;
+        }
+        uvwasi_size_t len = i - start;
+        i++;
+        if (len == 0 || (len == 1 && path[start] == '.')) {
+            continue;
+        }
+        if (len == 2 && path[start] == '.' && path[start + 1] == '.') {
+            return 0;
+        }
+        if (n + len + 2 > PATH_MAX) {
+            return 0;
+        }
+        if (n > 0) {
+            out->path[n++] = '/';
+        }
+        last = n;
+        memcpy(out->path + n, path + start, len);
+        n += len;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    out->path[n] = '\0';
+    out->len = n;
+    out->dir_len = last ? last - 1 : 0;
+    out->base = out->path + last;
+    return 1;
+}
+
+// Errors that uvwasi would report as well; anything else is retried through uvwasi
+static inline int wasi_native_path_error(int err)
+{
+    return err == ENOENT || err == ENOTDIR || err == EACCES || err == EEXIST || err == EISDIR ||
+           err == ELOOP;
+}
+
+static inline int wasi_native_openat2(int dir, const char* path, int flags, int mode)
+{
+    struct open_how how;
+    memset(&how, 0, sizeof(how));
+    how.flags = flags | O_CLOEXEC;
+    how.mode = (flags & O_CREAT) ? mode : 0;
+    how.resolve = RESOLVE_BENEATH | RESOLVE_NO_MAGICLINKS;
+
+    int fd = syscall(SYS_openat2, dir, path, &how, sizeof(how));
+    if (fd < 0 && (errno == ENOSYS || errno == EPERM)) {
+        // Kernels before 5.6, or a seccomp filter
+        wasi_native_no_openat2 = 1;
+    }
+    return fd;
+}
+
+// Returns the host fd of the directory part of the path, opening and caching it on a miss, or -1
+static inline int wasi_native_dir_get(uvwasi_fd_t dirfd, uv_file dir_host_fd, wasi_native_path_t* p)
+{
+    if (p->dir_len == 0) {
+        return dir_host_fd;
+    }
+
+    uint32_t hash = 2166136261u ^ dirfd;
+    for (uvwasi_size_t i = 0; i < p->dir_len; i++) {
+        hash = (hash ^ (uint8_t) p->path[i]) * 16777619u;
+    }
+    wasi_native_dir_t* dir = &wasi_native_dirs[hash % WASI_NATIVE_DIRS];
+    if (dir->path && dir->dirfd == dirfd && dir->path_len == p->dir_len &&
+        memcmp(dir->path, p->path, p->dir_len) == 0) {
+        return dir->fd;
+    }
+
+    p->path[p->dir_len] = '\0';
+    int fd = wasi_native_openat2(dir_host_fd, p->path, O_PATH | O_DIRECTORY, 0);
+    p->path[p->dir_len] = '/';
+    if (fd < 0) {
+        return -1;
+    }
+
+    char* path = malloc(p->dir_len);
+    if (path == NULL) {
+        close(fd);
+        errno = ENOMEM;
+        return -1;
+    }
+    memcpy(path, p->path, p->dir_len);
+    wasi_native_dir_drop(dir);
+    dir->path = path;
+    dir->path_len = p->dir_len;
+    dir->dirfd = dirfd;
+    dir->fd = fd;
+    return fd;
+}
+
+// Drops the cached directories a change to the path may affect:
+// those below it, and all of those cached for other dirfds
+static inline void wasi_native_path_changed(uvwasi_fd_t dirfd, const char* path, uvwasi_size_t path_len)
+{
+    wasi_native_path_t p;
+    int split = wasi_native_path_split(path, path_len, &p);
+
+    for (int i = 0; i < WASI_NATIVE_DIRS; i++) {
+        wasi_native_dir_t* dir = &wasi_native_dirs[i];
+        if (dir->path == NULL) {
+            continue;
+        }
+        if (!split || dir->dirfd != dirfd ||
+            (dir->path_len >= p.len && memcmp(dir->path, p.path, p.len) == 0 &&
+             (dir->path_len == p.len || dir->path[p.len] == '/'))) {
+            wasi_native_dir_drop(dir);
+        }
+    }
+}
+
+static inline uvwasi_errno_t wasi_native_path_filestat_get(uvwasi_t* uvwasi, uvwasi_fd_t fd,
+                                                           uvwasi_lookupflags_t flags, const char* path,
+                                                           uvwasi_size_t path_len, uvwasi_filestat_t* buf)
+{
+    wasi_native_path_t p;
+    struct statx stx;
+    uv_file dir_host_fd;
+
+    if (!wasi_native_no_openat2 && wasi_native_path_split(path, path_len, &p) &&
+        wasi_native_get(uvwasi, fd, UVWASI_RIGHT_PATH_FILESTAT_GET, &dir_host_fd) == UVWASI_ESUCCESS) {
+        int dir = wasi_native_dir_get(fd, dir_host_fd, &p);
+        if (dir >= 0 && statx(dir, p.base, AT_SYMLINK_NOFOLLOW, STATX_BASIC_STATS, &stx) == 0) {
+            // Symlinks to follow are resolved by uvwasi
+            if (!S_ISLNK(stx.stx_mode) || !(flags & UVWASI_LOOKUP_SYMLINK_FOLLOW)) {
+                wasi_native_filestat(&stx, buf);
+                return UVWASI_ESUCCESS;
+            }
+        } else if (wasi_native_path_error(errno)) {
+            return wasi_native_errno();
+        }
+    }
+
+    return uvwasi_path_filestat_get(uvwasi, fd, flags, path, path_len, buf);
+}
+
+static inline uvwasi_errno_t wasi_native_path_open(uvwasi_t* uvwasi, uvwasi_fd_t dirfd,
+                                                   uvwasi_lookupflags_t dirflags, const char* path,
+                                                   uvwasi_size_t path_len, uvwasi_oflags_t o_flags,
+                                                   uvwasi_rights_t fs_rights_base,
+                                                   uvwasi_rights_t fs_rights_inheriting,
+                                                   uvwasi_fdflags_t fs_flags, uvwasi_fd_t* fd)
+{
+    struct uvwasi_fd_wrap_t* dirfd_wrap;
+    struct uvwasi_fd_wrap_t* wrap;
+    wasi_native_path_t p;
+    uvwasi_rights_t max_base;
+    uvwasi_rights_t max_inheriting;
+    uvwasi_filetype_t filetype;
+    uvwasi_errno_t err;
+    struct statx stx;
+    uv_stat_t st;
+
+    if (wasi_native_no_openat2 || !wasi_native_path_split(path, path_len, &p)) {
+        goto fallback;
+    }
+
+    // Flags and rights as computed by uvwasi_path_open
+    int read = 0 != (fs_rights_base & (UVWASI_RIGHT_FD_READ | UVWASI_RIGHT_FD_READDIR));
+    int write = 0 != (fs_rights_base & (UVWASI_RIGHT_FD_DATASYNC | UVWASI_RIGHT_FD_WRITE |
+                                        UVWASI_RIGHT_FD_ALLOCATE | UVWASI_RIGHT_FD_FILESTAT_SET_SIZE));
+    int flags = write ? read ? O_RDWR : O_WRONLY : O_RDONLY;
+    uvwasi_rights_t needed_base = UVWASI_RIGHT_PATH_OPEN;
+    uvwasi_rights_t needed_inheriting = fs_rights_base | fs_rights_inheriting;
+
+    // Without SYMLINK_FOLLOW, a symlink as the last component fails with ELOOP
+    if ((dirflags & UVWASI_LOOKUP_SYMLINK_FOLLOW) == 0)
+        flags |= O_NOFOLLOW;
+    if ((o_flags & UVWASI_O_CREAT) != 0) {
+        flags |= O_CREAT;
+        needed_base |= UVWASI_RIGHT_PATH_CREATE_FILE;
+    }
+    if ((o_flags & UVWASI_O_DIRECTORY) != 0)
+        flags |= O_DIRECTORY;
+    if ((o_flags & UVWASI_O_EXCL) != 0)
+        flags |= O_EXCL;
+    if ((o_flags & UVWASI_O_TRUNC) != 0) {
+        flags |= O_TRUNC;
+        needed_base |= UVWASI_RIGHT_PATH_FILESTAT_SET_SIZE;
+    }
+    if ((fs_flags & UVWASI_FDFLAG_APPEND) != 0)
+        flags |= O_APPEND;
+    if ((fs_flags & UVWASI_FDFLAG_DSYNC) != 0) {
+        flags |= O_DSYNC;
+        needed_inheriting |= UVWASI_RIGHT_FD_DATASYNC;
+    }
+    if ((fs_flags & UVWASI_FDFLAG_NONBLOCK) != 0)
+        flags |= O_NONBLOCK;
+    if ((fs_flags & UVWASI_FDFLAG_RSYNC) != 0) {
+        flags |= O_RSYNC;
+        needed_inheriting |= UVWASI_RIGHT_FD_SYNC;
+    }
+    if ((fs_flags & UVWASI_FDFLAG_SYNC) != 0) {
+        flags |= O_SYNC;
+        needed_inheriting |= UVWASI_RIGHT_FD_SYNC;
+    }
+    if (write && (flags & (O_APPEND | O_TRUNC)) == 0)
+        needed_inheriting |= UVWASI_RIGHT_FD_SEEK;
+
+    err = uvwasi_fd_table_get(uvwasi->fds, dirfd, &dirfd_wrap, needed_base, needed_inheriting);
+    if (err != UVWASI_ESUCCESS) {
+        return err;
+    }
+
+    int file = -1;
+    int dir = wasi_native_dir_get(dirfd, dirfd_wrap->fd, &p);
+    if (dir >= 0) {
+        file = wasi_native_openat2(dir, p.base, flags, 0666);
+    }
+    if (file < 0) {
+        uv_mutex_unlock(&dirfd_wrap->mutex);
+        if (wasi_native_path_error(errno)) {
+            return wasi_native_errno();
+        }
+        goto fallback;
+    }
+
+    // The host path uvwasi would have resolved, for path_* calls relative to the new fd
+    size_t real_path_len = strlen(dirfd_wrap->real_path);
+    char* real_path = malloc(real_path_len + 1 + p.len + 1);
+    if (real_path == NULL) {
+        uv_mutex_unlock(&dirfd_wrap->mutex);
+        close(file);
+        return UVWASI_ENOMEM;
+    }
+    memcpy(real_path, dirfd_wrap->real_path, real_path_len);
+    real_path[real_path_len] = '/';
+    memcpy(real_path + real_path_len + 1, p.path, p.len + 1);
+    uv_mutex_unlock(&dirfd_wrap->mutex);
+
+    if (statx(file, "", AT_EMPTY_PATH, STATX_TYPE, &stx) != 0) {
+        err = wasi_native_errno();
+        goto close_file;
+    }
+    memset(&st, 0, sizeof(st));
+    st.st_mode = stx.stx_mode;
+    filetype = uvwasi__stat_to_filetype(&st);
+
+    if ((o_flags & UVWASI_O_DIRECTORY) != 0 && filetype != UVWASI_FILETYPE_DIRECTORY) {
+        err = UVWASI_ENOTDIR;
+        goto close_file;
+    }
+
+    err = uvwasi__get_rights(file, flags, filetype, &max_base, &max_inheriting);
+    if (err != UVWASI_ESUCCESS) {
+        goto close_file;
+    }
+
+    err = uvwasi_fd_table_insert(uvwasi, uvwasi->fds, file, real_path, real_path, filetype,
+                                 fs_rights_base & max_base, fs_rights_inheriting & max_inheriting,
+                                 0, &wrap);
+    if (err != UVWASI_ESUCCESS) {
+        goto close_file;
+    }
+
+    *fd = wrap->id;
+    uv_mutex_unlock(&wrap->mutex);
+    free(real_path);
+    return UVWASI_ESUCCESS;
+
+close_file:
+    close(file);
+    free(real_path);
+    return err;
+
+fallback:
+    return uvwasi_path_open(uvwasi, dirfd, dirflags, path, path_len, o_flags,
+                            fs_rights_base, fs_rights_inheriting, fs_flags, fd);
+}
+
+static inline uvwasi_errno_t wasi_native_path_unlink_file(uvwasi_t* uvwasi, uvwasi_fd_t fd,
+                                                          const char* path, uvwasi_size_t path_len)
+{
+    uvwasi_errno_t err = uvwasi_path_unlink_file(uvwasi, fd, path, path_len);
+    if (err == UVWASI_ESUCCESS) {
+        wasi_native_path_changed(fd, path, path_len);
+    }
+    return err;
+}
+
+static inline uvwasi_errno_t wasi_native_path_remove_directory(uvwasi_t* uvwasi, uvwasi_fd_t fd,
+                                                               const char* path, uvwasi_size_t path_len)
+{
+    uvwasi_errno_t err = uvwasi_path_remove_directory(uvwasi, fd, path, path_len);
+    if (err == UVWASI_ESUCCESS) {
+        wasi_native_path_changed(fd, path, path_len);
+    }
+    return err;
+}
+
+static inline uvwasi_errno_t wasi_native_path_rename(uvwasi_t* uvwasi, uvwasi_fd_t old_fd,
+                                                     const char* old_path, uvwasi_size_t old_path_len,
+                                                     uvwasi_fd_t new_fd,
+                                                     const char* new_path, uvwasi_size_t new_path_len)
+{
+    uvwasi_errno_t err = uvwasi_path_rename(uvwasi, old_fd, old_path, old_path_len,
+                                            new_fd, new_path, new_path_len);
+    if (err == UVWASI_ESUCCESS) {
+        wasi_native_path_changed(old_fd, old_path, old_path_len);
+        wasi_native_path_changed(new_fd, new_path, new_path_len);
+    }
+    return err;
+}
+
+static inline uvwasi_errno_t wasi_native_path_symlink(uvwasi_t* uvwasi,
+                                                      const char* old_path, uvwasi_size_t old_path_len,
+                                                      uvwasi_fd_t fd,
+                                                      const char* new_path, uvwasi_size_t new_path_len)
+{
+    uvwasi_errno_t err = uvwasi_path_symlink(uvwasi, old_path, old_path_len, fd, new_path, new_path_len);
+    if (err == UVWASI_ESUCCESS) {
+        wasi_native_path_changed(fd, new_path, new_path_len);
+    }
+    return err;
+}
+
+#endif /* WASI_NATIVE_H */
@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_getattr_np */
+#endif
+
 #include "wasm-rt-impl.h"
 
 #include <assert.h>
@@ -30,6 +34,10 @@
 #include <unistd.h>
 #endif
 
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+#include <pthread.h>
+#endif
+
 #define PAGE_SIZE 65536
 
 typedef struct FuncType {
@@ -39,7 +47,9 @@ typedef struct FuncType {
   uint32_t result_count;
 } FuncType;
 
+#if !WASM_RT_STACK_EXHAUSTION_HANDLER
 uint32_t wasm_rt_call_stack_depth;
+#endif
 uint32_t g_saved_call_stack_depth;
 
 #if WASM_RT_MEMCHECK_SIGNAL_HANDLER
@@ -52,7 +62,9 @@ uint32_t g_func_type_count;
 
 void wasm_rt_trap(wasm_rt_trap_t code) {
   assert(code != WASM_RT_TRAP_NONE);
+#if !WASM_RT_STACK_EXHAUSTION_HANDLER
   wasm_rt_call_stack_depth = g_saved_call_stack_depth;
+#endif
   WASM_RT_LONGJMP(g_jmp_buf, code);
 }
 
@@ -103,8 +115,91 @@ uint32_t wasm_rt_register_func_type(uint32_t param_count,
 }
 
 #if WASM_RT_MEMCHECK_SIGNAL_HANDLER_POSIX
+static void signal_trap(int sig, wasm_rt_trap_t code) {
+  /* The signal stays blocked while the handler runs, and the jump out of it
+   * doesn't restore the mask (wasm_rt_impl_try() doesn't save it), so
+   * unblock it here or the next fault would kill the process. */
+  sigset_t set;
+  sigemptyset(&set);
+  sigaddset(&set, sig);
+  sigprocmask(SIG_UNBLOCK, &set, NULL);
+  wasm_rt_trap(code);
+}
+
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+/* Faults up to this far below the lowest address of a thread's stack are
+ * stack overflows: the guard region, or a frame that skipped past it. */
+#define STACK_GUARD_SIZE (64 * 1024)
+
+/* The calling thread's alternate signal stack and the address range in which
+ * its stack overflows fault. */
+static __thread void* g_alt_stack;
+static __thread uintptr_t g_stack_guard_start;
+static __thread uintptr_t g_stack_guard_end;
+
+void wasm_rt_init_thread(void) {
+  if (g_alt_stack != NULL) {
+    return;
+  }
+
+  /* The handler can't run on the stack that has just overflowed. */
+  stack_t ss;
+  ss.ss_size = SIGSTKSZ;
+  ss.ss_sp = malloc(ss.ss_size);
+  ss.ss_flags = 0;
+  if (ss.ss_sp == NULL || sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  g_alt_stack = ss.ss_sp;
+
+  size_t guard_size = 0;
+#if defined(__APPLE__)
+  pthread_t self = pthread_self();
+  uintptr_t stack_start = (uintptr_t)pthread_get_stackaddr_np(self) -
+                          pthread_get_stacksize_np(self);
+#else
+  pthread_attr_t attr;
+  void* stack_addr;
+  size_t stack_size;
+  if (pthread_getattr_np(pthread_self(), &attr) != 0 ||
+      pthread_attr_getstack(&attr, &stack_addr, &stack_size) != 0) {
+    perror("pthread_getattr_np failed");
+    abort();
+  }
+  pthread_attr_getguardsize(&attr, &guard_size);
+  pthread_attr_destroy(&attr);
+  uintptr_t stack_start = (uintptr_t)stack_addr;
+#endif
+  if (guard_size < STACK_GUARD_SIZE) {
+    guard_size = STACK_GUARD_SIZE;
+  }
+  g_stack_guard_start = stack_start - guard_size;
+  g_stack_guard_end = stack_start;
+}
+
+void wasm_rt_free_thread(void) {
+  if (g_alt_stack == NULL) {
+    return;
+  }
+  stack_t ss;
+  ss.ss_sp = NULL;
+  ss.ss_size = SIGSTKSZ;
+  ss.ss_flags = SS_DISABLE;
+  sigaltstack(&ss, NULL);
+  free(g_alt_stack);
+  g_alt_stack = NULL;
+}
+#endif
+
 static void signal_handler(int sig, siginfo_t* si, void* unused) {
-  wasm_rt_trap(WASM_RT_TRAP_OOB);
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+  uintptr_t addr = (uintptr_t)si->si_addr;
+  if (addr >= g_stack_guard_start && addr < g_stack_guard_end) {
+    signal_trap(sig, WASM_RT_TRAP_EXHAUSTION);
+  }
+#endif
+  signal_trap(sig, WASM_RT_TRAP_OOB);
 }
 #endif
 
@@ -120,6 +215,10 @@ void wasm_rt_allocate_memory(wasm_rt_memory_t* memory,
     sigemptyset(&sa.sa_mask);
     sa.sa_sigaction = signal_handler;
 
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+    sa.sa_flags |= SA_ONSTACK;
+#endif
+
     /* Install SIGSEGV and SIGBUS handlers, since macOS seems to use SIGBUS. */
     if (sigaction(SIGSEGV, &sa, NULL) != 0 ||
         sigaction(SIGBUS, &sa, NULL) != 0) {
@@ -127,6 +226,9 @@ void wasm_rt_allocate_memory(wasm_rt_memory_t* memory,
       abort();
     }
   }
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+  wasm_rt_init_thread();
+#endif
 
   /* Reserve 8GiB. */
   void* addr =
@@ -135,8 +237,14 @@ void wasm_rt_allocate_memory(wasm_rt_memory_t* memory,
     perror("mmap failed");
     abort();
   }
-  mprotect(addr, byte_length, PROT_READ | PROT_WRITE);
+#if WABT_BIG_ENDIAN
+  /* The memory is stored reversed, so it ends at the top of the reservation
+   * and grows downward in place. */
+  memory->data = (uint8_t*)addr + 0x200000000ul - byte_length;
+#else
   memory->data = addr;
+#endif
+  mprotect(memory->data, byte_length, PROT_READ | PROT_WRITE);
 #else
   memory->data = calloc(byte_length, 1);
 #endif
@@ -158,20 +266,24 @@ uint32_t wasm_rt_grow_memory(wasm_rt_memory_t* memory, uint32_t delta) {
   uint32_t new_size = new_pages * PAGE_SIZE;
   uint32_t delta_size = delta * PAGE_SIZE;
 #if WASM_RT_MEMCHECK_SIGNAL_HANDLER_POSIX
+#if WABT_BIG_ENDIAN
+  uint8_t* new_data = memory->data - (new_size - old_size);
+  mprotect(new_data, delta_size, PROT_READ | PROT_WRITE);
+#else
   uint8_t* new_data = memory->data;
   mprotect(new_data + old_size, delta_size, PROT_READ | PROT_WRITE);
+#endif
 #else
   uint8_t* new_data = realloc(memory->data, new_size);
   if (new_data == NULL) {
     return (uint32_t)-1;
   }
-#if !WABT_BIG_ENDIAN
-  memset(new_data + old_size, 0, delta_size);
-#endif
-#endif
 #if WABT_BIG_ENDIAN
   memmove(new_data + new_size - old_size, new_data, old_size);
   memset(new_data, 0, delta_size);
+#else
+  memset(new_data + old_size, 0, delta_size);
+#endif
 #endif
   memory->pages = new_pages;
   memory->size = new_size;
@@ -32,7 +32,10 @@ extern jmp_buf g_jmp_buf;
 extern uint32_t g_saved_call_stack_depth;
 
 #if WASM_RT_MEMCHECK_SIGNAL_HANDLER_POSIX
-#define WASM_RT_SETJMP(buf) sigsetjmp(buf, 1)
+/* The signal mask is not saved on entry, which would be a syscall on every
+ * call into the module. The signal handler unblocks its signal itself before
+ * jumping out, so only a trap pays for restoring the mask. */
+#define WASM_RT_SETJMP(buf) sigsetjmp(buf, 0)
 #define WASM_RT_LONGJMP(buf, val) siglongjmp(buf, val)
 #else
 #define WASM_RT_SETJMP(buf) setjmp(buf)
@@ -54,9 +57,13 @@ extern uint32_t g_saved_call_stack_depth;
  *   my_wasm_func();
  * ```
  */
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+#define wasm_rt_impl_try() WASM_RT_SETJMP(g_jmp_buf)
+#else
 #define wasm_rt_impl_try()                              \
   (g_saved_call_stack_depth = wasm_rt_call_stack_depth, \
    WASM_RT_SETJMP(g_jmp_buf))
+#endif
 
 #ifdef __cplusplus
 }
@@ -23,18 +23,6 @@
 extern "C" {
 #endif
 
-/** Maximum stack depth before trapping. This can be configured by defining
- * this symbol before including wasm-rt when building the generated c files,
- * for example:
- *
- * ```
- *   cc -c -DWASM_RT_MAX_CALL_STACK_DEPTH=100 my_module.c -o my_module.o
- * ```
- * */
-#ifndef WASM_RT_MAX_CALL_STACK_DEPTH
-#define WASM_RT_MAX_CALL_STACK_DEPTH 500
-#endif
-
 /** Enable memory checking via a signal handler via the following definition:
  *
  * #define WASM_RT_MEMCHECK_SIGNAL_HANDLER 1
@@ -68,6 +56,49 @@ extern "C" {
 
 #endif
 
+/** Enable stack exhaustion detection via the native stack guard instead of
+ * the call depth limit via the following definition:
+ *
+ * #define WASM_RT_STACK_EXHAUSTION_HANDLER 1
+ *
+ * Running off the end of the native stack faults in the guard region below
+ * it. The fault is handled on an alternate signal stack (`sigaltstack`) and,
+ * if the faulting address lies just below the stack of the faulting thread,
+ * reported as `WASM_RT_TRAP_EXHAUSTION`, so recursion is bounded by the
+ * actual stack size and calls do no depth bookkeeping. Each thread that runs
+ * wasm code needs its own alternate stack, see `wasm_rt_init_thread`.
+ * Requires the POSIX signal handler on Linux or macOS.
+ * */
+#ifndef WASM_RT_STACK_EXHAUSTION_HANDLER
+#define WASM_RT_STACK_EXHAUSTION_HANDLER 0
+#endif
+
+#if WASM_RT_STACK_EXHAUSTION_HANDLER && !WASM_RT_MEMCHECK_SIGNAL_HANDLER_POSIX
+#error "Stack exhaustion handler requires WASM_RT_MEMCHECK_SIGNAL_HANDLER"
+#endif
+
+#if WASM_RT_STACK_EXHAUSTION_HANDLER && !defined(__linux__) && !defined(__APPLE__)
+#error "Stack exhaustion handler is not supported for this OS!"
+#endif
+
+/** Maximum stack depth before trapping. This can be configured by defining
+ * this symbol before including wasm-rt when building the generated c files,
+ * for example:
+ *
+ * ```
+ *   cc -c -DWASM_RT_MAX_CALL_STACK_DEPTH=100 my_module.c -o my_module.o
+ * ```
+ *
+ * Not used with the stack exhaustion handler.
+ * */
+#ifndef WASM_RT_MAX_CALL_STACK_DEPTH
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+#define WASM_RT_MAX_CALL_STACK_DEPTH 0xffffffffu
+#else
+#define WASM_RT_MAX_CALL_STACK_DEPTH 500
+#endif
+#endif
+
 /** Detect Big-Endian target. */
 #ifndef WABT_BIG_ENDIAN
 /* Detect with GCC 4.6's macro */
@@ -297,8 +328,24 @@ extern void wasm_rt_allocate_table(wasm_rt_table_t*,
                                    uint32_t elements,
                                    uint32_t max_elements);
 
+#if WASM_RT_STACK_EXHAUSTION_HANDLER
+/** The generated FUNC_PROLOGUE and FUNC_EPILOGUE count calls in
+ * `wasm_rt_call_stack_depth`. With the stack exhaustion handler it names a
+ * temporary rather than a global, so the counting is dead code and the
+ * compiler drops it: calls do no bookkeeping. */
+#define wasm_rt_call_stack_depth (*(uint32_t[1]){0})
+
+/** Set up stack exhaustion detection for the calling thread: an alternate
+ * signal stack for the handler and the bounds of the thread's stack.
+ * `wasm_rt_allocate_memory` does this for the thread that calls it, other
+ * threads must call it before running wasm code, and `wasm_rt_free_thread`
+ * before they exit. */
+extern void wasm_rt_init_thread(void);
+extern void wasm_rt_free_thread(void);
+#else
 /** Current call stack depth. */
 extern uint32_t wasm_rt_call_stack_depth;
+#endif
 
 #ifdef __cplusplus
 }
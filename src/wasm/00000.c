@@ -0,0 +1,7253 @@
+#include "w2c2_base.h"
+
+#include "decls.h"
+
+void f11() {
+L0:;
+}
+
+void f12() {
+U32 l0=0;
+U32 l1=0;
+U32 l2=0;
+U32 l3=0;
+U32 si0,si1,si2;
+WASM_INTERRUPT_CHECK();
+si0=g0;
+si1=16u;
+si0-=si1;
+l0=si0;
+g0=si0;
+f21();
+si0=3u;
+l1=si0;
+L5:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l1;
+si1=l0;
+si0=(*f_wasiX5Funstable_fdX5FprestatX5Fget)(si0,si1);
+l2=si0;
+si1=8u;
+si0=si0 == si1;
+if (si0) {
+goto L4;
+}
+si0=l2;
+if (si0) {
+goto L2;
+}
+si0=l0;
+si0=i32_load8_u(&m0,(U64)(si0));
+if (si0) {
+goto L6;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=1u;
+si0+=si1;
+si0=f13(si0);
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l1;
+si1=l2;
+si2=l0;
+si2=i32_load(&m0,(U64)(si2)+4u);
+si0=(*f_wasiX5Funstable_fdX5FprestatX5FdirX5Fname)(si0,si1,si2);
+if (si0) {
+goto L3;
+}
+si0=l2;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si0+=si1;
+si1=0u;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l1;
+si1=l2;
+si0=f22(si0,si1);
+l3=si0;
+si0=l2;
+f15(si0);
+si0=l3;
+if (si0) {
+goto L2;
+}
+L6:;
+si0=l1;
+si1=1u;
+si0+=si1;
+l1=si0;
+if (si0) {
+goto L5;
+}
+}
+L4:;
+si0=l0;
+si1=l0;
+si2=12u;
+si1+=si2;
+si0=(*f_wasiX5Funstable_environX5FsizesX5Fget)(si0,si1);
+if (si0) {
+goto L9;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+l1=si0;
+si0=!(si0);
+if (si0) {
+goto L8;
+}
+si0=0u;
+si1=l1;
+si2=2u;
+si1 <<= (si2 & 31);
+si2=4u;
+si1+=si2;
+si1=f13(si1);
+i32_store(&m0,(U64)(si0)+1528u,si1);
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+12u);
+si0=f13(si0);
+l1=si0;
+si0=!(si0);
+if (si0) {
+goto L9;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1528u);
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L9;
+}
+si0=l2;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1));
+si2=2u;
+si1 <<= (si2 & 31);
+si0+=si1;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1528u);
+si1=l1;
+si0=(*f_wasiX5Funstable_environX5Fget)(si0,si1);
+si0=!(si0);
+if (si0) {
+goto L7;
+}
+L9:;
+si0=71u;
+f18(si0);
+UNREACHABLE;
+L8:;
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1528u,si1);
+L7:;
+si0=l0;
+si1=12u;
+si0+=si1;
+si1=l0;
+si0=(*f_wasiX5Funstable_argsX5FsizesX5Fget)(si0,si1);
+if (si0) {
+goto L12;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l1=si0;
+si0=!(si0);
+if (si0) {
+goto L11;
+}
+si0=l1;
+si1=2u;
+si0 <<= (si1 & 31);
+si0=f13(si0);
+l1=si0;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+si0=f13(si0);
+l2=si0;
+si0=l1;
+si0=!(si0);
+if (si0) {
+goto L12;
+}
+si0=l2;
+si0=!(si0);
+if (si0) {
+goto L12;
+}
+si0=l1;
+si1=l2;
+si0=(*f_wasiX5Funstable_argsX5Fget)(si0,si1);
+si0=!(si0);
+if (si0) {
+goto L10;
+}
+L12:;
+si0=71u;
+f18(si0);
+UNREACHABLE;
+L11:;
+L10:;
+f11();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+12u);
+si1=l1;
+si0=f47(si0,si1);
+l1=si0;
+f26();
+si0=l1;
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=16u;
+si0+=si1;
+g0=si0;
+goto L0;
+L3:;
+si0=l2;
+f15(si0);
+L2:;
+si0=71u;
+f18(si0);
+UNREACHABLE;
+L1:;
+si0=l1;
+f18(si0);
+UNREACHABLE;
+L0:;
+}
+
+U32 f13(U32 l0) {
+U32 si0;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=f14(si0);
+L0:;
+return si0;
+}
+
+U32 f14(U32 l0) {
+U32 l1=0;
+U32 l2=0;
+U32 l3=0;
+U32 l4=0;
+U32 l5=0;
+U32 l6=0;
+U32 l7=0;
+U32 l8=0;
+U32 l9=0;
+U32 l10=0;
+U32 l11=0;
+U32 l12=0;
+U32 si0,si1,si2,si3,si4,si5;
+U64 sj1;
+WASM_INTERRUPT_CHECK();
+si0=g0;
+si1=16u;
+si0-=si1;
+l1=si0;
+g0=si0;
+si0=l0;
+si1=244u;
+si0=si0 > si1;
+if (si0) {
+goto L38;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1024u);
+l2=si0;
+si1=16u;
+si2=l0;
+si3=11u;
+si2+=si3;
+si3=-8u;
+si2&=si3;
+si3=l0;
+si4=11u;
+si3=si3 < si4;
+si1=si3 ? si1 : si2;
+l3=si1;
+si2=3u;
+si1 >>= (si2 & 31);
+l4=si1;
+si0 >>= (si1 & 31);
+l0=si0;
+si1=3u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L37;
+}
+si0=l0;
+si1=-1u;
+si0^=si1;
+si1=1u;
+si0&=si1;
+si1=l4;
+si0+=si1;
+l5=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+l6=si0;
+si1=1072u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+si1=8u;
+si0+=si1;
+l0=si0;
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l3=si0;
+si1=l6;
+si2=1064u;
+si1+=si2;
+l6=si1;
+si0=si0 == si1;
+if (si0) {
+goto L36;
+}
+si0=l3;
+si1=l6;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l6;
+si1=8u;
+si0+=si1;
+si1=l3;
+i32_store(&m0,(U64)(si0),si1);
+goto L35;
+L38:;
+si0=-1u;
+l3=si0;
+si0=l0;
+si1=-65u;
+si0=si0 > si1;
+if (si0) {
+goto L23;
+}
+si0=l0;
+si1=11u;
+si0+=si1;
+l0=si0;
+si1=-8u;
+si0&=si1;
+l3=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1028u);
+l7=si0;
+si0=!(si0);
+if (si0) {
+goto L23;
+}
+si0=0u;
+l8=si0;
+si0=l0;
+si1=8u;
+si0 >>= (si1 & 31);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L39;
+}
+si0=31u;
+l8=si0;
+si0=l3;
+si1=16777215u;
+si0=si0 > si1;
+if (si0) {
+goto L39;
+}
+si0=l3;
+si1=14u;
+si2=l0;
+si3=l0;
+si4=1048320u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=8u;
+si3&=si4;
+l4=si3;
+si2 <<= (si3 & 31);
+l0=si2;
+si3=520192u;
+si2+=si3;
+si3=16u;
+si2 >>= (si3 & 31);
+si3=4u;
+si2&=si3;
+l5=si2;
+si3=l4;
+si2|=si3;
+si3=l0;
+si4=l5;
+si3 <<= (si4 & 31);
+l0=si3;
+si4=245760u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=2u;
+si3&=si4;
+l4=si3;
+si2|=si3;
+si1-=si2;
+si2=l0;
+si3=l4;
+si2 <<= (si3 & 31);
+si3=15u;
+si2 >>= (si3 & 31);
+si1+=si2;
+l0=si1;
+si2=7u;
+si1+=si2;
+si0 >>= (si1 & 31);
+si1=1u;
+si0&=si1;
+si1=l0;
+si2=1u;
+si1 <<= (si2 & 31);
+si0|=si1;
+l8=si0;
+L39:;
+si0=0u;
+si1=l3;
+si0-=si1;
+l5=si0;
+si0=l8;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L34;
+}
+si0=l3;
+si1=0u;
+si2=25u;
+si3=l8;
+si4=1u;
+si3 >>= (si4 & 31);
+si2-=si3;
+si3=l8;
+si4=31u;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0 <<= (si1 & 31);
+l6=si0;
+si0=0u;
+l0=si0;
+si0=0u;
+l9=si0;
+L40:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l3;
+si0-=si1;
+l2=si0;
+si1=l5;
+si0=si0 >= si1;
+if (si0) {
+goto L41;
+}
+si0=l2;
+l5=si0;
+si0=l4;
+l9=si0;
+si0=l2;
+si0=!(si0);
+if (si0) {
+goto L31;
+}
+L41:;
+si0=l0;
+si1=l4;
+si2=20u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l2=si1;
+si2=l2;
+si3=l4;
+si4=l6;
+si5=29u;
+si4 >>= (si5 & 31);
+si5=4u;
+si4&=si5;
+si3+=si4;
+si4=16u;
+si3+=si4;
+si3=i32_load(&m0,(U64)(si3));
+l4=si3;
+si2=si2 == si3;
+si0=si2 ? si0 : si1;
+si1=l0;
+si2=l2;
+si0=si2 ? si0 : si1;
+l0=si0;
+si0=l6;
+si1=l4;
+si2=0u;
+si1=si1 != si2;
+si0 <<= (si1 & 31);
+l6=si0;
+si0=l4;
+if (si0) {
+goto L40;
+}
+}
+si0=l0;
+si1=l9;
+si0|=si1;
+si0=!(si0);
+if (si0) {
+goto L33;
+}
+goto L26;
+L37:;
+si0=l3;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1032u);
+l7=si1;
+si0=si0 <= si1;
+if (si0) {
+goto L23;
+}
+si0=l0;
+si0=!(si0);
+if (si0) {
+goto L32;
+}
+si0=l0;
+si1=l4;
+si0 <<= (si1 & 31);
+si1=2u;
+si2=l4;
+si1 <<= (si2 & 31);
+l0=si1;
+si2=0u;
+si3=l0;
+si2-=si3;
+si1|=si2;
+si0&=si1;
+l0=si0;
+si1=0u;
+si2=l0;
+si1-=si2;
+si0&=si1;
+si1=-1u;
+si0+=si1;
+l0=si0;
+si1=l0;
+si2=12u;
+si1 >>= (si2 & 31);
+si2=16u;
+si1&=si2;
+l0=si1;
+si0 >>= (si1 & 31);
+l4=si0;
+si1=5u;
+si0 >>= (si1 & 31);
+si1=8u;
+si0&=si1;
+l5=si0;
+si1=l0;
+si0|=si1;
+si1=l4;
+si2=l5;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=2u;
+si1 >>= (si2 & 31);
+si2=4u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=1u;
+si1 >>= (si2 & 31);
+si2=2u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=1u;
+si1 >>= (si2 & 31);
+si2=1u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+si0+=si1;
+l5=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+l6=si0;
+si1=1072u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+si1=l6;
+si2=1064u;
+si1+=si2;
+l6=si1;
+si0=si0 == si1;
+if (si0) {
+goto L30;
+}
+si0=l0;
+si1=l6;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l6;
+si1=8u;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+goto L29;
+L36:;
+si0=0u;
+si1=l2;
+si2=-2u;
+si3=l5;
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+L35:;
+si0=l4;
+si1=l5;
+si2=3u;
+si1 <<= (si2 & 31);
+l5=si1;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l4;
+si1=l5;
+si0+=si1;
+l4=si0;
+si1=l4;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L1;
+L34:;
+si0=0u;
+l0=si0;
+si0=0u;
+l9=si0;
+si0=0u;
+si1=0u;
+si0|=si1;
+if (si0) {
+goto L26;
+}
+L33:;
+si0=2u;
+si1=l8;
+si0 <<= (si1 & 31);
+l0=si0;
+si1=0u;
+si2=l0;
+si1-=si2;
+si0|=si1;
+si1=l7;
+si0&=si1;
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L23;
+}
+si0=l0;
+si1=0u;
+si2=l0;
+si1-=si2;
+si0&=si1;
+si1=-1u;
+si0+=si1;
+l0=si0;
+si1=l0;
+si2=12u;
+si1 >>= (si2 & 31);
+si2=16u;
+si1&=si2;
+l0=si1;
+si0 >>= (si1 & 31);
+l4=si0;
+si1=5u;
+si0 >>= (si1 & 31);
+si1=8u;
+si0&=si1;
+l6=si0;
+si1=l0;
+si0|=si1;
+si1=l4;
+si2=l6;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=2u;
+si1 >>= (si2 & 31);
+si2=4u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=1u;
+si1 >>= (si2 & 31);
+si2=2u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=1u;
+si1 >>= (si2 & 31);
+si2=1u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+si0+=si1;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+if (si0) {
+goto L25;
+}
+goto L24;
+L32:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1028u);
+l10=si0;
+si0=!(si0);
+if (si0) {
+goto L23;
+}
+si0=l10;
+si1=0u;
+si2=l10;
+si1-=si2;
+si0&=si1;
+si1=-1u;
+si0+=si1;
+l0=si0;
+si1=l0;
+si2=12u;
+si1 >>= (si2 & 31);
+si2=16u;
+si1&=si2;
+l0=si1;
+si0 >>= (si1 & 31);
+l4=si0;
+si1=5u;
+si0 >>= (si1 & 31);
+si1=8u;
+si0&=si1;
+l5=si0;
+si1=l0;
+si0|=si1;
+si1=l4;
+si2=l5;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=2u;
+si1 >>= (si2 & 31);
+si2=4u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=1u;
+si1 >>= (si2 & 31);
+si2=2u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+l0=si1;
+si2=1u;
+si1 >>= (si2 & 31);
+si2=1u;
+si1&=si2;
+l4=si1;
+si0|=si1;
+si1=l0;
+si2=l4;
+si1 >>= (si2 & 31);
+si0+=si1;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l6=si0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l3;
+si0-=si1;
+l5=si0;
+si0=l6;
+l9=si0;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L28;
+}
+si0=1u;
+l4=si0;
+goto L27;
+L31:;
+si0=0u;
+l5=si0;
+si0=l4;
+l9=si0;
+si0=l4;
+l0=si0;
+goto L25;
+L30:;
+si0=0u;
+si1=l2;
+si2=-2u;
+si3=l5;
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+l2=si1;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+L29:;
+si0=l4;
+si1=8u;
+si0+=si1;
+l0=si0;
+si0=l4;
+si1=l3;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l4;
+si1=l5;
+si2=3u;
+si1 <<= (si2 & 31);
+l5=si1;
+si0+=si1;
+si1=l5;
+si2=l3;
+si1-=si2;
+l5=si1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=l3;
+si0+=si1;
+l6=si0;
+si1=l5;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l7;
+si0=!(si0);
+if (si0) {
+goto L42;
+}
+si0=l7;
+si1=3u;
+si0 >>= (si1 & 31);
+l9=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+si1=1064u;
+si0+=si1;
+l3=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1044u);
+l4=si0;
+si0=l2;
+si1=1u;
+si2=l9;
+si1 <<= (si2 & 31);
+l9=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L44;
+}
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l9=si0;
+goto L43;
+L44:;
+si0=0u;
+si1=l2;
+si2=l9;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+si0=l3;
+l9=si0;
+L43:;
+si0=l9;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l3;
+si1=l4;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l4;
+si1=l3;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l4;
+si1=l9;
+i32_store(&m0,(U64)(si0)+8u,si1);
+L42:;
+si0=0u;
+si1=l6;
+i32_store(&m0,(U64)(si0)+1044u,si1);
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+goto L1;
+L28:;
+si0=0u;
+l4=si0;
+L27:;
+L47:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l4;
+switch (si0) {
+case 0:
+goto L50;
+case 1:
+goto L51;
+default:
+goto L51;
+}
+L51:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l3;
+si0-=si1;
+l4=si0;
+si1=l5;
+si2=l4;
+si3=l5;
+si2=si2 < si3;
+l4=si2;
+si0=si2 ? si0 : si1;
+l5=si0;
+si0=l0;
+si1=l6;
+si2=l4;
+si0=si2 ? si0 : si1;
+l6=si0;
+si0=l0;
+l9=si0;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+if (si0) {
+goto L49;
+}
+si0=0u;
+l4=si0;
+goto L47;
+L50:;
+si0=l9;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+if (si0) {
+goto L48;
+}
+si0=l6;
+si1=l3;
+si0+=si1;
+l11=si0;
+si1=l6;
+si0=si0 <= si1;
+if (si0) {
+goto L23;
+}
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+24u);
+l12=si0;
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l9=si0;
+si1=l6;
+si0=si0 == si1;
+if (si0) {
+goto L52;
+}
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+si1=l9;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l9;
+si1=l0;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l12;
+if (si0) {
+goto L46;
+}
+goto L45;
+L52:;
+si0=l6;
+si1=20u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+if (si0) {
+goto L54;
+}
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L53;
+}
+si0=l6;
+si1=16u;
+si0+=si1;
+l4=si0;
+L54:;
+L55:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l4;
+l8=si0;
+si0=l0;
+l9=si0;
+si1=20u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+if (si0) {
+goto L55;
+}
+si0=l9;
+si1=16u;
+si0+=si1;
+l4=si0;
+si0=l9;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+if (si0) {
+goto L55;
+}
+}
+si0=l8;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l12;
+si0=!(si0);
+if (si0) {
+goto L45;
+}
+goto L46;
+L53:;
+si0=0u;
+l9=si0;
+si0=l12;
+if (si0) {
+goto L46;
+}
+goto L45;
+L49:;
+si0=1u;
+l4=si0;
+goto L47;
+L48:;
+si0=1u;
+l4=si0;
+goto L47;
+}
+L46:;
+si0=l6;
+si1=l6;
+si1=i32_load(&m0,(U64)(si1)+28u);
+l4=si1;
+si2=2u;
+si1 <<= (si2 & 31);
+si2=1328u;
+si1+=si2;
+l0=si1;
+si1=i32_load(&m0,(U64)(si1));
+si0=si0 == si1;
+if (si0) {
+goto L58;
+}
+si0=l12;
+si1=16u;
+si2=20u;
+si3=l12;
+si3=i32_load(&m0,(U64)(si3)+16u);
+si4=l6;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0+=si1;
+si1=l9;
+i32_store(&m0,(U64)(si0),si1);
+si0=l9;
+if (si0) {
+goto L57;
+}
+goto L45;
+L58:;
+si0=l0;
+si1=l9;
+i32_store(&m0,(U64)(si0),si1);
+si0=l9;
+si0=!(si0);
+if (si0) {
+goto L56;
+}
+L57:;
+si0=l9;
+si1=l12;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L59;
+}
+si0=l9;
+si1=l0;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=l0;
+si1=l9;
+i32_store(&m0,(U64)(si0)+24u,si1);
+L59:;
+si0=l6;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L45;
+}
+si0=l9;
+si1=20u;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=l9;
+i32_store(&m0,(U64)(si0)+24u,si1);
+goto L45;
+L56:;
+si0=0u;
+si1=l10;
+si2=-2u;
+si3=l4;
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+L45:;
+si0=l5;
+si1=15u;
+si0=si0 > si1;
+if (si0) {
+goto L61;
+}
+si0=l6;
+si1=l5;
+si2=l3;
+si1+=si2;
+l0=si1;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l6;
+si1=l0;
+si0+=si1;
+l0=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L60;
+L61:;
+si0=l11;
+si1=l5;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l6;
+si1=l3;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l11;
+si1=l5;
+si0+=si1;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l7;
+si0=!(si0);
+if (si0) {
+goto L62;
+}
+si0=l7;
+si1=3u;
+si0 >>= (si1 & 31);
+l3=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+si1=1064u;
+si0+=si1;
+l4=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1044u);
+l0=si0;
+si0=1u;
+si1=l3;
+si0 <<= (si1 & 31);
+l3=si0;
+si1=l2;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L64;
+}
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l3=si0;
+goto L63;
+L64:;
+si0=0u;
+si1=l3;
+si2=l2;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+si0=l4;
+l3=si0;
+L63:;
+si0=l3;
+si1=l0;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l4;
+si1=l0;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l0;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l0;
+si1=l3;
+i32_store(&m0,(U64)(si0)+8u,si1);
+L62:;
+si0=0u;
+si1=l11;
+i32_store(&m0,(U64)(si0)+1044u,si1);
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+L60:;
+si0=l6;
+si1=8u;
+si0+=si1;
+l0=si0;
+goto L1;
+L26:;
+si0=l0;
+si0=!(si0);
+if (si0) {
+goto L24;
+}
+L25:;
+L65:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l3;
+si0-=si1;
+l2=si0;
+si1=l5;
+si0=si0 < si1;
+l6=si0;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l4=si0;
+if (si0) {
+goto L66;
+}
+si0=l0;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+L66:;
+si0=l2;
+si1=l5;
+si2=l6;
+si0=si2 ? si0 : si1;
+l5=si0;
+si0=l0;
+si1=l9;
+si2=l6;
+si0=si2 ? si0 : si1;
+l9=si0;
+si0=l4;
+l0=si0;
+si0=l4;
+if (si0) {
+goto L65;
+}
+}
+L24:;
+si0=l9;
+si0=!(si0);
+if (si0) {
+goto L23;
+}
+si0=l5;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1032u);
+si2=l3;
+si1-=si2;
+si0=si0 >= si1;
+if (si0) {
+goto L23;
+}
+si0=l9;
+si1=l3;
+si0+=si1;
+l8=si0;
+si1=l9;
+si0=si0 <= si1;
+if (si0) {
+goto L23;
+}
+si0=l9;
+si0=i32_load(&m0,(U64)(si0)+24u);
+l10=si0;
+si0=l9;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l6=si0;
+si1=l9;
+si0=si0 == si1;
+if (si0) {
+goto L22;
+}
+si0=l9;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+si1=l6;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l6;
+si1=l0;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l10;
+if (si0) {
+goto L3;
+}
+goto L2;
+L23:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1032u);
+l0=si0;
+si1=l3;
+si0=si0 >= si1;
+if (si0) {
+goto L72;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1036u);
+l6=si0;
+si1=l3;
+si0=si0 <= si1;
+if (si0) {
+goto L71;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1048u);
+l0=si0;
+si1=l3;
+si0+=si1;
+l4=si0;
+si1=l6;
+si2=l3;
+si1-=si2;
+l5=si1;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1036u,si1);
+si0=0u;
+si1=l4;
+i32_store(&m0,(U64)(si0)+1048u,si1);
+si0=l0;
+si1=l3;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l0;
+si1=8u;
+si0+=si1;
+l0=si0;
+goto L1;
+L72:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1044u);
+l4=si0;
+si0=l0;
+si1=l3;
+si0-=si1;
+l5=si0;
+si1=16u;
+si0=si0 < si1;
+if (si0) {
+goto L70;
+}
+si0=l4;
+si1=l3;
+si0+=si1;
+l6=si0;
+si1=l5;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+si0=0u;
+si1=l6;
+i32_store(&m0,(U64)(si0)+1044u,si1);
+si0=l4;
+si1=l0;
+si0+=si1;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=l3;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L69;
+L71:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1496u);
+si0=!(si0);
+if (si0) {
+goto L68;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1504u);
+l4=si0;
+goto L67;
+L70:;
+si0=l4;
+si1=l0;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l4;
+si1=l0;
+si0+=si1;
+l0=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1044u,si1);
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+L69:;
+si0=l4;
+si1=8u;
+si0+=si1;
+l0=si0;
+goto L1;
+L68:;
+si0=0u;
+sj1=-1ull;
+i64_store(&m0,(U64)(si0)+1508u,sj1);
+si0=0u;
+sj1=281474976776192ull;
+i64_store(&m0,(U64)(si0)+1500u,sj1);
+si0=0u;
+si1=l1;
+si2=12u;
+si1+=si2;
+si2=-16u;
+si1&=si2;
+si2=1431655768u;
+si1^=si2;
+i32_store(&m0,(U64)(si0)+1496u,si1);
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1516u,si1);
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1468u,si1);
+si0=65536u;
+l4=si0;
+L67:;
+si0=0u;
+l0=si0;
+si0=l4;
+si1=l3;
+si2=47u;
+si1+=si2;
+l7=si1;
+si0+=si1;
+l2=si0;
+si1=0u;
+si2=l4;
+si1-=si2;
+l8=si1;
+si0&=si1;
+l9=si0;
+si1=l3;
+si0=si0 <= si1;
+if (si0) {
+goto L74;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1464u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L75;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1456u);
+l4=si0;
+si1=l9;
+si0+=si1;
+l5=si0;
+si1=l4;
+si0=si0 <= si1;
+if (si0) {
+goto L73;
+}
+si0=l5;
+si1=l0;
+si0=si0 > si1;
+if (si0) {
+goto L73;
+}
+L75:;
+si0=0u;
+si0=i32_load8_u(&m0,(U64)(si0)+1468u);
+si1=4u;
+si0&=si1;
+if (si0) {
+goto L14;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1048u);
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L76;
+}
+si0=1472u;
+l0=si0;
+L77:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+l5=si0;
+si1=l4;
+si0=si0 > si1;
+if (si0) {
+goto L78;
+}
+si0=l5;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si0+=si1;
+si1=l4;
+si0=si0 > si1;
+if (si0) {
+goto L21;
+}
+L78:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+if (si0) {
+goto L77;
+}
+}
+L76:;
+si0=0u;
+si0=f24(si0);
+l6=si0;
+si1=-1u;
+si0=si0 == si1;
+if (si0) {
+goto L15;
+}
+si0=l9;
+l2=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1500u);
+l0=si0;
+si1=-1u;
+si0+=si1;
+l4=si0;
+si1=l6;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L79;
+}
+si0=l9;
+si1=l6;
+si0-=si1;
+si1=l4;
+si2=l6;
+si1+=si2;
+si2=0u;
+si3=l0;
+si2-=si3;
+si1&=si2;
+si0+=si1;
+l2=si0;
+L79:;
+si0=l2;
+si1=l3;
+si0=si0 <= si1;
+if (si0) {
+goto L15;
+}
+si0=l2;
+si1=2147483646u;
+si0=si0 > si1;
+if (si0) {
+goto L15;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1464u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L80;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1456u);
+l4=si0;
+si1=l2;
+si0+=si1;
+l5=si0;
+si1=l4;
+si0=si0 <= si1;
+if (si0) {
+goto L15;
+}
+si0=l5;
+si1=l0;
+si0=si0 > si1;
+if (si0) {
+goto L15;
+}
+L80:;
+si0=l2;
+si0=f24(si0);
+l0=si0;
+si1=l6;
+si0=si0 != si1;
+if (si0) {
+goto L20;
+}
+goto L13;
+L74:;
+si0=0u;
+si1=48u;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+goto L1;
+L73:;
+si0=0u;
+l0=si0;
+si0=0u;
+si1=48u;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+goto L1;
+L22:;
+si0=l9;
+si1=20u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+if (si0) {
+goto L81;
+}
+si0=l9;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L19;
+}
+si0=l9;
+si1=16u;
+si0+=si1;
+l4=si0;
+L81:;
+L82:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l4;
+l2=si0;
+si0=l0;
+l6=si0;
+si1=20u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+if (si0) {
+goto L82;
+}
+si0=l6;
+si1=16u;
+si0+=si1;
+l4=si0;
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+if (si0) {
+goto L82;
+}
+}
+si0=l2;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l10;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+goto L3;
+L21:;
+si0=l2;
+si1=l6;
+si0-=si1;
+si1=l8;
+si0&=si1;
+l2=si0;
+si1=2147483646u;
+si0=si0 > si1;
+if (si0) {
+goto L15;
+}
+si0=l2;
+si0=f24(si0);
+l6=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1));
+si2=l0;
+si2=i32_load(&m0,(U64)(si2)+4u);
+si1+=si2;
+si0=si0 == si1;
+if (si0) {
+goto L17;
+}
+si0=l6;
+l0=si0;
+L20:;
+si0=l0;
+l6=si0;
+si0=l3;
+si1=48u;
+si0+=si1;
+si1=l2;
+si0=si0 <= si1;
+if (si0) {
+goto L18;
+}
+si0=l2;
+si1=2147483646u;
+si0=si0 > si1;
+if (si0) {
+goto L18;
+}
+si0=l6;
+si1=-1u;
+si0=si0 == si1;
+if (si0) {
+goto L18;
+}
+si0=l7;
+si1=l2;
+si0-=si1;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1504u);
+l0=si1;
+si0+=si1;
+si1=0u;
+si2=l0;
+si1-=si2;
+si0&=si1;
+l0=si0;
+si1=2147483646u;
+si0=si0 > si1;
+if (si0) {
+goto L13;
+}
+si0=l0;
+si0=f24(si0);
+si1=-1u;
+si0=si0 == si1;
+if (si0) {
+goto L16;
+}
+si0=l0;
+si1=l2;
+si0+=si1;
+l2=si0;
+goto L13;
+L19:;
+si0=0u;
+l6=si0;
+si0=l10;
+if (si0) {
+goto L3;
+}
+goto L2;
+L18:;
+si0=l6;
+si1=-1u;
+si0=si0 != si1;
+if (si0) {
+goto L13;
+}
+goto L15;
+L17:;
+si0=l6;
+si1=-1u;
+si0=si0 != si1;
+if (si0) {
+goto L13;
+}
+goto L15;
+L16:;
+si0=0u;
+si1=l2;
+si0-=si1;
+si0=f24(si0);
+L15:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1468u);
+si2=4u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1468u,si1);
+L14:;
+si0=l9;
+si1=2147483646u;
+si0=si0 > si1;
+if (si0) {
+goto L12;
+}
+si0=l9;
+si0=f24(si0);
+l6=si0;
+si1=0u;
+si1=f24(si1);
+l0=si1;
+si0=si0 >= si1;
+if (si0) {
+goto L12;
+}
+si0=l6;
+si1=-1u;
+si0=si0 == si1;
+if (si0) {
+goto L12;
+}
+si0=l0;
+si1=-1u;
+si0=si0 == si1;
+if (si0) {
+goto L12;
+}
+si0=l0;
+si1=l6;
+si0-=si1;
+l2=si0;
+si1=l3;
+si2=40u;
+si1+=si2;
+si0=si0 <= si1;
+if (si0) {
+goto L12;
+}
+L13:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1456u);
+si2=l2;
+si1+=si2;
+l0=si1;
+i32_store(&m0,(U64)(si0)+1456u,si1);
+si0=l0;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1460u);
+si0=si0 <= si1;
+if (si0) {
+goto L83;
+}
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1460u,si1);
+L83:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1048u);
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L87;
+}
+si0=1472u;
+l0=si0;
+L88:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l6;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+si2=l0;
+si2=i32_load(&m0,(U64)(si2)+4u);
+l9=si2;
+si1+=si2;
+si0=si0 == si1;
+if (si0) {
+goto L86;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+if (si0) {
+goto L88;
+}
+goto L85;
+}
+L87:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1040u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L90;
+}
+si0=l6;
+si1=l0;
+si0=si0 >= si1;
+if (si0) {
+goto L89;
+}
+L90:;
+si0=0u;
+si1=l6;
+i32_store(&m0,(U64)(si0)+1040u,si1);
+L89:;
+si0=0u;
+l0=si0;
+si0=0u;
+si1=l2;
+i32_store(&m0,(U64)(si0)+1476u,si1);
+si0=0u;
+si1=l6;
+i32_store(&m0,(U64)(si0)+1472u,si1);
+si0=0u;
+si1=-1u;
+i32_store(&m0,(U64)(si0)+1056u,si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1496u);
+i32_store(&m0,(U64)(si0)+1060u,si1);
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1484u,si1);
+L91:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si1=1072u;
+si0+=si1;
+si1=l0;
+si2=1064u;
+si1+=si2;
+l4=si1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=1076u;
+si0+=si1;
+si1=l4;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=8u;
+si0+=si1;
+l0=si0;
+si1=256u;
+si0=si0 != si1;
+if (si0) {
+goto L91;
+}
+}
+si0=l6;
+si1=-8u;
+si2=l6;
+si1-=si2;
+si2=7u;
+si1&=si2;
+si2=0u;
+si3=l6;
+si4=8u;
+si3+=si4;
+si4=7u;
+si3&=si4;
+si1=si3 ? si1 : si2;
+l0=si1;
+si0+=si1;
+l4=si0;
+si1=l2;
+si2=-40u;
+si1+=si2;
+l5=si1;
+si2=l0;
+si1-=si2;
+l0=si1;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1512u);
+i32_store(&m0,(U64)(si0)+1052u,si1);
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1036u,si1);
+si0=0u;
+si1=l4;
+i32_store(&m0,(U64)(si0)+1048u,si1);
+si0=l6;
+si1=l5;
+si0+=si1;
+si1=40u;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L84;
+L86:;
+si0=l0;
+si0=i32_load8_u(&m0,(U64)(si0)+12u);
+si1=8u;
+si0&=si1;
+if (si0) {
+goto L85;
+}
+si0=l6;
+si1=l4;
+si0=si0 <= si1;
+if (si0) {
+goto L85;
+}
+si0=l5;
+si1=l4;
+si0=si0 > si1;
+if (si0) {
+goto L85;
+}
+si0=l4;
+si1=-8u;
+si2=l4;
+si1-=si2;
+si2=7u;
+si1&=si2;
+si2=0u;
+si3=l4;
+si4=8u;
+si3+=si4;
+si4=7u;
+si3&=si4;
+si1=si3 ? si1 : si2;
+l5=si1;
+si0+=si1;
+l6=si0;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1036u);
+si2=l2;
+si1+=si2;
+l8=si1;
+si2=l5;
+si1-=si2;
+l5=si1;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l0;
+si1=4u;
+si0+=si1;
+si1=l9;
+si2=l2;
+si1+=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1512u);
+i32_store(&m0,(U64)(si0)+1052u,si1);
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1036u,si1);
+si0=0u;
+si1=l6;
+i32_store(&m0,(U64)(si0)+1048u,si1);
+si0=l4;
+si1=l8;
+si0+=si1;
+si1=40u;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L84;
+L85:;
+si0=l6;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1040u);
+si0=si0 >= si1;
+if (si0) {
+goto L92;
+}
+si0=0u;
+si1=l6;
+i32_store(&m0,(U64)(si0)+1040u,si1);
+L92:;
+si0=l6;
+si1=l2;
+si0+=si1;
+l5=si0;
+si0=1472u;
+l0=si0;
+L101:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+si1=l5;
+si0=si0 == si1;
+if (si0) {
+goto L100;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+if (si0) {
+goto L101;
+}
+goto L99;
+}
+L100:;
+si0=l0;
+si0=i32_load8_u(&m0,(U64)(si0)+12u);
+si1=8u;
+si0&=si1;
+if (si0) {
+goto L99;
+}
+si0=l0;
+si1=l6;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=l2;
+si1+=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l6;
+si1=-8u;
+si2=l6;
+si1-=si2;
+si2=7u;
+si1&=si2;
+si2=0u;
+si3=l6;
+si4=8u;
+si3+=si4;
+si4=7u;
+si3&=si4;
+si1=si3 ? si1 : si2;
+si0+=si1;
+l2=si0;
+si1=l3;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l5;
+si1=-8u;
+si2=l5;
+si1-=si2;
+si2=7u;
+si1&=si2;
+si2=0u;
+si3=l5;
+si4=8u;
+si3+=si4;
+si4=7u;
+si3&=si4;
+si1=si3 ? si1 : si2;
+si0+=si1;
+l6=si0;
+si1=l2;
+si0-=si1;
+si1=l3;
+si0-=si1;
+l0=si0;
+si0=l2;
+si1=l3;
+si0+=si1;
+l5=si0;
+si0=l4;
+si1=l6;
+si0=si0 == si1;
+if (si0) {
+goto L98;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1044u);
+si1=l6;
+si0=si0 == si1;
+if (si0) {
+goto L11;
+}
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l4=si0;
+si1=3u;
+si0&=si1;
+si1=1u;
+si0=si0 != si1;
+if (si0) {
+goto L5;
+}
+si0=l4;
+si1=-8u;
+si0&=si1;
+l7=si0;
+si0=l4;
+si1=255u;
+si0=si0 > si1;
+if (si0) {
+goto L10;
+}
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l3=si0;
+si1=l6;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l9=si1;
+si0=si0 == si1;
+if (si0) {
+goto L9;
+}
+si0=l3;
+si1=l9;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l9;
+si1=l3;
+i32_store(&m0,(U64)(si0)+12u,si1);
+goto L6;
+L99:;
+si0=1472u;
+l0=si0;
+L103:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+l5=si0;
+si1=l4;
+si0=si0 > si1;
+if (si0) {
+goto L104;
+}
+si0=l5;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si0+=si1;
+l5=si0;
+si1=l4;
+si0=si0 > si1;
+if (si0) {
+goto L102;
+}
+L104:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+goto L103;
+}
+L102:;
+si0=l6;
+si1=-8u;
+si2=l6;
+si1-=si2;
+si2=7u;
+si1&=si2;
+si2=0u;
+si3=l6;
+si4=8u;
+si3+=si4;
+si4=7u;
+si3&=si4;
+si1=si3 ? si1 : si2;
+l0=si1;
+si0+=si1;
+l8=si0;
+si1=l2;
+si2=-40u;
+si1+=si2;
+l9=si1;
+si2=l0;
+si1-=si2;
+l0=si1;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l6;
+si1=l9;
+si0+=si1;
+si1=40u;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l4;
+si1=l5;
+si2=39u;
+si3=l5;
+si2-=si3;
+si3=7u;
+si2&=si3;
+si3=0u;
+si4=l5;
+si5=-39u;
+si4+=si5;
+si5=7u;
+si4&=si5;
+si2=si4 ? si2 : si3;
+si1+=si2;
+si2=-47u;
+si1+=si2;
+l9=si1;
+si2=l9;
+si3=l4;
+si4=16u;
+si3+=si4;
+si2=si2 < si3;
+si0=si2 ? si0 : si1;
+l9=si0;
+si1=27u;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1512u);
+i32_store(&m0,(U64)(si0)+1052u,si1);
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1036u,si1);
+si0=0u;
+si1=l8;
+i32_store(&m0,(U64)(si0)+1048u,si1);
+si0=l9;
+si1=16u;
+si0+=si1;
+si1=0u;
+sj1=i64_load(&m0,(U64)(si1)+1480u);
+i64_store(&m0,(U64)(si0),sj1);
+si0=l9;
+si1=0u;
+sj1=i64_load(&m0,(U64)(si1)+1472u);
+i64_store(&m0,(U64)(si0)+8u,sj1);
+si0=0u;
+si1=l2;
+i32_store(&m0,(U64)(si0)+1476u,si1);
+si0=0u;
+si1=l6;
+i32_store(&m0,(U64)(si0)+1472u,si1);
+si0=0u;
+si1=l9;
+si2=8u;
+si1+=si2;
+i32_store(&m0,(U64)(si0)+1480u,si1);
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1484u,si1);
+si0=l9;
+si1=28u;
+si0+=si1;
+l0=si0;
+L105:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si1=7u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=4u;
+si0+=si1;
+l0=si0;
+si1=l5;
+si0=si0 < si1;
+if (si0) {
+goto L105;
+}
+}
+si0=l9;
+si1=l4;
+si0=si0 == si1;
+if (si0) {
+goto L84;
+}
+si0=l9;
+si1=4u;
+si0+=si1;
+l0=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1));
+si2=-2u;
+si1&=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l9;
+si1=l9;
+si2=l4;
+si1-=si2;
+l2=si1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=l2;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l2;
+si1=255u;
+si0=si0 > si1;
+if (si0) {
+goto L106;
+}
+si0=l2;
+si1=3u;
+si0 >>= (si1 & 31);
+l5=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+si1=1064u;
+si0+=si1;
+l0=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1024u);
+l6=si0;
+si1=1u;
+si2=l5;
+si1 <<= (si2 & 31);
+l5=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L97;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l5=si0;
+goto L96;
+L106:;
+si0=0u;
+l0=si0;
+si0=l2;
+si1=8u;
+si0 >>= (si1 & 31);
+l5=si0;
+si0=!(si0);
+if (si0) {
+goto L107;
+}
+si0=31u;
+l0=si0;
+si0=l2;
+si1=16777215u;
+si0=si0 > si1;
+if (si0) {
+goto L107;
+}
+si0=l2;
+si1=14u;
+si2=l5;
+si3=l5;
+si4=1048320u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=8u;
+si3&=si4;
+l0=si3;
+si2 <<= (si3 & 31);
+l5=si2;
+si3=520192u;
+si2+=si3;
+si3=16u;
+si2 >>= (si3 & 31);
+si3=4u;
+si2&=si3;
+l6=si2;
+si3=l0;
+si2|=si3;
+si3=l5;
+si4=l6;
+si3 <<= (si4 & 31);
+l0=si3;
+si4=245760u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=2u;
+si3&=si4;
+l5=si3;
+si2|=si3;
+si1-=si2;
+si2=l0;
+si3=l5;
+si2 <<= (si3 & 31);
+si3=15u;
+si2 >>= (si3 & 31);
+si1+=si2;
+l0=si1;
+si2=7u;
+si1+=si2;
+si0 >>= (si1 & 31);
+si1=1u;
+si0&=si1;
+si1=l0;
+si2=1u;
+si1 <<= (si2 & 31);
+si0|=si1;
+l0=si0;
+L107:;
+si0=l4;
+sj1=0ull;
+i64_store(&m0,(U64)(si0)+16u,sj1);
+si0=l4;
+si1=28u;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+l5=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1028u);
+l6=si0;
+si1=1u;
+si2=l0;
+si1 <<= (si2 & 31);
+l9=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L95;
+}
+si0=l2;
+si1=0u;
+si2=25u;
+si3=l0;
+si4=1u;
+si3 >>= (si4 & 31);
+si2-=si3;
+si3=l0;
+si4=31u;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0 <<= (si1 & 31);
+l0=si0;
+si0=l5;
+si0=i32_load(&m0,(U64)(si0));
+l6=si0;
+L108:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l6;
+l5=si0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l2;
+si0=si0 == si1;
+if (si0) {
+goto L93;
+}
+si0=l0;
+si1=29u;
+si0 >>= (si1 & 31);
+l6=si0;
+si0=l0;
+si1=1u;
+si0 <<= (si1 & 31);
+l0=si0;
+si0=l5;
+si1=l6;
+si2=4u;
+si1&=si2;
+si0+=si1;
+si1=16u;
+si0+=si1;
+l9=si0;
+si0=i32_load(&m0,(U64)(si0));
+l6=si0;
+if (si0) {
+goto L108;
+}
+}
+si0=l9;
+si1=l4;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=24u;
+si0+=si1;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+goto L94;
+L98:;
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1048u,si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1036u);
+si2=l0;
+si1+=si2;
+l0=si1;
+i32_store(&m0,(U64)(si0)+1036u,si1);
+si0=l5;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L4;
+L97:;
+si0=0u;
+si1=l6;
+si2=l5;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+si0=l0;
+l5=si0;
+L96:;
+si0=l5;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l0;
+si1=l4;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l4;
+si1=l0;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l4;
+si1=l5;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L84;
+L95:;
+si0=l5;
+si1=l4;
+i32_store(&m0,(U64)(si0),si1);
+si0=0u;
+si1=l6;
+si2=l9;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+si0=l4;
+si1=24u;
+si0+=si1;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+L94:;
+si0=l4;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l4;
+si1=l4;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L84;
+L93:;
+si0=l5;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l5;
+si1=l4;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l4;
+si1=24u;
+si0+=si1;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=l5;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l4;
+si1=l0;
+i32_store(&m0,(U64)(si0)+8u,si1);
+L84:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1036u);
+l0=si0;
+si1=l3;
+si0=si0 <= si1;
+if (si0) {
+goto L12;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1048u);
+l4=si0;
+si1=l3;
+si0+=si1;
+l5=si0;
+si1=l0;
+si2=l3;
+si1-=si2;
+l0=si1;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1036u,si1);
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1048u,si1);
+si0=l4;
+si1=l3;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l4;
+si1=8u;
+si0+=si1;
+l0=si0;
+goto L1;
+L12:;
+si0=0u;
+l0=si0;
+si0=0u;
+si1=48u;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+goto L1;
+L11:;
+si0=0u;
+si1=l5;
+i32_store(&m0,(U64)(si0)+1044u,si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1032u);
+si2=l0;
+si1+=si2;
+l0=si1;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+si0=l5;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l5;
+si1=l0;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+goto L4;
+L10:;
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+24u);
+l10=si0;
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l9=si0;
+si1=l6;
+si0=si0 == si1;
+if (si0) {
+goto L8;
+}
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l4=si0;
+si1=l9;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l9;
+si1=l4;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l10;
+if (si0) {
+goto L7;
+}
+goto L6;
+L9:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1024u);
+si2=-2u;
+si3=l4;
+si4=3u;
+si3 >>= (si4 & 31);
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+goto L6;
+L8:;
+si0=l6;
+si1=20u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+l3=si0;
+if (si0) {
+goto L110;
+}
+si0=l6;
+si1=16u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+l3=si0;
+si0=!(si0);
+if (si0) {
+goto L109;
+}
+L110:;
+L111:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l4;
+l8=si0;
+si0=l3;
+l9=si0;
+si1=20u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+l3=si0;
+if (si0) {
+goto L111;
+}
+si0=l9;
+si1=16u;
+si0+=si1;
+l4=si0;
+si0=l9;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l3=si0;
+if (si0) {
+goto L111;
+}
+}
+si0=l8;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l10;
+si0=!(si0);
+if (si0) {
+goto L6;
+}
+goto L7;
+L109:;
+si0=0u;
+l9=si0;
+si0=l10;
+si0=!(si0);
+if (si0) {
+goto L6;
+}
+L7:;
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+28u);
+l3=si0;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0));
+si1=l6;
+si0=si0 == si1;
+if (si0) {
+goto L114;
+}
+si0=l10;
+si1=16u;
+si2=20u;
+si3=l10;
+si3=i32_load(&m0,(U64)(si3)+16u);
+si4=l6;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0+=si1;
+si1=l9;
+i32_store(&m0,(U64)(si0),si1);
+si0=l9;
+if (si0) {
+goto L113;
+}
+goto L6;
+L114:;
+si0=l4;
+si1=l9;
+i32_store(&m0,(U64)(si0),si1);
+si0=l9;
+si0=!(si0);
+if (si0) {
+goto L112;
+}
+L113:;
+si0=l9;
+si1=l10;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l6;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L115;
+}
+si0=l9;
+si1=l4;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=l4;
+si1=l9;
+i32_store(&m0,(U64)(si0)+24u,si1);
+L115:;
+si0=l6;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L6;
+}
+si0=l9;
+si1=20u;
+si0+=si1;
+si1=l4;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=l9;
+i32_store(&m0,(U64)(si0)+24u,si1);
+goto L6;
+L112:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1028u);
+si2=-2u;
+si3=l3;
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+L6:;
+si0=l7;
+si1=l0;
+si0+=si1;
+l0=si0;
+si0=l6;
+si1=l7;
+si0+=si1;
+l6=si0;
+L5:;
+si0=l6;
+si1=l6;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=-2u;
+si1&=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l5;
+si1=l0;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l0;
+si1=255u;
+si0=si0 > si1;
+if (si0) {
+goto L121;
+}
+si0=l0;
+si1=3u;
+si0 >>= (si1 & 31);
+l4=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+si1=1064u;
+si0+=si1;
+l0=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1024u);
+l3=si0;
+si1=1u;
+si2=l4;
+si1 <<= (si2 & 31);
+l4=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L120;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l4=si0;
+goto L119;
+L121:;
+si0=0u;
+l4=si0;
+si0=l0;
+si1=8u;
+si0 >>= (si1 & 31);
+l3=si0;
+si0=!(si0);
+if (si0) {
+goto L122;
+}
+si0=31u;
+l4=si0;
+si0=l0;
+si1=16777215u;
+si0=si0 > si1;
+if (si0) {
+goto L122;
+}
+si0=l0;
+si1=14u;
+si2=l3;
+si3=l3;
+si4=1048320u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=8u;
+si3&=si4;
+l4=si3;
+si2 <<= (si3 & 31);
+l3=si2;
+si3=520192u;
+si2+=si3;
+si3=16u;
+si2 >>= (si3 & 31);
+si3=4u;
+si2&=si3;
+l6=si2;
+si3=l4;
+si2|=si3;
+si3=l3;
+si4=l6;
+si3 <<= (si4 & 31);
+l4=si3;
+si4=245760u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=2u;
+si3&=si4;
+l3=si3;
+si2|=si3;
+si1-=si2;
+si2=l4;
+si3=l3;
+si2 <<= (si3 & 31);
+si3=15u;
+si2 >>= (si3 & 31);
+si1+=si2;
+l4=si1;
+si2=7u;
+si1+=si2;
+si0 >>= (si1 & 31);
+si1=1u;
+si0&=si1;
+si1=l4;
+si2=1u;
+si1 <<= (si2 & 31);
+si0|=si1;
+l4=si0;
+L122:;
+si0=l5;
+si1=l4;
+i32_store(&m0,(U64)(si0)+28u,si1);
+si0=l5;
+sj1=0ull;
+i64_store(&m0,(U64)(si0)+16u,sj1);
+si0=l4;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+l3=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1028u);
+l6=si0;
+si1=1u;
+si2=l4;
+si1 <<= (si2 & 31);
+l9=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L118;
+}
+si0=l0;
+si1=0u;
+si2=25u;
+si3=l4;
+si4=1u;
+si3 >>= (si4 & 31);
+si2-=si3;
+si3=l4;
+si4=31u;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0 <<= (si1 & 31);
+l4=si0;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0));
+l6=si0;
+L123:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l6;
+l3=si0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l0;
+si0=si0 == si1;
+if (si0) {
+goto L116;
+}
+si0=l4;
+si1=29u;
+si0 >>= (si1 & 31);
+l6=si0;
+si0=l4;
+si1=1u;
+si0 <<= (si1 & 31);
+l4=si0;
+si0=l3;
+si1=l6;
+si2=4u;
+si1&=si2;
+si0+=si1;
+si1=16u;
+si0+=si1;
+l9=si0;
+si0=i32_load(&m0,(U64)(si0));
+l6=si0;
+if (si0) {
+goto L123;
+}
+}
+si0=l9;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+si1=l3;
+i32_store(&m0,(U64)(si0)+24u,si1);
+goto L117;
+L120:;
+si0=0u;
+si1=l3;
+si2=l4;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+si0=l0;
+l4=si0;
+L119:;
+si0=l4;
+si1=l5;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l0;
+si1=l5;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l5;
+si1=l0;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l5;
+si1=l4;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L4;
+L118:;
+si0=l3;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=0u;
+si1=l6;
+si2=l9;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+si0=l5;
+si1=l3;
+i32_store(&m0,(U64)(si0)+24u,si1);
+L117:;
+si0=l5;
+si1=l5;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l5;
+si1=l5;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L4;
+L116:;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+si1=l5;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l3;
+si1=l5;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l5;
+si1=0u;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l5;
+si1=l3;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l5;
+si1=l0;
+i32_store(&m0,(U64)(si0)+8u,si1);
+L4:;
+si0=l2;
+si1=8u;
+si0+=si1;
+l0=si0;
+goto L1;
+L3:;
+si0=l9;
+si1=l9;
+si1=i32_load(&m0,(U64)(si1)+28u);
+l4=si1;
+si2=2u;
+si1 <<= (si2 & 31);
+si2=1328u;
+si1+=si2;
+l0=si1;
+si1=i32_load(&m0,(U64)(si1));
+si0=si0 == si1;
+if (si0) {
+goto L126;
+}
+si0=l10;
+si1=16u;
+si2=20u;
+si3=l10;
+si3=i32_load(&m0,(U64)(si3)+16u);
+si4=l9;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0+=si1;
+si1=l6;
+i32_store(&m0,(U64)(si0),si1);
+si0=l6;
+if (si0) {
+goto L125;
+}
+goto L2;
+L126:;
+si0=l0;
+si1=l6;
+i32_store(&m0,(U64)(si0),si1);
+si0=l6;
+si0=!(si0);
+if (si0) {
+goto L124;
+}
+L125:;
+si0=l6;
+si1=l10;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l9;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L127;
+}
+si0=l6;
+si1=l0;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=l0;
+si1=l6;
+i32_store(&m0,(U64)(si0)+24u,si1);
+L127:;
+si0=l9;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l6;
+si1=20u;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=l6;
+i32_store(&m0,(U64)(si0)+24u,si1);
+goto L2;
+L124:;
+si0=0u;
+si1=l7;
+si2=-2u;
+si3=l4;
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+l7=si1;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+L2:;
+si0=l5;
+si1=15u;
+si0=si0 > si1;
+if (si0) {
+goto L129;
+}
+si0=l9;
+si1=l5;
+si2=l3;
+si1+=si2;
+l0=si1;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l9;
+si1=l0;
+si0+=si1;
+l0=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L128;
+L129:;
+si0=l8;
+si1=l5;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l9;
+si1=l3;
+si2=3u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l8;
+si1=l5;
+si0+=si1;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+si1=255u;
+si0=si0 > si1;
+if (si0) {
+goto L134;
+}
+si0=l5;
+si1=3u;
+si0 >>= (si1 & 31);
+l4=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+si1=1064u;
+si0+=si1;
+l0=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1024u);
+l5=si0;
+si1=1u;
+si2=l4;
+si1 <<= (si2 & 31);
+l4=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L133;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l4=si0;
+goto L132;
+L134:;
+si0=l5;
+si1=8u;
+si0 >>= (si1 & 31);
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L131;
+}
+si0=31u;
+l0=si0;
+si0=l5;
+si1=16777215u;
+si0=si0 > si1;
+if (si0) {
+goto L130;
+}
+si0=l5;
+si1=14u;
+si2=l4;
+si3=l4;
+si4=1048320u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=8u;
+si3&=si4;
+l0=si3;
+si2 <<= (si3 & 31);
+l4=si2;
+si3=520192u;
+si2+=si3;
+si3=16u;
+si2 >>= (si3 & 31);
+si3=4u;
+si2&=si3;
+l3=si2;
+si3=l0;
+si2|=si3;
+si3=l4;
+si4=l3;
+si3 <<= (si4 & 31);
+l0=si3;
+si4=245760u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=2u;
+si3&=si4;
+l4=si3;
+si2|=si3;
+si1-=si2;
+si2=l0;
+si3=l4;
+si2 <<= (si3 & 31);
+si3=15u;
+si2 >>= (si3 & 31);
+si1+=si2;
+l0=si1;
+si2=7u;
+si1+=si2;
+si0 >>= (si1 & 31);
+si1=1u;
+si0&=si1;
+si1=l0;
+si2=1u;
+si1 <<= (si2 & 31);
+si0|=si1;
+l0=si0;
+goto L130;
+L133:;
+si0=0u;
+si1=l5;
+si2=l4;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+si0=l0;
+l4=si0;
+L132:;
+si0=l4;
+si1=l8;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l0;
+si1=l8;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l8;
+si1=l0;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l8;
+si1=l4;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L128;
+L131:;
+si0=0u;
+l0=si0;
+L130:;
+si0=l8;
+si1=l0;
+i32_store(&m0,(U64)(si0)+28u,si1);
+si0=l8;
+sj1=0ull;
+i64_store(&m0,(U64)(si0)+16u,sj1);
+si0=l0;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+l4=si0;
+si0=l7;
+si1=1u;
+si2=l0;
+si1 <<= (si2 & 31);
+l3=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L137;
+}
+si0=l5;
+si1=0u;
+si2=25u;
+si3=l0;
+si4=1u;
+si3 >>= (si4 & 31);
+si2-=si3;
+si3=l0;
+si4=31u;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0 <<= (si1 & 31);
+l0=si0;
+si0=l4;
+si0=i32_load(&m0,(U64)(si0));
+l3=si0;
+L138:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l3;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l5;
+si0=si0 == si1;
+if (si0) {
+goto L135;
+}
+si0=l0;
+si1=29u;
+si0 >>= (si1 & 31);
+l3=si0;
+si0=l0;
+si1=1u;
+si0 <<= (si1 & 31);
+l0=si0;
+si0=l4;
+si1=l3;
+si2=4u;
+si1&=si2;
+si0+=si1;
+si1=16u;
+si0+=si1;
+l6=si0;
+si0=i32_load(&m0,(U64)(si0));
+l3=si0;
+if (si0) {
+goto L138;
+}
+}
+si0=l6;
+si1=l8;
+i32_store(&m0,(U64)(si0),si1);
+si0=l8;
+si1=l4;
+i32_store(&m0,(U64)(si0)+24u,si1);
+goto L136;
+L137:;
+si0=l4;
+si1=l8;
+i32_store(&m0,(U64)(si0),si1);
+si0=0u;
+si1=l7;
+si2=l3;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+si0=l8;
+si1=l4;
+i32_store(&m0,(U64)(si0)+24u,si1);
+L136:;
+si0=l8;
+si1=l8;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l8;
+si1=l8;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L128;
+L135:;
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+si1=l8;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l4;
+si1=l8;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l8;
+si1=0u;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l8;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l8;
+si1=l0;
+i32_store(&m0,(U64)(si0)+8u,si1);
+L128:;
+si0=l9;
+si1=8u;
+si0+=si1;
+l0=si0;
+L1:;
+si0=l1;
+si1=16u;
+si0+=si1;
+g0=si0;
+si0=l0;
+L0:;
+return si0;
+}
+
+void f15(U32 l0) {
+U32 si0;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+f16(si0);
+L0:;
+}
+
+void f16(U32 l0) {
+U32 l1=0;
+U32 l2=0;
+U32 l3=0;
+U32 l4=0;
+U32 l5=0;
+U32 l6=0;
+U32 l7=0;
+U32 si0,si1,si2,si3,si4;
+U64 sj1;
+si0=l0;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l0;
+si1=-8u;
+si0+=si1;
+l1=si0;
+si1=l0;
+si2=-4u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l2=si1;
+si2=-8u;
+si1&=si2;
+l0=si1;
+si0+=si1;
+l3=si0;
+si0=l2;
+si1=1u;
+si0&=si1;
+if (si0) {
+goto L4;
+}
+si0=l2;
+si1=3u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l1;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1));
+l2=si1;
+si0-=si1;
+l1=si0;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1040u);
+si0=si0 < si1;
+if (si0) {
+goto L2;
+}
+si0=l2;
+si1=l0;
+si0+=si1;
+l0=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1044u);
+si1=l1;
+si0=si0 == si1;
+if (si0) {
+goto L9;
+}
+si0=l2;
+si1=255u;
+si0=si0 > si1;
+if (si0) {
+goto L8;
+}
+si0=l1;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l4=si0;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l5=si1;
+si0=si0 == si1;
+if (si0) {
+goto L7;
+}
+si0=l4;
+si1=l5;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l5;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l1;
+si1=l3;
+si0=si0 < si1;
+if (si0) {
+goto L3;
+}
+goto L2;
+L9:;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l2=si0;
+si1=3u;
+si0&=si1;
+si1=3u;
+si0=si0 != si1;
+if (si0) {
+goto L4;
+}
+si0=l3;
+si1=4u;
+si0+=si1;
+si1=l2;
+si2=-2u;
+si1&=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+si0=l1;
+si1=l0;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L0;
+L8:;
+si0=l1;
+si0=i32_load(&m0,(U64)(si0)+24u);
+l6=si0;
+si0=l1;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l5=si0;
+si1=l1;
+si0=si0 == si1;
+if (si0) {
+goto L6;
+}
+si0=l1;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l2=si0;
+si1=l5;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l5;
+si1=l2;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l6;
+if (si0) {
+goto L5;
+}
+goto L4;
+L7:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1024u);
+si2=-2u;
+si3=l2;
+si4=3u;
+si3 >>= (si4 & 31);
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+si0=l1;
+si1=l3;
+si0=si0 < si1;
+if (si0) {
+goto L3;
+}
+goto L2;
+L6:;
+si0=l1;
+si1=20u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+if (si0) {
+goto L11;
+}
+si0=l1;
+si1=16u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L10;
+}
+L11:;
+L12:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l2;
+l7=si0;
+si0=l4;
+l5=si0;
+si1=20u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+if (si0) {
+goto L12;
+}
+si0=l5;
+si1=16u;
+si0+=si1;
+l2=si0;
+si0=l5;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l4=si0;
+if (si0) {
+goto L12;
+}
+}
+si0=l7;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l6;
+si0=!(si0);
+if (si0) {
+goto L4;
+}
+goto L5;
+L10:;
+si0=0u;
+l5=si0;
+si0=l6;
+si0=!(si0);
+if (si0) {
+goto L4;
+}
+L5:;
+si0=l1;
+si0=i32_load(&m0,(U64)(si0)+28u);
+l4=si0;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+si1=l1;
+si0=si0 == si1;
+if (si0) {
+goto L15;
+}
+si0=l6;
+si1=16u;
+si2=20u;
+si3=l6;
+si3=i32_load(&m0,(U64)(si3)+16u);
+si4=l1;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0+=si1;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+if (si0) {
+goto L14;
+}
+goto L4;
+L15:;
+si0=l2;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+si0=!(si0);
+if (si0) {
+goto L13;
+}
+L14:;
+si0=l5;
+si1=l6;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l1;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L16;
+}
+si0=l5;
+si1=l2;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=l2;
+si1=l5;
+i32_store(&m0,(U64)(si0)+24u,si1);
+L16:;
+si0=l1;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L4;
+}
+si0=l5;
+si1=20u;
+si0+=si1;
+si1=l2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=l5;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l1;
+si1=l3;
+si0=si0 < si1;
+if (si0) {
+goto L3;
+}
+goto L2;
+L13:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1028u);
+si2=-2u;
+si3=l4;
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+L4:;
+si0=l1;
+si1=l3;
+si0=si0 >= si1;
+if (si0) {
+goto L2;
+}
+L3:;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l2=si0;
+si1=1u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l2;
+si1=2u;
+si0&=si1;
+if (si0) {
+goto L25;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1048u);
+si1=l3;
+si0=si0 == si1;
+if (si0) {
+goto L24;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1044u);
+si1=l3;
+si0=si0 == si1;
+if (si0) {
+goto L23;
+}
+si0=l2;
+si1=-8u;
+si0&=si1;
+si1=l0;
+si0+=si1;
+l0=si0;
+si0=l2;
+si1=255u;
+si0=si0 > si1;
+if (si0) {
+goto L22;
+}
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l4=si0;
+si1=l3;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l5=si1;
+si0=si0 == si1;
+if (si0) {
+goto L21;
+}
+si0=l4;
+si1=l5;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l5;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+goto L18;
+L25:;
+si0=l3;
+si1=4u;
+si0+=si1;
+si1=l2;
+si2=-2u;
+si1&=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=l0;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+goto L17;
+L24:;
+si0=0u;
+si1=l1;
+i32_store(&m0,(U64)(si0)+1048u,si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1036u);
+si2=l0;
+si1+=si2;
+l0=si1;
+i32_store(&m0,(U64)(si0)+1036u,si1);
+si0=l1;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l1;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1044u);
+si0=si0 != si1;
+if (si0) {
+goto L2;
+}
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1044u,si1);
+goto L0;
+L23:;
+si0=0u;
+si1=l1;
+i32_store(&m0,(U64)(si0)+1044u,si1);
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1032u);
+si2=l0;
+si1+=si2;
+l0=si1;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+si0=l1;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l1;
+si1=l0;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+goto L0;
+L22:;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+24u);
+l6=si0;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l5=si0;
+si1=l3;
+si0=si0 == si1;
+if (si0) {
+goto L20;
+}
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l2=si0;
+si1=l5;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l5;
+si1=l2;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l6;
+if (si0) {
+goto L19;
+}
+goto L18;
+L21:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1024u);
+si2=-2u;
+si3=l2;
+si4=3u;
+si3 >>= (si4 & 31);
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+goto L18;
+L20:;
+si0=l3;
+si1=20u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+if (si0) {
+goto L27;
+}
+si0=l3;
+si1=16u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L26;
+}
+L27:;
+L28:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l2;
+l7=si0;
+si0=l4;
+l5=si0;
+si1=20u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+if (si0) {
+goto L28;
+}
+si0=l5;
+si1=16u;
+si0+=si1;
+l2=si0;
+si0=l5;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l4=si0;
+if (si0) {
+goto L28;
+}
+}
+si0=l7;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l6;
+si0=!(si0);
+if (si0) {
+goto L18;
+}
+goto L19;
+L26:;
+si0=0u;
+l5=si0;
+si0=l6;
+si0=!(si0);
+if (si0) {
+goto L18;
+}
+L19:;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+28u);
+l4=si0;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+l2=si0;
+si0=i32_load(&m0,(U64)(si0));
+si1=l3;
+si0=si0 == si1;
+if (si0) {
+goto L31;
+}
+si0=l6;
+si1=16u;
+si2=20u;
+si3=l6;
+si3=i32_load(&m0,(U64)(si3)+16u);
+si4=l3;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0+=si1;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+if (si0) {
+goto L30;
+}
+goto L18;
+L31:;
+si0=l2;
+si1=l5;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+si0=!(si0);
+if (si0) {
+goto L29;
+}
+L30:;
+si0=l5;
+si1=l6;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L32;
+}
+si0=l5;
+si1=l2;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=l2;
+si1=l5;
+i32_store(&m0,(U64)(si0)+24u,si1);
+L32:;
+si0=l3;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L18;
+}
+si0=l5;
+si1=20u;
+si0+=si1;
+si1=l2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=l5;
+i32_store(&m0,(U64)(si0)+24u,si1);
+goto L18;
+L29:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1028u);
+si2=-2u;
+si3=l4;
+si2=I32_ROTL(si2,si3);
+si1&=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+L18:;
+si0=l1;
+si1=l0;
+si0+=si1;
+si1=l0;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=l0;
+si2=1u;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l1;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1044u);
+si0=si0 != si1;
+if (si0) {
+goto L17;
+}
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1032u,si1);
+goto L0;
+L17:;
+si0=l0;
+si1=255u;
+si0=si0 > si1;
+if (si0) {
+goto L39;
+}
+si0=l0;
+si1=3u;
+si0 >>= (si1 & 31);
+l2=si0;
+si1=3u;
+si0 <<= (si1 & 31);
+si1=1064u;
+si0+=si1;
+l0=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1024u);
+l4=si0;
+si1=1u;
+si2=l2;
+si1 <<= (si2 & 31);
+l2=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L38;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l2=si0;
+goto L37;
+L39:;
+si0=0u;
+l2=si0;
+si0=l0;
+si1=8u;
+si0 >>= (si1 & 31);
+l4=si0;
+si0=!(si0);
+if (si0) {
+goto L40;
+}
+si0=31u;
+l2=si0;
+si0=l0;
+si1=16777215u;
+si0=si0 > si1;
+if (si0) {
+goto L40;
+}
+si0=l0;
+si1=14u;
+si2=l4;
+si3=l4;
+si4=1048320u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=8u;
+si3&=si4;
+l2=si3;
+si2 <<= (si3 & 31);
+l4=si2;
+si3=520192u;
+si2+=si3;
+si3=16u;
+si2 >>= (si3 & 31);
+si3=4u;
+si2&=si3;
+l5=si2;
+si3=l2;
+si2|=si3;
+si3=l4;
+si4=l5;
+si3 <<= (si4 & 31);
+l2=si3;
+si4=245760u;
+si3+=si4;
+si4=16u;
+si3 >>= (si4 & 31);
+si4=2u;
+si3&=si4;
+l4=si3;
+si2|=si3;
+si1-=si2;
+si2=l2;
+si3=l4;
+si2 <<= (si3 & 31);
+si3=15u;
+si2 >>= (si3 & 31);
+si1+=si2;
+l2=si1;
+si2=7u;
+si1+=si2;
+si0 >>= (si1 & 31);
+si1=1u;
+si0&=si1;
+si1=l2;
+si2=1u;
+si1 <<= (si2 & 31);
+si0|=si1;
+l2=si0;
+L40:;
+si0=l1;
+sj1=0ull;
+i64_store(&m0,(U64)(si0)+16u,sj1);
+si0=l1;
+si1=28u;
+si0+=si1;
+si1=l2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=2u;
+si0 <<= (si1 & 31);
+si1=1328u;
+si0+=si1;
+l4=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1028u);
+l5=si0;
+si1=1u;
+si2=l2;
+si1 <<= (si2 & 31);
+l3=si1;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L36;
+}
+si0=l0;
+si1=0u;
+si2=25u;
+si3=l2;
+si4=1u;
+si3 >>= (si4 & 31);
+si2-=si3;
+si3=l2;
+si4=31u;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+si0 <<= (si1 & 31);
+l2=si0;
+si0=l4;
+si0=i32_load(&m0,(U64)(si0));
+l5=si0;
+L41:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l5;
+l4=si0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+si1=-8u;
+si0&=si1;
+si1=l0;
+si0=si0 == si1;
+if (si0) {
+goto L34;
+}
+si0=l2;
+si1=29u;
+si0 >>= (si1 & 31);
+l5=si0;
+si0=l2;
+si1=1u;
+si0 <<= (si1 & 31);
+l2=si0;
+si0=l4;
+si1=l5;
+si2=4u;
+si1&=si2;
+si0+=si1;
+si1=16u;
+si0+=si1;
+l3=si0;
+si0=i32_load(&m0,(U64)(si0));
+l5=si0;
+if (si0) {
+goto L41;
+}
+}
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=24u;
+si0+=si1;
+si1=l4;
+i32_store(&m0,(U64)(si0),si1);
+goto L35;
+L38:;
+si0=0u;
+si1=l4;
+si2=l2;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1024u,si1);
+si0=l0;
+l2=si0;
+L37:;
+si0=l2;
+si1=l1;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l0;
+si1=l1;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l1;
+si1=l0;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l1;
+si1=l2;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L0;
+L36:;
+si0=l4;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=0u;
+si1=l5;
+si2=l3;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+1028u,si1);
+si0=l1;
+si1=24u;
+si0+=si1;
+si1=l4;
+i32_store(&m0,(U64)(si0),si1);
+L35:;
+si0=l1;
+si1=l1;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l1;
+si1=l1;
+i32_store(&m0,(U64)(si0)+8u,si1);
+goto L33;
+L34:;
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+8u);
+l0=si0;
+si1=l1;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l4;
+si1=l1;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l1;
+si1=24u;
+si0+=si1;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=l4;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l1;
+si1=l0;
+i32_store(&m0,(U64)(si0)+8u,si1);
+L33:;
+si0=0u;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+1056u);
+si2=-1u;
+si1+=si2;
+l1=si1;
+i32_store(&m0,(U64)(si0)+1056u,si1);
+si0=l1;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+L2:;
+goto L0;
+L1:;
+si0=1480u;
+l1=si0;
+L42:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l1;
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+si1=8u;
+si0+=si1;
+l1=si0;
+si0=l0;
+if (si0) {
+goto L42;
+}
+}
+si0=0u;
+si1=-1u;
+i32_store(&m0,(U64)(si0)+1056u,si1);
+L0:;
+}
+
+U32 f17(U32 l0,U32 l1) {
+U32 l2=0;
+U32 si0,si1,si2,si3;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=!(si0);
+if (si0) {
+goto L3;
+}
+si0=l1;
+si1=l0;
+si0*=si1;
+l2=si0;
+si0=l1;
+si1=l0;
+si0|=si1;
+si1=65536u;
+si0=si0 < si1;
+if (si0) {
+goto L4;
+}
+si0=l2;
+si1=-1u;
+si2=l2;
+si3=l0;
+si2=DIV_U(si2,si3);
+si3=l1;
+si2=si2 == si3;
+si0=si2 ? si0 : si1;
+l2=si0;
+L4:;
+si0=l2;
+si0=f14(si0);
+l0=si0;
+if (si0) {
+goto L2;
+}
+goto L1;
+L3:;
+si0=0u;
+l2=si0;
+si0=0u;
+si0=f14(si0);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+L2:;
+si0=l0;
+si1=-4u;
+si0+=si1;
+si0=i32_load8_u(&m0,(U64)(si0));
+si1=3u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=0u;
+si2=l2;
+si0=f28(si0,si1,si2);
+L1:;
+si0=l0;
+L0:;
+return si0;
+}
+
+void f18(U32 l0) {
+U32 si0;
+si0=l0;
+(*f_wasiX5Funstable_procX5Fexit)(si0);
+UNREACHABLE;
+L0:;
+}
+
+U32 f19(U32 l0) {
+U32 si0,si1;
+si0=l0;
+si0=(*f_wasiX5Funstable_fdX5Fclose)(si0);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+si0=-1u;
+goto L0;
+L1:;
+si0=0u;
+L0:;
+return si0;
+}
+
+void f20(U32 l0) {
+U32 l1=0;
+U32 l2=0;
+U32 si0,si1;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+si1=0u;
+si0 = (U32)((I32)si0 <= (I32)si1);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l1=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l2=si1;
+si0=si0 > si1;
+if (si0) {
+goto L1;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l0=si0;
+si0=l2;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l0;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+L2:;
+si0=l1;
+si0=!(si0);
+if (si0) {
+goto L3;
+}
+si0=0u;
+l2=si0;
+L4:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=4u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+si1=-1u;
+si0 = (U32)((I32)si0 <= (I32)si1);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=24u;
+si0+=si1;
+l0=si0;
+si0=l2;
+si1=1u;
+si0+=si1;
+l2=si0;
+si1=l1;
+si0=si0 < si1;
+if (si0) {
+goto L4;
+}
+}
+L3:;
+goto L0;
+L1:;
+f23();
+UNREACHABLE;
+L0:;
+}
+
+void f21() {
+U32 l0=0;
+U32 l1=0;
+U32 si0,si1,si2;
+U64 sj1;
+WASM_INTERRUPT_CHECK();
+si0=16u;
+si0=f13(si0);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=24u;
+si2=4u;
+si1=f17(si1,si2);
+l1=si1;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l1;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l0;
+sj1=4ull;
+i64_store(&m0,(U64)(si0)+8u,sj1);
+si0=l0;
+si1=1u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+f20(si0);
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1524u,si1);
+si0=l0;
+f20(si0);
+goto L0;
+L2:;
+si0=l0;
+f15(si0);
+L1:;
+si0=0u;
+si1=0u;
+i32_store(&m0,(U64)(si0)+1524u,si1);
+UNREACHABLE;
+L0:;
+}
+
+U32 f22(U32 l0,U32 l1) {
+U32 l2=0;
+U32 l3=0;
+U32 l4=0;
+U32 l5=0;
+U32 l6=0;
+U32 l7=0;
+U32 si0,si1,si2,si3;
+U64 sj1;
+WASM_INTERRUPT_CHECK();
+si0=g0;
+si1=32u;
+si0-=si1;
+l2=si0;
+g0=si0;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1524u);
+f20(si0);
+si0=-1u;
+l3=si0;
+si0=l1;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+1524u);
+l4=si0;
+f20(si0);
+si0=l0;
+si1=0u;
+si0 = (U32)((I32)si0 < (I32)si1);
+if (si0) {
+goto L1;
+}
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l5=si0;
+si1=l4;
+si1=i32_load(&m0,(U64)(si1)+8u);
+si0=si0 != si1;
+if (si0) {
+goto L3;
+}
+si0=24u;
+si1=l5;
+si2=1u;
+si1 <<= (si2 & 31);
+si0=f17(si0,si1);
+l6=si0;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l6;
+si1=l4;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=l4;
+si3=12u;
+si2+=si3;
+l5=si2;
+si2=i32_load(&m0,(U64)(si2));
+si3=24u;
+si2*=si3;
+si0=f27(si0,si1,si2);
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+4u);
+f15(si0);
+si0=l4;
+si1=l6;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l4;
+si1=8u;
+si0+=si1;
+l7=si0;
+si1=l7;
+si1=i32_load(&m0,(U64)(si1));
+si2=1u;
+si1 <<= (si2 & 31);
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+si0=i32_load(&m0,(U64)(si0));
+l5=si0;
+goto L2;
+L3:;
+si0=l4;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l6=si0;
+L2:;
+si0=l4;
+si1=12u;
+si0+=si1;
+si1=l5;
+si2=1u;
+si1+=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si0=f29(si0);
+l7=si0;
+si0=l6;
+si1=l5;
+si2=24u;
+si1*=si2;
+si0+=si1;
+l1=si0;
+si1=l0;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l1;
+si1=l7;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=l2;
+si2=8u;
+si1+=si2;
+si0=(*f_wasiX5Funstable_fdX5FfdstatX5Fget)(si0,si1);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L4;
+}
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+goto L1;
+L4:;
+si0=l1;
+si1=l2;
+sj1=i64_load(&m0,(U64)(si1)+16u);
+i64_store(&m0,(U64)(si0)+8u,sj1);
+si0=l1;
+si1=l2;
+sj1=i64_load(&m0,(U64)(si1)+24u);
+i64_store(&m0,(U64)(si0)+16u,sj1);
+si0=l4;
+f20(si0);
+si0=l4;
+f20(si0);
+si0=0u;
+l3=si0;
+si0=0u;
+si1=l4;
+i32_store(&m0,(U64)(si0)+1524u,si1);
+L1:;
+si0=l2;
+si1=32u;
+si0+=si1;
+g0=si0;
+si0=l3;
+L0:;
+return si0;
+}
+
+void f23() {
+UNREACHABLE;
+L0:;
+}
+
+U32 f24(U32 l0) {
+U32 si0,si1;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si1=65535u;
+si0&=si1;
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=-1u;
+si0 = (U32)((I32)si0 <= (I32)si1);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=16u;
+si0 >>= (si1 & 31);
+si0=wasmGrowMemory(&m0,si0);
+l0=si0;
+si1=-1u;
+si0=si0 == si1;
+if (si0) {
+goto L2;
+}
+si0=l0;
+si1=16u;
+si0 <<= (si1 & 31);
+goto L0;
+L2:;
+si0=0u;
+si1=48u;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+si0=-1u;
+goto L0;
+L1:;
+f23();
+UNREACHABLE;
+L0:;
+return si0;
+}
+
+void f25() {
+L0:;
+}
+
+void f26() {
+WASM_INTERRUPT_CHECK();
+f25();
+f39();
+L0:;
+}
+
+U32 f27(U32 l0,U32 l1,U32 l2) {
+U32 l3=0;
+U32 l4=0;
+U32 l5=0;
+U32 l6=0;
+U32 l7=0;
+U32 l8=0;
+U32 l9=0;
+U32 l10=0;
+U32 si0,si1,si2,si3;
+U64 sj1;
+si0=l2;
+si0=!(si0);
+if (si0) {
+goto L4;
+}
+si0=l1;
+si1=3u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L4;
+}
+si0=l0;
+l3=si0;
+L6:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1));
+i32_store8(&m0,(U64)(si0),si1);
+si0=l2;
+si1=-1u;
+si0+=si1;
+l4=si0;
+si0=l3;
+si1=1u;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=1u;
+si0+=si1;
+l1=si0;
+si0=l2;
+si1=1u;
+si0=si0 == si1;
+if (si0) {
+goto L5;
+}
+si0=l4;
+l2=si0;
+si0=l1;
+si1=3u;
+si0&=si1;
+if (si0) {
+goto L6;
+}
+}
+L5:;
+si0=l3;
+si1=3u;
+si0&=si1;
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L3;
+}
+goto L2;
+L4:;
+si0=l2;
+l4=si0;
+si0=l0;
+l3=si0;
+si1=3u;
+si0&=si1;
+l2=si0;
+if (si0) {
+goto L2;
+}
+L3:;
+si0=l4;
+si1=16u;
+si0=si0 < si1;
+if (si0) {
+goto L8;
+}
+si0=l4;
+si1=-16u;
+si0+=si1;
+l2=si0;
+L9:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l3;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1));
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=4u;
+si0+=si1;
+si1=l1;
+si2=4u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=8u;
+si0+=si1;
+si1=l1;
+si2=8u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=12u;
+si0+=si1;
+si1=l1;
+si2=12u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=16u;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=16u;
+si0+=si1;
+l1=si0;
+si0=l4;
+si1=-16u;
+si0+=si1;
+l4=si0;
+si1=15u;
+si0=si0 > si1;
+if (si0) {
+goto L9;
+}
+goto L7;
+}
+L8:;
+si0=l4;
+l2=si0;
+L7:;
+si0=l2;
+si1=8u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L10;
+}
+si0=l3;
+si1=l1;
+sj1=i64_load(&m0,(U64)(si1));
+i64_store(&m0,(U64)(si0),sj1);
+si0=l1;
+si1=8u;
+si0+=si1;
+l1=si0;
+si0=l3;
+si1=8u;
+si0+=si1;
+l3=si0;
+L10:;
+si0=l2;
+si1=4u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L11;
+}
+si0=l3;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1));
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=4u;
+si0+=si1;
+l1=si0;
+si0=l3;
+si1=4u;
+si0+=si1;
+l3=si0;
+L11:;
+si0=l2;
+si1=2u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L12;
+}
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1));
+i32_store8(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+1u);
+i32_store8(&m0,(U64)(si0)+1u,si1);
+si0=l3;
+si1=2u;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=2u;
+si0+=si1;
+l1=si0;
+L12:;
+si0=l2;
+si1=1u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1));
+i32_store8(&m0,(U64)(si0),si1);
+si0=l0;
+goto L0;
+L2:;
+si0=l4;
+si1=32u;
+si0=si0 < si1;
+if (si0) {
+goto L13;
+}
+si0=l2;
+si1=3u;
+si0=si0 == si1;
+if (si0) {
+goto L15;
+}
+si0=l2;
+si1=2u;
+si0=si0 == si1;
+if (si0) {
+goto L14;
+}
+si0=l2;
+si1=1u;
+si0=si0 != si1;
+if (si0) {
+goto L13;
+}
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+1u);
+i32_store8(&m0,(U64)(si0)+1u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+2u);
+i32_store8(&m0,(U64)(si0)+2u,si1);
+si0=l4;
+si1=-3u;
+si0+=si1;
+l6=si0;
+si0=l3;
+si1=3u;
+si0+=si1;
+l7=si0;
+si0=l4;
+si1=-20u;
+si0+=si1;
+si1=-16u;
+si0&=si1;
+l8=si0;
+si0=0u;
+l2=si0;
+L16:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l7;
+si1=l2;
+si0+=si1;
+l3=si0;
+si1=l1;
+si2=l2;
+si1+=si2;
+l9=si1;
+si2=4u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l10=si1;
+si2=8u;
+si1 <<= (si2 & 31);
+si2=l5;
+si3=24u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=4u;
+si0+=si1;
+si1=l9;
+si2=8u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+si2=8u;
+si1 <<= (si2 & 31);
+si2=l10;
+si3=24u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=8u;
+si0+=si1;
+si1=l9;
+si2=12u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l10=si1;
+si2=8u;
+si1 <<= (si2 & 31);
+si2=l5;
+si3=24u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=12u;
+si0+=si1;
+si1=l9;
+si2=16u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+si2=8u;
+si1 <<= (si2 & 31);
+si2=l10;
+si3=24u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=16u;
+si0+=si1;
+l2=si0;
+si0=l6;
+si1=-16u;
+si0+=si1;
+l6=si0;
+si1=16u;
+si0=si0 > si1;
+if (si0) {
+goto L16;
+}
+}
+si0=l7;
+si1=l2;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=l2;
+si0+=si1;
+si1=3u;
+si0+=si1;
+l1=si0;
+si0=l4;
+si1=-19u;
+si0+=si1;
+si1=l8;
+si0-=si1;
+l4=si0;
+goto L13;
+L15:;
+si0=l3;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l4;
+si1=-1u;
+si0+=si1;
+l6=si0;
+si0=l3;
+si1=1u;
+si0+=si1;
+l7=si0;
+si0=l4;
+si1=-20u;
+si0+=si1;
+si1=-16u;
+si0&=si1;
+l8=si0;
+si0=0u;
+l2=si0;
+L17:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l7;
+si1=l2;
+si0+=si1;
+l3=si0;
+si1=l1;
+si2=l2;
+si1+=si2;
+l9=si1;
+si2=4u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l10=si1;
+si2=24u;
+si1 <<= (si2 & 31);
+si2=l5;
+si3=8u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=4u;
+si0+=si1;
+si1=l9;
+si2=8u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+si2=24u;
+si1 <<= (si2 & 31);
+si2=l10;
+si3=8u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=8u;
+si0+=si1;
+si1=l9;
+si2=12u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l10=si1;
+si2=24u;
+si1 <<= (si2 & 31);
+si2=l5;
+si3=8u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=12u;
+si0+=si1;
+si1=l9;
+si2=16u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+si2=24u;
+si1 <<= (si2 & 31);
+si2=l10;
+si3=8u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=16u;
+si0+=si1;
+l2=si0;
+si0=l6;
+si1=-16u;
+si0+=si1;
+l6=si0;
+si1=18u;
+si0=si0 > si1;
+if (si0) {
+goto L17;
+}
+}
+si0=l7;
+si1=l2;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=l2;
+si0+=si1;
+si1=1u;
+si0+=si1;
+l1=si0;
+si0=l4;
+si1=-17u;
+si0+=si1;
+si1=l8;
+si0-=si1;
+l4=si0;
+goto L13;
+L14:;
+si0=l3;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+1u);
+i32_store8(&m0,(U64)(si0)+1u,si1);
+si0=l4;
+si1=-2u;
+si0+=si1;
+l6=si0;
+si0=l3;
+si1=2u;
+si0+=si1;
+l7=si0;
+si0=l4;
+si1=-20u;
+si0+=si1;
+si1=-16u;
+si0&=si1;
+l8=si0;
+si0=0u;
+l2=si0;
+L18:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l7;
+si1=l2;
+si0+=si1;
+l3=si0;
+si1=l1;
+si2=l2;
+si1+=si2;
+l9=si1;
+si2=4u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l10=si1;
+si2=16u;
+si1 <<= (si2 & 31);
+si2=l5;
+si3=16u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=4u;
+si0+=si1;
+si1=l9;
+si2=8u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+si2=16u;
+si1 <<= (si2 & 31);
+si2=l10;
+si3=16u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=8u;
+si0+=si1;
+si1=l9;
+si2=12u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l10=si1;
+si2=16u;
+si1 <<= (si2 & 31);
+si2=l5;
+si3=16u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=12u;
+si0+=si1;
+si1=l9;
+si2=16u;
+si1+=si2;
+si1=i32_load(&m0,(U64)(si1));
+l5=si1;
+si2=16u;
+si1 <<= (si2 & 31);
+si2=l10;
+si3=16u;
+si2 >>= (si3 & 31);
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=16u;
+si0+=si1;
+l2=si0;
+si0=l6;
+si1=-16u;
+si0+=si1;
+l6=si0;
+si1=17u;
+si0=si0 > si1;
+if (si0) {
+goto L18;
+}
+}
+si0=l7;
+si1=l2;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=l2;
+si0+=si1;
+si1=2u;
+si0+=si1;
+l1=si0;
+si0=l4;
+si1=-18u;
+si0+=si1;
+si1=l8;
+si0-=si1;
+l4=si0;
+L13:;
+si0=l4;
+si1=16u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L19;
+}
+si0=l3;
+si1=l1;
+si1=i32_load16_u(&m0,(U64)(si1));
+i32_store16(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+2u);
+i32_store8(&m0,(U64)(si0)+2u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+3u);
+i32_store8(&m0,(U64)(si0)+3u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+4u);
+i32_store8(&m0,(U64)(si0)+4u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+5u);
+i32_store8(&m0,(U64)(si0)+5u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+6u);
+i32_store8(&m0,(U64)(si0)+6u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+7u);
+i32_store8(&m0,(U64)(si0)+7u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+8u);
+i32_store8(&m0,(U64)(si0)+8u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+9u);
+i32_store8(&m0,(U64)(si0)+9u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+10u);
+i32_store8(&m0,(U64)(si0)+10u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+11u);
+i32_store8(&m0,(U64)(si0)+11u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+12u);
+i32_store8(&m0,(U64)(si0)+12u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+13u);
+i32_store8(&m0,(U64)(si0)+13u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+14u);
+i32_store8(&m0,(U64)(si0)+14u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+15u);
+i32_store8(&m0,(U64)(si0)+15u,si1);
+si0=l3;
+si1=16u;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=16u;
+si0+=si1;
+l1=si0;
+L19:;
+si0=l4;
+si1=8u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L20;
+}
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1));
+i32_store8(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+1u);
+i32_store8(&m0,(U64)(si0)+1u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+2u);
+i32_store8(&m0,(U64)(si0)+2u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+3u);
+i32_store8(&m0,(U64)(si0)+3u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+4u);
+i32_store8(&m0,(U64)(si0)+4u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+5u);
+i32_store8(&m0,(U64)(si0)+5u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+6u);
+i32_store8(&m0,(U64)(si0)+6u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+7u);
+i32_store8(&m0,(U64)(si0)+7u,si1);
+si0=l3;
+si1=8u;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=8u;
+si0+=si1;
+l1=si0;
+L20:;
+si0=l4;
+si1=4u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L21;
+}
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1));
+i32_store8(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+1u);
+i32_store8(&m0,(U64)(si0)+1u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+2u);
+i32_store8(&m0,(U64)(si0)+2u,si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+3u);
+i32_store8(&m0,(U64)(si0)+3u,si1);
+si0=l3;
+si1=4u;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=4u;
+si0+=si1;
+l1=si0;
+L21:;
+si0=l4;
+si1=2u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L22;
+}
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1));
+i32_store8(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1)+1u);
+i32_store8(&m0,(U64)(si0)+1u,si1);
+si0=l3;
+si1=2u;
+si0+=si1;
+l3=si0;
+si0=l1;
+si1=2u;
+si0+=si1;
+l1=si0;
+L22:;
+si0=l4;
+si1=1u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l3;
+si1=l1;
+si1=i32_load8_u(&m0,(U64)(si1));
+i32_store8(&m0,(U64)(si0),si1);
+L1:;
+si0=l0;
+L0:;
+return si0;
+}
+
+U32 f28(U32 l0,U32 l1,U32 l2) {
+U32 l3=0;
+U32 l4=0;
+U32 l5=0;
+U64 l6=0;
+U32 si0,si1,si2;
+U64 sj0,sj1;
+si0=l2;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=l1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l0;
+si1=l2;
+si0+=si1;
+l3=si0;
+si1=-1u;
+si0+=si1;
+si1=l1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l2;
+si1=3u;
+si0=si0 < si1;
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=l1;
+i32_store8(&m0,(U64)(si0)+2u,si1);
+si0=l0;
+si1=l1;
+i32_store8(&m0,(U64)(si0)+1u,si1);
+si0=l3;
+si1=-3u;
+si0+=si1;
+si1=l1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l3;
+si1=-2u;
+si0+=si1;
+si1=l1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l2;
+si1=7u;
+si0=si0 < si1;
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=l1;
+i32_store8(&m0,(U64)(si0)+3u,si1);
+si0=l3;
+si1=-4u;
+si0+=si1;
+si1=l1;
+i32_store8(&m0,(U64)(si0),si1);
+si0=l2;
+si1=9u;
+si0=si0 < si1;
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=0u;
+si2=l0;
+si1-=si2;
+si2=3u;
+si1&=si2;
+l4=si1;
+si0+=si1;
+l3=si0;
+si1=l1;
+si2=255u;
+si1&=si2;
+si2=16843009u;
+si1*=si2;
+l1=si1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l2;
+si2=l4;
+si1-=si2;
+si2=-4u;
+si1&=si2;
+l4=si1;
+si0+=si1;
+l2=si0;
+si1=-4u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=9u;
+si0=si0 < si1;
+if (si0) {
+goto L1;
+}
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l2;
+si1=-8u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=-12u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=25u;
+si0=si0 < si1;
+if (si0) {
+goto L1;
+}
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0)+20u,si1);
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l2;
+si1=-16u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=-20u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=-24u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l2;
+si1=-28u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=l3;
+si2=4u;
+si1&=si2;
+si2=24u;
+si1|=si2;
+l5=si1;
+si0-=si1;
+l2=si0;
+si1=32u;
+si0=si0 < si1;
+if (si0) {
+goto L1;
+}
+si0=l1;
+sj0=(U64)(si0);
+l6=sj0;
+sj1=32ull;
+sj0 <<= (sj1 & 63);
+sj1=l6;
+sj0|=sj1;
+l6=sj0;
+si0=l3;
+si1=l5;
+si0+=si1;
+l1=si0;
+L2:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l1;
+sj1=l6;
+i64_store(&m0,(U64)(si0),sj1);
+si0=l1;
+si1=24u;
+si0+=si1;
+sj1=l6;
+i64_store(&m0,(U64)(si0),sj1);
+si0=l1;
+si1=16u;
+si0+=si1;
+sj1=l6;
+i64_store(&m0,(U64)(si0),sj1);
+si0=l1;
+si1=8u;
+si0+=si1;
+sj1=l6;
+i64_store(&m0,(U64)(si0),sj1);
+si0=l1;
+si1=32u;
+si0+=si1;
+l1=si0;
+si0=l2;
+si1=-32u;
+si0+=si1;
+l2=si0;
+si1=31u;
+si0=si0 > si1;
+if (si0) {
+goto L2;
+}
+}
+L1:;
+si0=l0;
+L0:;
+return si0;
+}
+
+U32 f29(U32 l0) {
+U32 l1=0;
+U32 l2=0;
+U32 si0,si1,si2;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=f30(si0);
+si1=1u;
+si0+=si1;
+l1=si0;
+si0=f13(si0);
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+si0=l2;
+si1=l0;
+si2=l1;
+si0=f27(si0,si1,si2);
+goto L0;
+L1:;
+si0=0u;
+L0:;
+return si0;
+}
+
+U32 f30(U32 l0) {
+U32 l1=0;
+U32 l2=0;
+U32 l3=0;
+U32 si0,si1,si2;
+si0=l0;
+l1=si0;
+si0=l0;
+si1=3u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L3;
+}
+si0=l0;
+si0=i32_load8_u(&m0,(U64)(si0));
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=l0;
+si1=1u;
+si0+=si1;
+l1=si0;
+L4:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l1;
+si1=3u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L3;
+}
+si0=l1;
+si0=i32_load8_u(&m0,(U64)(si0));
+l2=si0;
+si0=l1;
+si1=1u;
+si0+=si1;
+l3=si0;
+l1=si0;
+si0=l2;
+if (si0) {
+goto L4;
+}
+}
+si0=l3;
+si1=-1u;
+si0+=si1;
+si1=l0;
+si0-=si1;
+goto L0;
+L3:;
+si0=l1;
+si1=-4u;
+si0+=si1;
+l1=si0;
+L5:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l1;
+si1=4u;
+si0+=si1;
+l1=si0;
+si0=i32_load(&m0,(U64)(si0));
+l2=si0;
+si1=-1u;
+si0^=si1;
+si1=l2;
+si2=-16843009u;
+si1+=si2;
+si0&=si1;
+si1=-2139062144u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L5;
+}
+}
+si0=l2;
+si1=255u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+L6:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l1;
+si0=i32_load8_u(&m0,(U64)(si0)+1u);
+l2=si0;
+si0=l1;
+si1=1u;
+si0+=si1;
+l3=si0;
+l1=si0;
+si0=l2;
+if (si0) {
+goto L6;
+}
+}
+si0=l3;
+si1=l0;
+si0-=si1;
+goto L0;
+L2:;
+si0=l0;
+si1=l0;
+si0-=si1;
+goto L0;
+L1:;
+si0=l1;
+si1=l0;
+si0-=si1;
+L0:;
+return si0;
+}
+
+U32 f31(U32 l0) {
+U32 si0;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+56u);
+si0=f19(si0);
+L0:;
+return si0;
+}
+
+U32 f32(U32 l0,U32 l1,U32 l2) {
+U32 l3=0;
+U32 l4=0;
+U32 si0,si1,si2,si3,si4;
+si0=g0;
+si1=16u;
+si0-=si1;
+l3=si0;
+g0=si0;
+si0=-1u;
+l4=si0;
+si0=l2;
+si1=-1u;
+si0 = (U32)((I32)si0 <= (I32)si1);
+if (si0) {
+goto L3;
+}
+si0=l0;
+si1=l1;
+si2=l2;
+si3=l3;
+si4=12u;
+si3+=si4;
+si0=(*f_wasiX5Funstable_fdX5Fwrite)(si0,si1,si2,si3);
+l2=si0;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=0u;
+si1=l2;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+si0=-1u;
+l4=si0;
+goto L1;
+L3:;
+si0=0u;
+si1=28u;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+goto L1;
+L2:;
+si0=l3;
+si0=i32_load(&m0,(U64)(si0)+12u);
+l4=si0;
+L1:;
+si0=l3;
+si1=16u;
+si0+=si1;
+g0=si0;
+si0=l4;
+L0:;
+return si0;
+}
+
+U32 f33(U32 l0,U32 l1,U32 l2) {
+U32 l3=0;
+U32 l4=0;
+U32 l5=0;
+U32 l6=0;
+U32 l7=0;
+U32 l8=0;
+U32 l9=0;
+U32 si0,si1,si2,si3,si4,si5;
+U64 sj1;
+WASM_INTERRUPT_CHECK();
+si0=g0;
+si1=16u;
+si0-=si1;
+l3=si0;
+g0=si0;
+si0=l3;
+si1=l2;
+i32_store(&m0,(U64)(si0)+12u,si1);
+si0=l3;
+si1=l1;
+i32_store(&m0,(U64)(si0)+8u,si1);
+si0=l3;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+24u);
+l1=si1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l3;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+20u);
+si2=l1;
+si1-=si2;
+l1=si1;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=2u;
+l4=si0;
+si0=l1;
+si1=l2;
+si0+=si1;
+l5=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+56u);
+si2=l3;
+si3=2u;
+si1=f32(si1,si2,si3);
+l6=si1;
+si0=si0 == si1;
+if (si0) {
+goto L3;
+}
+si0=l3;
+l1=si0;
+si0=l0;
+si1=56u;
+si0+=si1;
+l7=si0;
+L4:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l6;
+si1=-1u;
+si0 = (U32)((I32)si0 <= (I32)si1);
+if (si0) {
+goto L2;
+}
+si0=l1;
+si1=8u;
+si0+=si1;
+si1=l1;
+si2=l6;
+si3=l1;
+si3=i32_load(&m0,(U64)(si3)+4u);
+l8=si3;
+si2=si2 > si3;
+l9=si2;
+si0=si2 ? si0 : si1;
+l1=si0;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1));
+si2=l6;
+si3=l8;
+si4=0u;
+si5=l9;
+si3=si5 ? si3 : si4;
+si2-=si3;
+l8=si2;
+si1+=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l1;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si2=l8;
+si1-=si2;
+i32_store(&m0,(U64)(si0)+4u,si1);
+si0=l5;
+si1=l6;
+si0-=si1;
+l5=si0;
+si0=l7;
+si0=i32_load(&m0,(U64)(si0));
+si1=l1;
+si2=l4;
+si3=l9;
+si2-=si3;
+l4=si2;
+si0=f32(si0,si1,si2);
+l9=si0;
+l6=si0;
+si0=l5;
+si1=l9;
+si0=si0 != si1;
+if (si0) {
+goto L4;
+}
+}
+L3:;
+si0=l0;
+si1=24u;
+si0+=si1;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+40u);
+l1=si1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=20u;
+si0+=si1;
+si1=l1;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=l1;
+si2=l0;
+si2=i32_load(&m0,(U64)(si2)+44u);
+si1+=si2;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=l2;
+l6=si0;
+goto L1;
+L2:;
+si0=l0;
+sj1=0ull;
+i64_store(&m0,(U64)(si0)+16u,sj1);
+si0=0u;
+l6=si0;
+si0=l0;
+si1=24u;
+si0+=si1;
+si1=0u;
+i32_store(&m0,(U64)(si0),si1);
+si0=l0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1));
+si2=32u;
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=2u;
+si0=si0 == si1;
+if (si0) {
+goto L1;
+}
+si0=l2;
+si1=l1;
+si1=i32_load(&m0,(U64)(si1)+4u);
+si0-=si1;
+l6=si0;
+L1:;
+si0=l3;
+si1=16u;
+si0+=si1;
+g0=si0;
+si0=l6;
+L0:;
+return si0;
+}
+
+U32 f34(U32 l0) {
+U32 l1=0;
+U32 l2=0;
+U32 si0,si1,si2;
+si0=g0;
+si1=32u;
+si0-=si1;
+l1=si0;
+g0=si0;
+si0=l0;
+si1=l1;
+si2=8u;
+si1+=si2;
+si0=(*f_wasiX5Funstable_fdX5FfdstatX5Fget)(si0,si1);
+l0=si0;
+if (si0) {
+goto L3;
+}
+si0=59u;
+l0=si0;
+si0=l1;
+si0=i32_load8_u(&m0,(U64)(si0)+8u);
+si1=2u;
+si0=si0 != si1;
+if (si0) {
+goto L3;
+}
+si0=l1;
+si0=i32_load8_u(&m0,(U64)(si0)+16u);
+si1=36u;
+si0&=si1;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+L3:;
+si0=0u;
+l2=si0;
+si0=0u;
+si1=l0;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+goto L1;
+L2:;
+si0=1u;
+l2=si0;
+L1:;
+si0=l1;
+si1=32u;
+si0+=si1;
+g0=si0;
+si0=l2;
+L0:;
+return si0;
+}
+
+U32 f35(U32 l0,U32 l1,U32 l2) {
+U32 si0,si1,si2;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si1=1u;
+i32_store(&m0,(U64)(si0)+32u,si1);
+si0=l0;
+si0=i32_load8_u(&m0,(U64)(si0));
+si1=64u;
+si0&=si1;
+if (si0) {
+goto L2;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+56u);
+si0=f34(si0);
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+L2:;
+si0=l0;
+si1=l1;
+si2=l2;
+si0=f33(si0,si1,si2);
+goto L0;
+L1:;
+si0=l0;
+si1=-1u;
+i32_store(&m0,(U64)(si0)+64u,si1);
+si0=l0;
+si1=l1;
+si2=l2;
+si0=f33(si0,si1,si2);
+L0:;
+return si0;
+}
+
+U64 f36(U32 l0,U64 l1,U32 l2) {
+U32 l3=0;
+U32 si0,si1,si2,si3,si4;
+U64 sj0,sj1;
+si0=g0;
+si1=16u;
+si0-=si1;
+l3=si0;
+g0=si0;
+si0=l0;
+sj1=l1;
+si2=l2;
+si3=255u;
+si2&=si3;
+si3=l3;
+si4=8u;
+si3+=si4;
+si0=(*f_wasiX5Funstable_fdX5Fseek)(si0,sj1,si2,si3);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L2;
+}
+si0=0u;
+si1=70u;
+si2=l0;
+si3=l0;
+si4=76u;
+si3=si3 == si4;
+si1=si3 ? si1 : si2;
+i32_store(&m0,(U64)(si0)+1520u,si1);
+sj0=-1ull;
+l1=sj0;
+goto L1;
+L2:;
+si0=l3;
+sj0=i64_load(&m0,(U64)(si0)+8u);
+l1=sj0;
+L1:;
+si0=l3;
+si1=16u;
+si0+=si1;
+g0=si0;
+sj0=l1;
+L0:;
+return sj0;
+}
+
+U64 f37(U32 l0,U64 l1,U32 l2) {
+U32 si0,si2;
+U64 sj0,sj1;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+56u);
+sj1=l1;
+si2=l2;
+sj0=f36(si0,sj1,si2);
+L0:;
+return sj0;
+}
+
+U32 f38() {
+U32 si0;
+si0=2568u;
+L0:;
+return si0;
+}
+
+void f39() {
+U32 l0=0;
+U32 l1=0;
+U32 l2=0;
+U32 si0,si1,si2,si3;
+U64 sj0,sj1;
+WASM_INTERRUPT_CHECK();
+si0=f38();
+si0=i32_load(&m0,(U64)(si0));
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L1;
+}
+L2:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+20u);
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+24u);
+si0=si0 == si1;
+if (si0) {
+goto L3;
+}
+si0=l0;
+si1=0u;
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+32u);
+si0=TF(t0,si3,U32 (*)(U32,U32,U32))(si0,si1,si2);
+L3:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l1=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l2=si1;
+si0=si0 == si1;
+if (si0) {
+goto L4;
+}
+si0=l0;
+si1=l1;
+si2=l2;
+si1-=si2;
+sj1=(U64)(I64)(I32)(si1);
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+36u);
+sj0=TF(t0,si3,U64 (*)(U32,U64,U32))(si0,sj1,si2);
+L4:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+52u);
+l0=si0;
+if (si0) {
+goto L2;
+}
+}
+L1:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+2572u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L5;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+20u);
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+24u);
+si0=si0 == si1;
+if (si0) {
+goto L6;
+}
+si0=l0;
+si1=0u;
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+32u);
+si0=TF(t0,si3,U32 (*)(U32,U32,U32))(si0,si1,si2);
+L6:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l1=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l2=si1;
+si0=si0 == si1;
+if (si0) {
+goto L5;
+}
+si0=l0;
+si1=l1;
+si2=l2;
+si1-=si2;
+sj1=(U64)(I64)(I32)(si1);
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+36u);
+sj0=TF(t0,si3,U64 (*)(U32,U64,U32))(si0,sj1,si2);
+L5:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+2688u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L7;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+20u);
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+24u);
+si0=si0 == si1;
+if (si0) {
+goto L8;
+}
+si0=l0;
+si1=0u;
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+32u);
+si0=TF(t0,si3,U32 (*)(U32,U32,U32))(si0,si1,si2);
+L8:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l1=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l2=si1;
+si0=si0 == si1;
+if (si0) {
+goto L7;
+}
+si0=l0;
+si1=l1;
+si2=l2;
+si1-=si2;
+sj1=(U64)(I64)(I32)(si1);
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+36u);
+sj0=TF(t0,si3,U64 (*)(U32,U64,U32))(si0,sj1,si2);
+L7:;
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+2572u);
+l0=si0;
+si0=!(si0);
+if (si0) {
+goto L9;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+20u);
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+24u);
+si0=si0 == si1;
+if (si0) {
+goto L10;
+}
+si0=l0;
+si1=0u;
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+32u);
+si0=TF(t0,si3,U32 (*)(U32,U32,U32))(si0,si1,si2);
+L10:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+4u);
+l1=si0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+8u);
+l2=si1;
+si0=si0 == si1;
+if (si0) {
+goto L9;
+}
+si0=l0;
+si1=l1;
+si2=l2;
+si1-=si2;
+sj1=(U64)(I64)(I32)(si1);
+si2=0u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+36u);
+sj0=TF(t0,si3,U64 (*)(U32,U64,U32))(si0,sj1,si2);
+L9:;
+L0:;
+}
+
+U32 f40(U32 l0) {
+U32 l1=0;
+U32 si0,si1,si2;
+U64 sj1;
+si0=l0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+60u);
+l1=si1;
+si2=-1u;
+si1+=si2;
+si2=l1;
+si1|=si2;
+i32_store(&m0,(U64)(si0)+60u,si1);
+si0=l0;
+si0=i32_load(&m0,(U64)(si0));
+l1=si0;
+si1=8u;
+si0&=si1;
+if (si0) {
+goto L1;
+}
+si0=l0;
+sj1=0ull;
+i64_store(&m0,(U64)(si0)+4u,sj1);
+si0=l0;
+si1=l0;
+si1=i32_load(&m0,(U64)(si1)+40u);
+l1=si1;
+i32_store(&m0,(U64)(si0)+24u,si1);
+si0=l0;
+si1=l1;
+i32_store(&m0,(U64)(si0)+20u,si1);
+si0=l0;
+si1=l1;
+si2=l0;
+si2=i32_load(&m0,(U64)(si2)+44u);
+si1+=si2;
+i32_store(&m0,(U64)(si0)+16u,si1);
+si0=0u;
+goto L0;
+L1:;
+si0=l0;
+si1=l1;
+si2=32u;
+si1|=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=-1u;
+L0:;
+return si0;
+}
+
+U32 f41(U32 l0,U32 l1,U32 l2) {
+U32 l3=0;
+U32 l4=0;
+U32 l5=0;
+U32 l6=0;
+U32 l7=0;
+U32 l8=0;
+U32 si0,si1,si2,si3;
+WASM_INTERRUPT_CHECK();
+si0=l2;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l3=si0;
+if (si0) {
+goto L2;
+}
+si0=0u;
+l6=si0;
+si0=l2;
+si0=f40(si0);
+if (si0) {
+goto L1;
+}
+si0=l2;
+si1=16u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l3=si0;
+L2:;
+si0=l3;
+si1=l2;
+si1=i32_load(&m0,(U64)(si1)+20u);
+l4=si1;
+si0-=si1;
+si1=l1;
+si0=si0 >= si1;
+if (si0) {
+goto L3;
+}
+si0=l2;
+si1=l0;
+si2=l1;
+si3=l2;
+si3=i32_load(&m0,(U64)(si3)+32u);
+si0=TF(t0,si3,U32 (*)(U32,U32,U32))(si0,si1,si2);
+goto L0;
+L3:;
+si0=0u;
+l5=si0;
+si0=l2;
+si0=i32_load(&m0,(U64)(si0)+64u);
+si1=0u;
+si0 = (U32)((I32)si0 < (I32)si1);
+if (si0) {
+goto L4;
+}
+si0=0u;
+l5=si0;
+si0=l0;
+l6=si0;
+si0=0u;
+l3=si0;
+L5:;
+{
+WASM_INTERRUPT_CHECK();
+si0=l1;
+si1=l3;
+si0=si0 == si1;
+if (si0) {
+goto L4;
+}
+si0=l3;
+si1=1u;
+si0+=si1;
+l3=si0;
+si0=l6;
+si1=l1;
+si0+=si1;
+l7=si0;
+si0=l6;
+si1=-1u;
+si0+=si1;
+l8=si0;
+l6=si0;
+si0=l7;
+si1=-1u;
+si0+=si1;
+si0=i32_load8_u(&m0,(U64)(si0));
+si1=10u;
+si0=si0 != si1;
+if (si0) {
+goto L5;
+}
+}
+si0=l2;
+si1=l0;
+si2=l1;
+si3=l3;
+si2-=si3;
+si3=1u;
+si2+=si3;
+l5=si2;
+si3=l2;
+si3=i32_load(&m0,(U64)(si3)+32u);
+si0=TF(t0,si3,U32 (*)(U32,U32,U32))(si0,si1,si2);
+l6=si0;
+si1=l5;
+si0=si0 < si1;
+if (si0) {
+goto L1;
+}
+si0=l8;
+si1=l1;
+si0+=si1;
+si1=1u;
+si0+=si1;
+l0=si0;
+si0=l2;
+si1=20u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l4=si0;
+si0=l3;
+si1=-1u;
+si0+=si1;
+l1=si0;
+L4:;
+si0=l4;
+si1=l0;
+si2=l1;
+si0=f27(si0,si1,si2);
+si0=l2;
+si1=20u;
+si0+=si1;
+l3=si0;
+si1=l3;
+si1=i32_load(&m0,(U64)(si1));
+si2=l1;
+si1+=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l5;
+si1=l1;
+si0+=si1;
+goto L0;
+L1:;
+si0=l6;
+L0:;
+return si0;
+}
+
+U32 f42(U32 l0,U32 l1,U32 l2,U32 l3) {
+U32 l4=0;
+U32 si0,si1,si2;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si1=l2;
+si2=l1;
+si1*=si2;
+l4=si1;
+si2=l3;
+si0=f41(si0,si1,si2);
+l0=si0;
+si1=l4;
+si0=si0 != si1;
+if (si0) {
+goto L1;
+}
+si0=l2;
+si1=0u;
+si2=l1;
+si0=si2 ? si0 : si1;
+goto L0;
+L1:;
+si0=l0;
+si1=l1;
+si0=DIV_U(si0,si1);
+L0:;
+return si0;
+}
+
+U32 f43(U32 l0,U32 l1) {
+U32 l2=0;
+U32 si0,si1,si2,si3,si4,si5,si6;
+WASM_INTERRUPT_CHECK();
+si0=-1u;
+si1=0u;
+si2=l0;
+si2=f30(si2);
+l2=si2;
+si3=l0;
+si4=1u;
+si5=l2;
+si6=l1;
+si3=f42(si3,si4,si5,si6);
+si2=si2 != si3;
+si0=si2 ? si0 : si1;
+L0:;
+return si0;
+}
+
+U32 f44(U32 l0,U32 l1) {
+U32 l2=0;
+U32 l3=0;
+U32 l4=0;
+U32 si0,si1,si2,si3;
+WASM_INTERRUPT_CHECK();
+si0=g0;
+si1=16u;
+si0-=si1;
+l2=si0;
+g0=si0;
+si0=l2;
+si1=l1;
+i32_store8(&m0,(U64)(si0)+15u,si1);
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+16u);
+l3=si0;
+if (si0) {
+goto L2;
+}
+si0=-1u;
+l3=si0;
+si0=l0;
+si0=f40(si0);
+if (si0) {
+goto L1;
+}
+si0=l0;
+si1=16u;
+si0+=si1;
+si0=i32_load(&m0,(U64)(si0));
+l3=si0;
+L2:;
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+20u);
+l4=si0;
+si1=l3;
+si0=si0 == si1;
+if (si0) {
+goto L4;
+}
+si0=l0;
+si0=i32_load(&m0,(U64)(si0)+64u);
+si1=l1;
+si2=255u;
+si1&=si2;
+l3=si1;
+si0=si0 != si1;
+if (si0) {
+goto L3;
+}
+L4:;
+si0=-1u;
+l3=si0;
+si0=l0;
+si1=l2;
+si2=15u;
+si1+=si2;
+si2=1u;
+si3=l0;
+si3=i32_load(&m0,(U64)(si3)+32u);
+si0=TF(t0,si3,U32 (*)(U32,U32,U32))(si0,si1,si2);
+si1=1u;
+si0=si0 != si1;
+if (si0) {
+goto L1;
+}
+si0=l2;
+si0=i32_load8_u(&m0,(U64)(si0)+15u);
+l3=si0;
+goto L1;
+L3:;
+si0=l0;
+si1=20u;
+si0+=si1;
+si1=l4;
+si2=1u;
+si1+=si2;
+i32_store(&m0,(U64)(si0),si1);
+si0=l4;
+si1=l1;
+i32_store8(&m0,(U64)(si0),si1);
+L1:;
+si0=l2;
+si1=16u;
+si0+=si1;
+g0=si0;
+si0=l3;
+L0:;
+return si0;
+}
+
+U32 f45(U32 l0) {
+U32 si0,si1,si2;
+WASM_INTERRUPT_CHECK();
+si0=l0;
+si1=2576u;
+si0=f43(si0,si1);
+si1=0u;
+si0 = (U32)((I32)si0 < (I32)si1);
+if (si0) {
+goto L1;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+2640u);
+si1=10u;
+si0=si0 == si1;
+if (si0) {
+goto L2;
+}
+si0=0u;
+si0=i32_load(&m0,(U64)(si0)+2596u);
+l0=si0;
+si1=0u;
+si1=i32_load(&m0,(U64)(si1)+2592u);
+si0=si0 == si1;
+if (si0) {
+goto L2;
+}
+si0=0u;
+si1=l0;
+si2=1u;
+si1+=si2;
+i32_store(&m0,(U64)(si0)+2596u,si1);
+si0=l0;
+si1=10u;
+i32_store8(&m0,(U64)(si0),si1);
+si0=0u;
+goto L0;
+L2:;
+si0=2576u;
+si1=10u;
+si0=f44(si0,si1);
+si1=31u;
+si0 = (U32)((I32)si0 >> (si1 & 31));
+goto L0;
+L1:;
+si0=-1u;
+L0:;
+return si0;
+}
+
+U32 f46() {
+U32 si0;
+WASM_INTERRUPT_CHECK();
+si0=2692u;
+si0=f45(si0);
+si0=0u;
+L0:;
+return si0;
+}
+
+U32 f47(U32 l0,U32 l1) {
+U32 si0;
+WASM_INTERRUPT_CHECK();
+si0=f46();
+L0:;
+return si0;
+}
+
@@ -0,0 +1,114 @@
+#include "w2c2_base.h"
+
+extern U32 (*f_wasiX5Funstable_fdX5FprestatX5Fget)(U32,U32);
+
+extern U32 (*f_wasiX5Funstable_fdX5FprestatX5FdirX5Fname)(U32,U32,U32);
+
+extern U32 (*f_wasiX5Funstable_environX5FsizesX5Fget)(U32,U32);
+
+extern U32 (*f_wasiX5Funstable_environX5Fget)(U32,U32);
+
+extern U32 (*f_wasiX5Funstable_argsX5FsizesX5Fget)(U32,U32);
+
+extern U32 (*f_wasiX5Funstable_argsX5Fget)(U32,U32);
+
+extern void (*f_wasiX5Funstable_procX5Fexit)(U32);
+
+extern U32 (*f_wasiX5Funstable_fdX5FfdstatX5Fget)(U32,U32);
+
+extern U32 (*f_wasiX5Funstable_fdX5Fclose)(U32);
+
+extern U32 (*f_wasiX5Funstable_fdX5Fwrite)(U32,U32,U32,U32);
+
+extern U32 (*f_wasiX5Funstable_fdX5Fseek)(U32,U64,U32,U32);
+
+void f11();
+
+void f12();
+
+U32 f13(U32);
+
+U32 f14(U32);
+
+void f15(U32);
+
+void f16(U32);
+
+U32 f17(U32,U32);
+
+void f18(U32);
+
+U32 f19(U32);
+
+void f20(U32);
+
+void f21();
+
+U32 f22(U32,U32);
+
+void f23();
+
+U32 f24(U32);
+
+void f25();
+
+void f26();
+
+U32 f27(U32,U32,U32);
+
+U32 f28(U32,U32,U32);
+
+U32 f29(U32);
+
+U32 f30(U32);
+
+U32 f31(U32);
+
+U32 f32(U32,U32,U32);
+
+U32 f33(U32,U32,U32);
+
+U32 f34(U32);
+
+U32 f35(U32,U32,U32);
+
+U64 f36(U32,U64,U32);
+
+U64 f37(U32,U64,U32);
+
+U32 f38();
+
+void f39();
+
+U32 f40(U32);
+
+U32 f41(U32,U32,U32);
+
+U32 f42(U32,U32,U32,U32);
+
+U32 f43(U32,U32);
+
+U32 f44(U32,U32);
+
+U32 f45(U32);
+
+U32 f46();
+
+U32 f47(U32,U32);
+
+extern wasmMemory m0;
+
+extern wasmTable t0;
+
+extern U32 g0;
+
+extern U32 g1;
+
+extern U32 g2;
+
+extern wasmMemory (*e_memory);
+
+extern void (*e_X5Fstart)();
+
+void f_hello_X5Fstart();
+
@@ -0,0 +1,30 @@
+#include "w2c2_base.h"
+
+#include "decls.h"
+#include "exports.h"
+
+extern void init(void);
+
+jmp_buf* wasmTrapTarget = NULL;
+
+bool wasm_X5Fstart(Trap* trap) {
+    jmp_buf target;
+    jmp_buf* previousTarget = wasmTrapTarget;
+    int code;
+    wasmTrapTarget = &target;
+    code = setjmp(target);
+    if (code == 0) {
+        f12();
+    }
+    wasmTrapTarget = previousTarget;
+    if (code != 0 && trap != NULL) {
+        *trap = (Trap)(code - 1);
+    }
+    return code == 0;
+}
+
+bool wasmInstantiate(Trap* trap) {
+    init();
+    (void)trap;
+    return true;
+}
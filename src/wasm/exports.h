@@ -0,0 +1,16 @@
+#ifndef W2C2_EXPORTS_H
+#define W2C2_EXPORTS_H
+
+#include "w2c2_base.h"
+
+/*
+ * Trap-safe wrappers for the exported functions.
+ * They return false if the call trapped, and store the trap reason if trap is not NULL
+ */
+
+/* Initializes the module and runs its _initialize export, if any */
+bool wasmInstantiate(Trap* trap);
+
+bool wasm_X5Fstart(Trap* trap);
+
+#endif /* W2C2_EXPORTS_H */
@@ -0,0 +1,46 @@
+#ifndef WASM2NATIVE_H
+#define WASM2NATIVE_H
+
+/*
+ * Embedding API for modules built as a library (WASM2NATIVE_LIBRARY).
+ *
+ * Call wasm2native_init once, then the typed, trap-safe export wrappers
+ * declared in the generated wasm/exports.h:
+ *
+ *     Trap trap;
+ *     U32 sum;
+ *     if (!wasm_add(1, 2, &sum, &trap)) {
+ *         fprintf(stderr, "trap: %s\n", trapDescription(trap));
+ *     }
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Sets up WASI with the given arguments, instantiates the module and runs
+ * its _initialize export. Returns 0 on success */
+int wasm2native_init(int argc, const char** argv);
+
+void wasm2native_destroy(void);
+
+/* Sets up the calling thread to call into the module (Linux): guests that
+ * overflow its stack fail with trapCallStackExhausted instead of crashing.
+ * wasm2native_init does this for its own thread. Returns 0 on success */
+int wasm2native_thread_init(void);
+
+/* Pins the calling thread to the CPUs of a NUMA node (Linux), e.g. each thread
+ * that calls into the module. Returns 0 on success */
+int wasm2native_numa_pin(int node);
+
+/* With WASM_INTERRUPTS, a guest that reaches wasmEpochDeadline (see w2c2_base.h)
+ * calls this handler if set. Returning nonzero resumes the guest, e.g. after
+ * moving the deadline; otherwise the export fails with trapInterrupted.
+ * Defined in every library build, without WASM_INTERRUPTS it is never called */
+extern int (*wasm2native_interrupt_handler)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WASM2NATIVE_H */
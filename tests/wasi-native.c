@@ -0,0 +1,80 @@
+/*
+ * Tests for the native Linux WASI backend (src/wasi-native.h)
+ *
+ * path_open of a symlink: without UVWASI_LOOKUP_SYMLINK_FOLLOW it fails
+ * with ELOOP, with it the target is opened. Both for a symlink next to
+ * the preopen and one in a subdirectory, which goes through the
+ * directory cache. Runs in a temporary directory.
+ *
+ * Built and run by ctest on Linux, see CMakeLists.txt
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "wasi-native.h"
+
+static uvwasi_t uvwasi;
+static int failures;
+
+static void expect_open(const char* path, uvwasi_lookupflags_t dirflags, uvwasi_errno_t expected) {
+    uvwasi_fd_t fd;
+    uvwasi_errno_t err = wasi_native_path_open(&uvwasi, 3, dirflags, path, strlen(path), 0,
+                                               UVWASI_RIGHT_FD_READ, 0, 0, &fd);
+    if (err != expected) {
+        fprintf(stderr, "path_open(\"%s\", dirflags=%u): %s, expected %s\n", path, dirflags,
+                uvwasi_embedder_err_code_to_string(err), uvwasi_embedder_err_code_to_string(expected));
+        failures++;
+    }
+    if (err == UVWASI_ESUCCESS) {
+        wasi_native_fd_close(&uvwasi, fd);
+    }
+}
+
+int main(void) {
+    char dir[] = "/tmp/wasi-native-test.XXXXXX";
+    if (mkdtemp(dir) == NULL || chdir(dir) != 0) {
+        perror("temporary directory");
+        return 1;
+    }
+
+    FILE* target = fopen("target", "w");
+    if (target == NULL || fclose(target) != 0 ||
+        mkdir("sub", 0700) != 0 ||
+        symlink("target", "link") != 0 ||
+        symlink("../target", "sub/link") != 0) {
+        perror("setup");
+        return 1;
+    }
+
+    uvwasi_preopen_t preopen = { "/", dir };
+    uvwasi_options_t options;
+    uvwasi_options_init(&options);
+    options.preopenc = 1;
+    options.preopens = &preopen;
+    if (uvwasi_init(&uvwasi, &options) != UVWASI_ESUCCESS) {
+        fprintf(stderr, "uvwasi_init failed\n");
+        return 1;
+    }
+
+    expect_open("target", 0, UVWASI_ESUCCESS);
+    expect_open("link", 0, UVWASI_ELOOP);
+    expect_open("link", UVWASI_LOOKUP_SYMLINK_FOLLOW, UVWASI_ESUCCESS);
+    expect_open("sub/link", 0, UVWASI_ELOOP);
+    expect_open("sub/link", UVWASI_LOOKUP_SYMLINK_FOLLOW, UVWASI_ESUCCESS);
+
+    uvwasi_destroy(&uvwasi);
+    unlink("sub/link");
+    unlink("link");
+    unlink("target");
+    rmdir("sub");
+    rmdir(dir);
+
+    if (failures != 0) {
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}